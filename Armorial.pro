@@ -17,6 +17,9 @@ OBJECTS_DIR = tmp/obj
 # Compilation flags
 QMAKE_CXXFLAGS_RELEASE = -O2 -Wfloat-equal -Wshadow -Woverloaded-virtual
 
+# Keep a * b + c rounded twice, so that results do not change when -march enables FMA instructions
+QMAKE_CXXFLAGS += -ffp-contract=off
+
 # -Wold-style-cast
 count(arch, 1) {
     QMAKE_CXXFLAGS_RELEASE += -march=$$arch
@@ -26,7 +29,10 @@ count(arch, 1) {
 INCLUDEPATH *= include
 
 HEADERS     += \
+    include/Armorial/Algorithms/Auction/Auction.h \
+    include/Armorial/Algorithms/Auction/impl/auction_impl.h \
     include/Armorial/Algorithms/Hungarian/Hungarian.h \
+    include/Armorial/Algorithms/Hungarian/impl/fixed_hungarian_impl.h \
     include/Armorial/Algorithms/Hungarian/impl/hungarian_impl.h \
     include/Armorial/Base/Base.h \
     include/Armorial/Base/Client/Client.h \
@@ -34,6 +40,7 @@ HEADERS     += \
     include/Armorial/Common/Enums/Color/Color.h \
     include/Armorial/Common/Enums/Enums.h \
     include/Armorial/Common/Enums/Quadrant/Quadrant.h \
+    include/Armorial/Common/Enums/Region/Region.h \
     include/Armorial/Common/Enums/Side/Side.h \
     include/Armorial/Common/Packet/Packet.h \
     include/Armorial/Common/Types/Object/Object.h \
@@ -42,28 +49,58 @@ HEADERS     += \
     include/Armorial/Common/Widgets/FieldView/FieldView.h \
     include/Armorial/Common/Widgets/GLText/GLText.h \
     include/Armorial/Geometry/Angle/Angle.h \
+    include/Armorial/Geometry/AngularSweep/AngularSweep.h \
     include/Armorial/Geometry/Arc/Arc.h \
+    include/Armorial/Geometry/Batch/Batch.h \
     include/Armorial/Geometry/Circle/Circle.h \
+    include/Armorial/Geometry/CircleSet/CircleSet.h \
+    include/Armorial/Geometry/KDTree/KDTree.h \
     include/Armorial/Geometry/Line/Line.h \
     include/Armorial/Geometry/LineSegment/LineSegment.h \
     include/Armorial/Geometry/Polygon/Polygon.h \
+    include/Armorial/Geometry/PreparedPolygon/PreparedPolygon.h \
     include/Armorial/Geometry/Rectangle/Rectangle.h \
+    include/Armorial/Geometry/Rotation2D/Rotation2D.h \
+    include/Armorial/Geometry/SweepAndPrune/SweepAndPrune.h \
+    include/Armorial/Geometry/SweptCircle/SweptCircle.h \
+    include/Armorial/Geometry/Transform2D/Transform2D.h \
     include/Armorial/Geometry/Triangle/Triangle.h \
     include/Armorial/Geometry/Vector2D/Vector2D.h \
     include/Armorial/Libs/magic_enum/include/magic_enum.hpp \
     include/Armorial/Libs/nameof/include/nameof.hpp \
+    include/Armorial/Math/Cholesky/Cholesky.h \
+    include/Armorial/Math/FixedMatrix/FixedMatrix.h \
+    include/Armorial/Math/LU/LU.h \
     include/Armorial/Math/Math.h \
     include/Armorial/Math/Matrix/Matrix.h \
+    include/Armorial/Math/Matrix/impl/gemm_impl.h \
+    include/Armorial/Math/MatrixExpression/MatrixExpression.h \
+    include/Armorial/Math/MatrixSlice/MatrixSlice.h \
+    include/Armorial/Math/MatrixView/MatrixView.h \
+    include/Armorial/Math/PolynomialFit/PolynomialFit.h \
+    include/Armorial/Math/QR/QR.h \
+    include/Armorial/Math/SVD/SVD.h \
+    include/Armorial/Planning/PathPlanner/PathPlanner.h \
+    include/Armorial/Planning/Planning.h \
+    include/Armorial/Planning/TeamPlanner/TeamPlanner.h \
     include/Armorial/Threaded/Entity/Entity.h \
     include/Armorial/Geometry/Geometry.h \
     include/Armorial/Threaded/EntityManager/EntityManager.h \
     include/Armorial/Threaded/Threaded.h \
+    include/Armorial/Tracking/KalmanFilter/KalmanFilter.h \
+    include/Armorial/Tracking/Track/Track.h \
+    include/Armorial/Tracking/Tracker/Tracker.h \
+    include/Armorial/Tracking/Tracking.h \
     include/Armorial/Common/Types/Field/Field.h \
+    include/Armorial/Common/Types/FieldGeometry/FieldGeometry.h \
+    include/Armorial/Common/Types/FieldRegionGrid/FieldRegionGrid.h \
     include/Armorial/Common/Types/Traits/Traits.h \
     include/Armorial/Common/Types/Types.h \
+    include/Armorial/Common/Types/WorldSnapshot/WorldSnapshot.h \
     include/Armorial/Utils/ExitHandler/ExitHandler.h \
     include/Armorial/Utils/ParameterHandler/Parameter.h \
     include/Armorial/Utils/ParameterHandler/ParameterHandler.h \
+    include/Armorial/Utils/StaticVector/StaticVector.h \
     include/Armorial/Utils/Timer/Timer.h \
     include/Armorial/Utils/Utils.h
 
@@ -72,27 +109,49 @@ SOURCES     += \
     src/Armorial/Base/Service/Service.cpp \
     src/Armorial/Common/Enums/Color/Color.cpp \
     src/Armorial/Common/Enums/Quadrant/Quadrant.cpp \
+    src/Armorial/Common/Enums/Region/Region.cpp \
     src/Armorial/Common/Enums/Side/Side.cpp \
     src/Armorial/Common/Packet/Packet.cpp \
     src/Armorial/Common/Types/Object/Object.cpp \
     src/Armorial/Common/Widgets/RobotFrame/robotframe.cpp \
     src/Armorial/Common/Widgets/FieldView/FieldView.cpp \
     src/Armorial/Common/Widgets/GLText/GLText.cpp \
-    src/Armorial/Geometry/Angle/Angle.cpp \
+    src/Armorial/Geometry/AngularSweep/AngularSweep.cpp \
     src/Armorial/Geometry/Arc/Arc.cpp \
+    src/Armorial/Geometry/Batch/Batch.cpp \
     src/Armorial/Geometry/Circle/Circle.cpp \
+    src/Armorial/Geometry/CircleSet/CircleSet.cpp \
+    src/Armorial/Geometry/KDTree/KDTree.cpp \
     src/Armorial/Geometry/Line/Line.cpp \
     src/Armorial/Geometry/LineSegment/LineSegment.cpp \
     src/Armorial/Geometry/Polygon/Polygon.cpp \
+    src/Armorial/Geometry/PreparedPolygon/PreparedPolygon.cpp \
     src/Armorial/Geometry/Rectangle/Rectangle.cpp \
+    src/Armorial/Geometry/Rotation2D/Rotation2D.cpp \
+    src/Armorial/Geometry/SweepAndPrune/SweepAndPrune.cpp \
+    src/Armorial/Geometry/SweptCircle/SweptCircle.cpp \
+    src/Armorial/Geometry/Transform2D/Transform2D.cpp \
     src/Armorial/Geometry/Triangle/Triangle.cpp \
     src/Armorial/Geometry/Vector2D/Vector2D.cpp \
+    src/Armorial/Math/Cholesky/Cholesky.cpp \
+    src/Armorial/Math/LU/LU.cpp \
     src/Armorial/Math/Matrix/Matrix.cpp \
+    src/Armorial/Math/Matrix/impl/gemm_impl.cpp \
+    src/Armorial/Math/PolynomialFit/PolynomialFit.cpp \
+    src/Armorial/Math/QR/QR.cpp \
+    src/Armorial/Math/SVD/SVD.cpp \
+    src/Armorial/Planning/PathPlanner/PathPlanner.cpp \
+    src/Armorial/Planning/TeamPlanner/TeamPlanner.cpp \
     src/Armorial/Threaded/Entity/Entity.cpp \
     src/Armorial/Geometry/Geometry.cpp \
     src/Armorial/Threaded/EntityManager/EntityManager.cpp \
+    src/Armorial/Tracking/Track/Track.cpp \
+    src/Armorial/Tracking/Tracker/Tracker.cpp \
     src/Armorial/Common/Types/Field/Field.cpp \
+    src/Armorial/Common/Types/FieldGeometry/FieldGeometry.cpp \
+    src/Armorial/Common/Types/FieldRegionGrid/FieldRegionGrid.cpp \
     src/Armorial/Common/Types/Traits/Traits.cpp \
+    src/Armorial/Common/Types/WorldSnapshot/WorldSnapshot.cpp \
     src/Armorial/Utils/ExitHandler/ExitHandler.cpp \
     src/Armorial/Utils/ParameterHandler/ParameterHandler.cpp \
     src/Armorial/Utils/Timer/Timer.cpp
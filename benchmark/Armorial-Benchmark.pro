@@ -0,0 +1,38 @@
+TEMPLATE = app
+DESTDIR  = ../bin
+TARGET   = Armorial-Benchmark
+VERSION  = 1.0.0
+
+# Temporary dirs
+OBJECTS_DIR = tmp/obj
+MOC_DIR = tmp/moc
+UI_DIR = tmp/moc
+RCC_DIR = tmp/rc
+
+CONFIG += c++17 console release
+CONFIG -= app_bundle
+QT += core network
+
+DEFINES += QT_DEPRECATED_WARNINGS
+LIBS += -lfmt -lArmorial -lbenchmark -lpthread
+
+QMAKE_CXXFLAGS_RELEASE = -O2
+QMAKE_CXXFLAGS += -ffp-contract=off
+
+SOURCES += \
+    main.cpp \
+    src/Algorithms/Assignment.cpp \
+    src/Common/FieldGeometry.cpp \
+    src/Geometry/AngularSweep.cpp \
+    src/Geometry/Batch.cpp \
+    src/Geometry/CircleSet.cpp \
+    src/Geometry/KDTree.cpp \
+    src/Geometry/Polygon.cpp \
+    src/Geometry/PreparedPolygon.cpp \
+    src/Geometry/SweptCircle.cpp \
+    src/Math/FixedMatrix.cpp \
+    src/Math/LeastSquares.cpp \
+    src/Math/Matrix.cpp \
+    src/Planning/PathPlanner.cpp \
+    src/Tracking/Tracker.cpp \
+    src/Utils/Angles.cpp
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Algorithms/Auction/impl/auction_impl.h>
+#include <Armorial/Algorithms/Hungarian/impl/fixed_hungarian_impl.h>
+#include <Armorial/Algorithms/Hungarian/impl/hungarian_impl.h>
+
+#include <random>
+
+namespace {
+    std::vector<std::vector<float>> randomCosts(int n, int m) {
+        std::mt19937 generator(n * 1000 + m);
+        std::uniform_real_distribution<float> distribution(0.0f, 10.0f);
+        std::vector<std::vector<float>> costs(n, std::vector<float>(m));
+        for (auto &line : costs) {
+            for (auto &cost : line) {
+                cost = distribution(generator);
+            }
+        }
+
+        return costs;
+    }
+
+    // Formation search (robots x sampled candidates) and larger square problems
+    const std::vector<std::pair<long, long>> assignmentSizes = {{6, 6}, {11, 11}, {11, 50}, {11, 200},
+                                                                {100, 200}, {200, 200}, {500, 500}};
+}
+
+static void BM_Hungarian(benchmark::State &state) {
+    const int n = state.range(0);
+    const int m = state.range(1);
+    const std::vector<std::vector<float>> costs = randomCosts(n, m);
+
+    for (auto _ : state) {
+        tourist::hungarian<float> hungarian(n, m);
+        hungarian.a = costs;
+        benchmark::DoNotOptimize(hungarian.solve());
+    }
+}
+BENCHMARK(BM_Hungarian)->Apply([](benchmark::internal::Benchmark *benchmark) {
+    for (auto sizes : assignmentSizes) {
+        benchmark->Args({sizes.first, sizes.second});
+    }
+});
+
+static void BM_Auction(benchmark::State &state) {
+    const int n = state.range(0);
+    const int m = state.range(1);
+    const unsigned threads = state.range(2);
+    const std::vector<std::vector<float>> costs = randomCosts(n, m);
+
+    for (auto _ : state) {
+        Algorithms::impl::auction<float> auction(n, m, threads);
+        auction.a = costs;
+        benchmark::DoNotOptimize(auction.solve());
+    }
+}
+BENCHMARK(BM_Auction)->Apply([](benchmark::internal::Benchmark *benchmark) {
+    for (long threads : {1L, 4L}) {
+        for (auto sizes : assignmentSizes) {
+            benchmark->Args({sizes.first, sizes.second, threads});
+        }
+    }
+})->UseRealTime();
+
+template <int N, int M>
+static void BM_FixedHungarian(benchmark::State &state) {
+    const std::vector<std::vector<float>> costs = randomCosts(N, M);
+
+    for (auto _ : state) {
+        tourist::fixed_hungarian<float, N, M> hungarian;
+        for (int i = 0; i < N; i++) {
+            std::copy(costs[i].begin(), costs[i].end(), hungarian.a[i].begin());
+        }
+        benchmark::DoNotOptimize(hungarian.solve());
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedHungarian, 3, 6);
+BENCHMARK_TEMPLATE(BM_FixedHungarian, 6, 6);
+BENCHMARK_TEMPLATE(BM_FixedHungarian, 11, 11);
+BENCHMARK_TEMPLATE(BM_FixedHungarian, 11, 50);
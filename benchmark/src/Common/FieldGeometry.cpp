@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Common/Types/Field/Field.h>
+#include <Armorial/Common/Types/FieldGeometry/FieldGeometry.h>
+#include <Armorial/Common/Types/FieldRegionGrid/FieldRegionGrid.h>
+
+#include <random>
+
+namespace {
+    Common::Types::Field makeField() {
+        return Common::Types::Field(Common::Enums::SIDE_RIGHT, 500.0f, 9000.0f, 6000.0f, 180.0f,
+                                    1000.0f, 1000.0f, 2000.0f, 6000.0f);
+    }
+
+    std::vector<Geometry::Vector2D> randomPositions(size_t count) {
+        std::mt19937 generator(1);
+        std::uniform_real_distribution<float> x(-5000.0f, 5000.0f), y(-3500.0f, 3500.0f);
+        std::vector<Geometry::Vector2D> positions;
+        for(size_t i = 0; i < count; i++) {
+            positions.emplace_back(x(generator), y(generator));
+        }
+
+        return positions;
+    }
+}
+
+static void BM_FieldIsInsideOurPenaltyArea(benchmark::State &state) {
+    Common::Types::Field field = makeField();
+    const std::vector<Geometry::Vector2D> positions = randomPositions(1024);
+
+    for (auto _ : state) {
+        int inside = 0;
+        for(const Geometry::Vector2D &position : positions) {
+            inside += field.isInsideOurPenaltyArea(position);
+        }
+        benchmark::DoNotOptimize(inside);
+    }
+}
+BENCHMARK(BM_FieldIsInsideOurPenaltyArea);
+
+static void BM_FieldGeometryIsInsideOurPenaltyArea(benchmark::State &state) {
+    const Common::Types::FieldGeometry geometry(makeField());
+    const std::vector<Geometry::Vector2D> positions = randomPositions(1024);
+
+    for (auto _ : state) {
+        int inside = 0;
+        for(const Geometry::Vector2D &position : positions) {
+            inside += geometry.isInsideOurPenaltyArea(position);
+        }
+        benchmark::DoNotOptimize(inside);
+    }
+}
+BENCHMARK(BM_FieldGeometryIsInsideOurPenaltyArea);
+
+static void BM_FieldRegionGridClassify(benchmark::State &state) {
+    const Common::Types::FieldRegionGrid grid(makeField(), state.range(0), 1000.0f);
+    const std::vector<Geometry::Vector2D> positions = randomPositions(1024);
+    std::vector<Common::Enums::RegionMask> regions(positions.size());
+
+    for (auto _ : state) {
+        grid.classify(positions.data(), regions.data(), positions.size());
+        benchmark::DoNotOptimize(regions.data());
+    }
+}
+BENCHMARK(BM_FieldRegionGridClassify)->Arg(50)->Arg(200);
+
+static void BM_FieldRegionGridClassifyExact(benchmark::State &state) {
+    const Common::Types::FieldRegionGrid grid(makeField(), 100.0f, 1000.0f);
+    const std::vector<Geometry::Vector2D> positions = randomPositions(1024);
+    std::vector<Common::Enums::RegionMask> regions(positions.size());
+
+    for (auto _ : state) {
+        for(size_t i = 0; i < positions.size(); i++) {
+            regions[i] = grid.classifyExact(positions[i]);
+        }
+        benchmark::DoNotOptimize(regions.data());
+    }
+}
+BENCHMARK(BM_FieldRegionGridClassifyExact);
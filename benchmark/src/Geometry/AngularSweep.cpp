@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Geometry/AngularSweep/AngularSweep.h>
+
+#include <random>
+
+namespace {
+    const Geometry::LineSegment goal(Geometry::Vector2D(4.5f, 0.5f), Geometry::Vector2D(4.5f, -0.5f));
+
+    std::vector<Geometry::Vector2D> randomPoints(size_t count, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> x(-4.5f, 4.0f), y(-3.0f, 3.0f);
+        std::vector<Geometry::Vector2D> points;
+        for(size_t i = 0; i < count; i++) {
+            points.emplace_back(x(generator), y(generator));
+        }
+
+        return points;
+    }
+}
+
+// Open goal angle of 200 candidate shooter positions, with 16 robots
+static void BM_AngularSweepOpenGoal(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> shooters = randomPoints(200, 1);
+    std::vector<Geometry::Circle> robots;
+    for(const Geometry::Vector2D &position : randomPoints(16, 2)) {
+        robots.emplace_back(position, 0.09f);
+    }
+    Geometry::AngularSweep sweep;
+
+    for (auto _ : state) {
+        float width = 0.0f;
+        for(const Geometry::Vector2D &shooter : shooters) {
+            sweep.compute(shooter, goal, robots);
+            width += sweep.freeWidth();
+        }
+        benchmark::DoNotOptimize(width);
+    }
+}
+BENCHMARK(BM_AngularSweepOpenGoal);
+
+// The sampling approximation it replaces, with 32 rays per shooter
+static void BM_SampledOpenGoal(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> shooters = randomPoints(200, 1);
+    std::vector<Geometry::Circle> robots;
+    for(const Geometry::Vector2D &position : randomPoints(16, 2)) {
+        robots.emplace_back(position, 0.09f);
+    }
+
+    for (auto _ : state) {
+        int free = 0;
+        for(const Geometry::Vector2D &shooter : shooters) {
+            for(int sample = 0; sample < 32; sample++) {
+                const Geometry::LineSegment ray(shooter, goal.start() + (goal.end() - goal.start()) * (sample / 31.0f));
+                bool blocked = false;
+                for(const Geometry::Circle &robot : robots) {
+                    blocked = blocked || robot.doesIntersect(ray);
+                }
+                free += !blocked;
+            }
+        }
+        benchmark::DoNotOptimize(free);
+    }
+}
+BENCHMARK(BM_SampledOpenGoal);
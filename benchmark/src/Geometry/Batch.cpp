@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Geometry/Batch/Batch.h>
+
+#include <random>
+
+namespace {
+    std::vector<Geometry::Vector2D> randomVectors(size_t count) {
+        std::mt19937 generator(1);
+        std::uniform_real_distribution<float> distribution(-4.5f, 4.5f);
+        std::vector<Geometry::Vector2D> vectors;
+        for(size_t i = 0; i < count; i++) {
+            vectors.emplace_back(distribution(generator), distribution(generator));
+        }
+
+        return vectors;
+    }
+}
+
+// Distances from a robot to the candidate points sampled around it, one Vector2D call each
+static void BM_DistancesVector2D(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> candidates = randomVectors(state.range(0));
+    const Geometry::Vector2D robot(0.5f, -1.0f);
+    std::vector<float> distances(candidates.size());
+
+    for (auto _ : state) {
+        for(size_t i = 0; i < candidates.size(); i++) {
+            distances[i] = candidates[i].dist(robot);
+        }
+        benchmark::DoNotOptimize(distances.data());
+    }
+}
+BENCHMARK(BM_DistancesVector2D)->Arg(200)->Arg(4096);
+
+// Same distances through the batch kernels (0: scalar, 1: SSE, 2: AVX2)
+static void BM_BatchDist(benchmark::State &state) {
+    const auto kernel = Geometry::Batch::Kernel(state.range(1));
+    if(!Geometry::Batch::isKernelSupported(kernel)) {
+        state.SkipWithError("Kernel not supported by this CPU");
+        return;
+    }
+
+    const std::vector<Geometry::Vector2D> candidates = randomVectors(state.range(0));
+    const Geometry::Vector2D robot(0.5f, -1.0f);
+    std::vector<float> distances(candidates.size());
+
+    for (auto _ : state) {
+        Geometry::Batch::dist(candidates.data(), robot, distances.data(), candidates.size(), kernel);
+        benchmark::DoNotOptimize(distances.data());
+    }
+}
+BENCHMARK(BM_BatchDist)->ArgsProduct({{200, 4096}, {0, 1, 2}});
+
+static void BM_RotateVector2D(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> points = randomVectors(state.range(0));
+    std::vector<Geometry::Vector2D> rotated(points.size());
+
+    for (auto _ : state) {
+        for(size_t i = 0; i < points.size(); i++) {
+            rotated[i] = points[i].rotate(0.3f);
+        }
+        benchmark::DoNotOptimize(rotated.data());
+    }
+}
+BENCHMARK(BM_RotateVector2D)->Arg(200)->Arg(4096);
+
+static void BM_BatchRotate(benchmark::State &state) {
+    const auto kernel = Geometry::Batch::Kernel(state.range(1));
+    if(!Geometry::Batch::isKernelSupported(kernel)) {
+        state.SkipWithError("Kernel not supported by this CPU");
+        return;
+    }
+
+    const std::vector<Geometry::Vector2D> points = randomVectors(state.range(0));
+    std::vector<Geometry::Vector2D> rotated(points.size());
+
+    for (auto _ : state) {
+        Geometry::Batch::rotate(points.data(), 0.3f, rotated.data(), points.size(), kernel);
+        benchmark::DoNotOptimize(rotated.data());
+    }
+}
+BENCHMARK(BM_BatchRotate)->ArgsProduct({{200, 4096}, {0, 1, 2}});
+
+static void BM_NormalizeVector2D(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> points = randomVectors(state.range(0));
+    std::vector<Geometry::Vector2D> normalized(points.size());
+
+    for (auto _ : state) {
+        for(size_t i = 0; i < points.size(); i++) {
+            normalized[i] = points[i].normalize();
+        }
+        benchmark::DoNotOptimize(normalized.data());
+    }
+}
+BENCHMARK(BM_NormalizeVector2D)->Arg(200)->Arg(4096);
+
+static void BM_BatchNormalize(benchmark::State &state) {
+    const auto kernel = Geometry::Batch::Kernel(state.range(1));
+    if(!Geometry::Batch::isKernelSupported(kernel)) {
+        state.SkipWithError("Kernel not supported by this CPU");
+        return;
+    }
+
+    const std::vector<Geometry::Vector2D> points = randomVectors(state.range(0));
+    std::vector<Geometry::Vector2D> normalized(points.size());
+
+    for (auto _ : state) {
+        Geometry::Batch::normalize(points.data(), normalized.data(), points.size(), kernel);
+        benchmark::DoNotOptimize(normalized.data());
+    }
+}
+BENCHMARK(BM_BatchNormalize)->ArgsProduct({{200, 4096}, {0, 1, 2}});
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Geometry/CircleSet/CircleSet.h>
+
+#include <random>
+
+namespace {
+    struct Scenario {
+        std::vector<Geometry::Circle> robots;
+        std::vector<Geometry::LineSegment> passes;
+    };
+
+    // 16 robots and 200 candidate passes, as evaluated in a frame
+    Scenario makeScenario() {
+        std::mt19937 generator(1);
+        std::uniform_real_distribution<float> x(-4.5f, 4.5f), y(-3.0f, 3.0f);
+        Scenario scenario;
+        for(int i = 0; i < 16; i++) {
+            scenario.robots.emplace_back(Geometry::Vector2D(x(generator), y(generator)), 0.09f);
+        }
+        for(int i = 0; i < 200; i++) {
+            scenario.passes.emplace_back(Geometry::Vector2D(x(generator), y(generator)),
+                                         Geometry::Vector2D(x(generator), y(generator)));
+        }
+
+        return scenario;
+    }
+}
+
+static void BM_CircleDoesIntersect(benchmark::State &state) {
+    const Scenario scenario = makeScenario();
+
+    for (auto _ : state) {
+        int blocked = 0;
+        for(const Geometry::LineSegment &pass : scenario.passes) {
+            for(const Geometry::Circle &robot : scenario.robots) {
+                if(robot.doesIntersect(pass)) {
+                    blocked++;
+                    break;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(blocked);
+    }
+}
+BENCHMARK(BM_CircleDoesIntersect);
+
+static void BM_CircleSetObstructions(benchmark::State &state) {
+    const Scenario scenario = makeScenario();
+    const Geometry::CircleSet set(scenario.robots);
+    const Geometry::Batch::Kernel kernel = static_cast<Geometry::Batch::Kernel>(state.range(0));
+    std::vector<Geometry::CircleSet::Obstruction> obstructions(scenario.passes.size());
+    if(!Geometry::Batch::isKernelSupported(kernel)) {
+        state.SkipWithError("Kernel not supported by this CPU");
+    }
+
+    for (auto _ : state) {
+        set.obstructions(scenario.passes.data(), obstructions.data(), scenario.passes.size(), kernel);
+        benchmark::DoNotOptimize(obstructions.data());
+    }
+}
+BENCHMARK(BM_CircleSetObstructions)->Arg(0)->Arg(1)->Arg(2);
@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Geometry/KDTree/KDTree.h>
+
+#include <random>
+
+namespace {
+    std::vector<Geometry::Vector2D> randomPoints(size_t count, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> x(-4.5f, 4.5f), y(-3.0f, 3.0f);
+        std::vector<Geometry::Vector2D> points;
+        for(size_t i = 0; i < count; i++) {
+            points.emplace_back(x(generator), y(generator));
+        }
+
+        return points;
+    }
+
+    float squaredDistance(const Geometry::Vector2D &a, const Geometry::Vector2D &b) {
+        return (a.x() - b.x()) * (a.x() - b.x()) + (a.y() - b.y()) * (a.y() - b.y());
+    }
+}
+
+// Rebuilding the index over the points of a frame
+static void BM_KDTreeBuild(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> points = randomPoints(state.range(0), 1);
+    Geometry::KDTree tree;
+
+    for (auto _ : state) {
+        tree.build(points);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_KDTreeBuild)->Arg(16)->Arg(32)->Arg(200);
+
+// 64 nearest point queries
+static void BM_KDTreeNearest(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> points = randomPoints(state.range(0), 1);
+    const std::vector<Geometry::Vector2D> queries = randomPoints(64, 2);
+    const Geometry::KDTree tree(points);
+
+    for (auto _ : state) {
+        size_t sum = 0;
+        for(const Geometry::Vector2D &query : queries) {
+            sum += *tree.nearest(query);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_KDTreeNearest)->Arg(16)->Arg(32)->Arg(200);
+
+static void BM_BruteForceNearest(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> points = randomPoints(state.range(0), 1);
+    const std::vector<Geometry::Vector2D> queries = randomPoints(64, 2);
+
+    for (auto _ : state) {
+        size_t sum = 0;
+        for(const Geometry::Vector2D &query : queries) {
+            size_t best = 0;
+            float bestDistance = squaredDistance(points[0], query);
+            for(size_t i = 1; i < points.size(); i++) {
+                const float distance = squaredDistance(points[i], query);
+                if(distance < bestDistance) {
+                    best = i;
+                    bestDistance = distance;
+                }
+            }
+            sum += best;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_BruteForceNearest)->Arg(16)->Arg(32)->Arg(200);
+
+// 64 queries for the points within a robot-sized radius
+static void BM_KDTreeWithinRadius(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> points = randomPoints(state.range(0), 1);
+    const std::vector<Geometry::Vector2D> queries = randomPoints(64, 2);
+    const Geometry::KDTree tree(points);
+
+    for (auto _ : state) {
+        size_t sum = 0;
+        for(const Geometry::Vector2D &query : queries) {
+            sum += tree.withinRadius(query, 0.5f).size();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_KDTreeWithinRadius)->Arg(16)->Arg(32)->Arg(200);
+
+static void BM_BruteForceWithinRadius(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> points = randomPoints(state.range(0), 1);
+    const std::vector<Geometry::Vector2D> queries = randomPoints(64, 2);
+
+    for (auto _ : state) {
+        size_t sum = 0;
+        for(const Geometry::Vector2D &query : queries) {
+            std::vector<size_t> found;
+            for(size_t i = 0; i < points.size(); i++) {
+                if(squaredDistance(points[i], query) <= 0.25f) {
+                    found.push_back(i);
+                }
+            }
+            sum += found.size();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_BruteForceWithinRadius)->Arg(16)->Arg(32)->Arg(200);
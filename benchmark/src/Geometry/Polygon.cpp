@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Geometry/Polygon/Polygon.h>
+
+#include <cmath>
+#include <random>
+
+namespace {
+    std::vector<Geometry::Vector2D> randomPoints(size_t count, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> x(-4.5f, 4.5f), y(-3.0f, 3.0f);
+        std::vector<Geometry::Vector2D> points;
+        for(size_t i = 0; i < count; i++) {
+            points.emplace_back(x(generator), y(generator));
+        }
+
+        return points;
+    }
+
+    // Hexagonal obstacles spread over the field
+    std::vector<Geometry::Polygon> obstacles(size_t count) {
+        std::vector<Geometry::Polygon> result;
+        for(const Geometry::Vector2D &center : randomPoints(count, 1)) {
+            std::vector<Geometry::Vector2D> vertices;
+            for(size_t i = 0; i < 6; i++) {
+                const float angle = Geometry::Angle::PI * i / 3.0f;
+                vertices.emplace_back(center.x() + 0.09f * cosf(angle), center.y() + 0.09f * sinf(angle));
+            }
+            result.emplace_back(vertices);
+        }
+
+        return result;
+    }
+}
+
+// Inflating 32 obstacles by the robot radius
+static void BM_PolygonOffset(benchmark::State &state) {
+    const std::vector<Geometry::Polygon> shapes = obstacles(32);
+
+    for (auto _ : state) {
+        size_t vertices = 0;
+        for(const Geometry::Polygon &shape : shapes) {
+            vertices += shape.offset(0.09f, state.range(0)).amountOfVertices();
+        }
+        benchmark::DoNotOptimize(vertices);
+    }
+}
+BENCHMARK(BM_PolygonOffset)->Arg(8)->Arg(16)->Arg(32);
+
+// The same inflation by sampling a circle around each vertex and taking the hull
+static void BM_SampledCircleInflation(benchmark::State &state) {
+    const std::vector<Geometry::Polygon> shapes = obstacles(32);
+
+    for (auto _ : state) {
+        size_t vertices = 0;
+        for(const Geometry::Polygon &shape : shapes) {
+            std::vector<Geometry::Vector2D> samples;
+            for(const Geometry::Vector2D &vertex : shape.vertices()) {
+                for(int64_t i = 0; i < state.range(0); i++) {
+                    const float angle = 2.0f * Geometry::Angle::PI * i / state.range(0);
+                    samples.emplace_back(vertex.x() + 0.09f * cosf(angle), vertex.y() + 0.09f * sinf(angle));
+                }
+            }
+            vertices += Geometry::Polygon::convexHull(samples).amountOfVertices();
+        }
+        benchmark::DoNotOptimize(vertices);
+    }
+}
+BENCHMARK(BM_SampledCircleInflation)->Arg(8)->Arg(16)->Arg(32);
+
+static void BM_PolygonConvexHull(benchmark::State &state) {
+    const std::vector<Geometry::Vector2D> points = randomPoints(state.range(0), 2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Geometry::Polygon::convexHull(points).amountOfVertices());
+    }
+}
+BENCHMARK(BM_PolygonConvexHull)->Arg(32)->Arg(200);
+
+// Clipping 32 inflated obstacles by a field half
+static void BM_PolygonClip(benchmark::State &state) {
+    std::vector<Geometry::Polygon> shapes;
+    for(const Geometry::Polygon &shape : obstacles(32)) {
+        shapes.push_back(shape.offset(0.09f));
+    }
+    const Geometry::Polygon half({Geometry::Vector2D(-4.5f, -3.0f), Geometry::Vector2D(0.0f, -3.0f),
+                                  Geometry::Vector2D(0.0f, 3.0f), Geometry::Vector2D(-4.5f, 3.0f)});
+
+    for (auto _ : state) {
+        size_t vertices = 0;
+        for(const Geometry::Polygon &shape : shapes) {
+            vertices += shape.clip(half).amountOfVertices();
+        }
+        benchmark::DoNotOptimize(vertices);
+    }
+}
+BENCHMARK(BM_PolygonClip);
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Geometry/PreparedPolygon/PreparedPolygon.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace {
+    std::vector<Geometry::Vector2D> randomPoints(size_t count, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> x(-4.5f, 4.5f), y(-3.0f, 3.0f);
+        std::vector<Geometry::Vector2D> points;
+        for(size_t i = 0; i < count; i++) {
+            points.emplace_back(x(generator), y(generator));
+        }
+
+        return points;
+    }
+
+    // Regular polygon, or a star when concave (alternating radii)
+    Geometry::Polygon polygon(size_t sides, bool concave) {
+        std::vector<Geometry::Vector2D> vertices;
+        for(size_t i = 0; i < sides; i++) {
+            const float angle = 2.0f * static_cast<float>(M_PI) * i / sides;
+            const float radius = (concave && i % 2 == 1) ? 1.0f : 2.0f;
+            vertices.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+        }
+
+        return Geometry::Polygon(vertices);
+    }
+}
+
+// 256 containment queries against a convex (0) or concave (1) polygon
+static void BM_PolygonContains(benchmark::State &state) {
+    const Geometry::Polygon shape = polygon(state.range(0), state.range(1));
+    const std::vector<Geometry::Vector2D> points = randomPoints(256, 1);
+
+    for (auto _ : state) {
+        size_t inside = 0;
+        for(const Geometry::Vector2D &point : points) {
+            inside += shape.contains(point);
+        }
+        benchmark::DoNotOptimize(inside);
+    }
+}
+BENCHMARK(BM_PolygonContains)->ArgsProduct({{8, 32}, {0, 1}});
+
+static void BM_PreparedPolygonContains(benchmark::State &state) {
+    const Geometry::PreparedPolygon shape(polygon(state.range(0), state.range(1)));
+    const std::vector<Geometry::Vector2D> points = randomPoints(256, 1);
+    std::unique_ptr<bool[]> inside(new bool[points.size()]);
+
+    for (auto _ : state) {
+        shape.contains(points.data(), inside.get(), points.size());
+        benchmark::DoNotOptimize(inside.get());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_PreparedPolygonContains)->ArgsProduct({{8, 32}, {0, 1}});
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Geometry/SweepAndPrune/SweepAndPrune.h>
+
+#include <random>
+
+namespace {
+    std::vector<Geometry::SweptCircle> randomRobots(size_t count, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> x(-4.5f, 4.5f), y(-3.0f, 3.0f), speed(-4.0f, 4.0f);
+        std::vector<Geometry::SweptCircle> robots;
+        for(size_t i = 0; i < count; i++) {
+            robots.emplace_back(Geometry::Circle(Geometry::Vector2D(x(generator), y(generator)), 0.09f),
+                                Geometry::Vector2D(speed(generator), speed(generator)));
+        }
+
+        return robots;
+    }
+}
+
+// Collisions of all the robots within a frame (1/60 s)
+static void BM_SweepAndPrune(benchmark::State &state) {
+    const std::vector<Geometry::SweptCircle> robots = randomRobots(state.range(0), 1);
+    Geometry::SweepAndPrune sweep;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sweep.update(robots, 1.0f / 60.0f).size());
+    }
+}
+BENCHMARK(BM_SweepAndPrune)->Arg(22)->Arg(200);
+
+static void BM_AllPairsCollisionTime(benchmark::State &state) {
+    const std::vector<Geometry::SweptCircle> robots = randomRobots(state.range(0), 1);
+
+    for (auto _ : state) {
+        size_t collisions = 0;
+        for(size_t i = 0; i < robots.size(); i++) {
+            for(size_t j = i + 1; j < robots.size(); j++) {
+                collisions += robots[i].collisionTime(robots[j], 1.0f / 60.0f).has_value();
+            }
+        }
+        benchmark::DoNotOptimize(collisions);
+    }
+}
+BENCHMARK(BM_AllPairsCollisionTime)->Arg(22)->Arg(200);
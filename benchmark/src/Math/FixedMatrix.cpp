@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Math/FixedMatrix/FixedMatrix.h>
+
+#include <random>
+
+namespace {
+    template <unsigned N>
+    Math::FixedMatrix<N, N> randomFixedMatrix(unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        Math::FixedMatrix<N, N> matrix;
+        for(unsigned i = 0; i < N; i++) {
+            for(unsigned j = 0; j < N; j++) {
+                matrix(i, j) = distribution(generator);
+            }
+        }
+
+        return matrix;
+    }
+}
+
+// Same expression as BM_MatrixChain
+template <unsigned N>
+static void BM_FixedMatrixChain(benchmark::State &state) {
+    Math::FixedMatrix<N, N> A = randomFixedMatrix<N>(1);
+    const Math::FixedMatrix<N, N> B = randomFixedMatrix<N>(2);
+    const Math::FixedMatrix<N, N> C = randomFixedMatrix<N>(3);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(A);
+        Math::FixedMatrix<N, N> result = A * B + C;
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedMatrixChain, 4);
+BENCHMARK_TEMPLATE(BM_FixedMatrixChain, 6);
+
+template <unsigned N>
+static void BM_FixedMatrixInverse(benchmark::State &state) {
+    Math::FixedMatrix<N, N> A = randomFixedMatrix<N>(1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(A);
+        benchmark::DoNotOptimize(A.inverse());
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedMatrixInverse, 2);
+BENCHMARK_TEMPLATE(BM_FixedMatrixInverse, 3);
+BENCHMARK_TEMPLATE(BM_FixedMatrixInverse, 4);
+BENCHMARK_TEMPLATE(BM_FixedMatrixInverse, 6);
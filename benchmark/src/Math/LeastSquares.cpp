@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Math/LU/LU.h>
+#include <Armorial/Math/PolynomialFit/PolynomialFit.h>
+#include <Armorial/Math/QR/QR.h>
+#include <Armorial/Math/SVD/SVD.h>
+
+#include <random>
+
+namespace {
+    Math::Matrix randomMatrix(unsigned lines, unsigned columns, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        Math::Matrix matrix(lines, columns);
+        for(unsigned i = 0; i < lines; i++) {
+            for(unsigned j = 0; j < columns; j++) {
+                matrix.set(i, j, distribution(generator));
+            }
+        }
+
+        return matrix;
+    }
+
+    std::vector<float> timestamps(unsigned samples) {
+        std::vector<float> t(samples);
+        for(unsigned i = 0; i < samples; i++) {
+            t[i] = 100.0f + i / 60.0f;
+        }
+
+        return t;
+    }
+}
+
+// Quadratic fit of the x and y coordinates of a trajectory, factorizing the positions once
+static void BM_PolynomialFit(benchmark::State &state) {
+    const unsigned samples = state.range(0);
+    const std::vector<float> t = timestamps(samples);
+    const Math::Matrix Y = randomMatrix(samples, 2, 1);
+
+    for (auto _ : state) {
+        Math::PolynomialFit fit(t, 2);
+        std::optional<std::vector<Math::PolynomialFit::Polynomial>> polynomials = fit.fit(Y);
+        benchmark::DoNotOptimize(polynomials);
+    }
+}
+BENCHMARK(BM_PolynomialFit)->Arg(100)->Arg(1000)->Arg(5000);
+
+// Same fit through the normal equations (V^T V) c = V^T y, solved by LU
+static void BM_PolynomialFitNormalEquations(benchmark::State &state) {
+    const unsigned samples = state.range(0);
+    const std::vector<float> t = timestamps(samples);
+    const Math::Matrix Y = randomMatrix(samples, 2, 1);
+
+    for (auto _ : state) {
+        Math::Matrix V(samples, 3);
+        for(unsigned i = 0; i < samples; i++) {
+            V.set(i, 0, 1.0f);
+            V.set(i, 1, t[i]);
+            V.set(i, 2, t[i] * t[i]);
+        }
+        Math::Matrix normal = V.transposed() * V;
+        Math::Matrix rhs = V.transposed() * Y;
+        std::optional<Math::Matrix> coefficients = Math::LU(normal).solve(rhs);
+        benchmark::DoNotOptimize(coefficients);
+    }
+}
+BENCHMARK(BM_PolynomialFitNormalEquations)->Arg(100)->Arg(1000)->Arg(5000);
+
+// Camera calibration sized systems (e.g. homography estimation from point correspondences)
+static void BM_QRSolve(benchmark::State &state) {
+    const unsigned lines = state.range(0);
+    const Math::Matrix A = randomMatrix(lines, 8, 1);
+    const Math::Matrix b = randomMatrix(lines, 1, 2);
+
+    for (auto _ : state) {
+        std::optional<Math::Matrix> x = Math::QR(A).solve(b);
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_QRSolve)->Arg(16)->Arg(64)->Arg(256);
+
+static void BM_SVDSolve(benchmark::State &state) {
+    const unsigned lines = state.range(0);
+    const Math::Matrix A = randomMatrix(lines, 8, 1);
+    const Math::Matrix b = randomMatrix(lines, 1, 2);
+
+    for (auto _ : state) {
+        Math::Matrix x = Math::SVD(A).solve(b);
+        benchmark::DoNotOptimize(x.data());
+    }
+}
+BENCHMARK(BM_SVDSolve)->Arg(16)->Arg(64)->Arg(256);
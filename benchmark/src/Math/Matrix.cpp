@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Math/Matrix/Matrix.h>
+#include <Armorial/Math/Matrix/impl/gemm_impl.h>
+
+#include <random>
+
+namespace {
+    Math::Matrix randomMatrix(unsigned lines, unsigned columns, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        Math::Matrix matrix(lines, columns);
+        for(unsigned i = 0; i < lines; i++) {
+            for(unsigned j = 0; j < columns; j++) {
+                matrix.set(i, j, distribution(generator));
+            }
+        }
+
+        return matrix;
+    }
+}
+
+// Filter-like expression A * B + C, allocating its result
+static void BM_MatrixChain(benchmark::State &state) {
+    const unsigned size = state.range(0);
+    const Math::Matrix A = randomMatrix(size, size, 1);
+    const Math::Matrix B = randomMatrix(size, size, 2);
+    const Math::Matrix C = randomMatrix(size, size, 3);
+
+    for (auto _ : state) {
+        Math::Matrix result = A * B + C;
+        benchmark::DoNotOptimize(result.data());
+    }
+}
+BENCHMARK(BM_MatrixChain)->Arg(4)->Arg(6)->Arg(16)->Arg(64);
+
+// Same expression using the in-place operations and a persistent output
+static void BM_MatrixChainInPlace(benchmark::State &state) {
+    const unsigned size = state.range(0);
+    const Math::Matrix A = randomMatrix(size, size, 1);
+    const Math::Matrix B = randomMatrix(size, size, 2);
+    const Math::Matrix C = randomMatrix(size, size, 3);
+    Math::Matrix result;
+
+    for (auto _ : state) {
+        Math::Matrix::multiply(A, B, result);
+        result += C;
+        benchmark::DoNotOptimize(result.data());
+    }
+}
+BENCHMARK(BM_MatrixChainInPlace)->Arg(4)->Arg(6)->Arg(16)->Arg(64);
+
+static void BM_MatrixInverse(benchmark::State &state) {
+    const unsigned size = state.range(0);
+    const Math::Matrix A = randomMatrix(size, size, 1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(A.inverse());
+    }
+}
+BENCHMARK(BM_MatrixInverse)->Arg(4)->Arg(6)->Arg(10)->Arg(64);
+
+static void BM_MatrixSolve(benchmark::State &state) {
+    const unsigned size = state.range(0);
+    const Math::Matrix A = randomMatrix(size, size, 1);
+    const Math::Matrix b = randomMatrix(size, 1, 2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(A.solve(b));
+    }
+}
+BENCHMARK(BM_MatrixSolve)->Arg(4)->Arg(6)->Arg(10)->Arg(64);
+
+// Kalman covariance prediction P = F * P * Fᵀ + Q, evaluated as a single expression
+static void BM_MatrixCovarianceUpdate(benchmark::State &state) {
+    const unsigned size = state.range(0);
+    const Math::Matrix F = randomMatrix(size, size, 1);
+    const Math::Matrix Q = randomMatrix(size, size, 3);
+    Math::Matrix P = randomMatrix(size, size, 2);
+
+    for (auto _ : state) {
+        P = F * P * F.transposed() + Q;
+        benchmark::DoNotOptimize(P.data());
+    }
+}
+BENCHMARK(BM_MatrixCovarianceUpdate)->Arg(4)->Arg(6)->Arg(16);
+
+// Line by line product (A(i, k) * B(k, :) accumulated on the result line), used below the
+// blocked kernel threshold
+static void BM_MatrixProductLines(benchmark::State &state) {
+    const unsigned size = state.range(0);
+    const Math::Matrix A = randomMatrix(size, size, 1);
+    const Math::Matrix B = randomMatrix(size, size, 2);
+    Math::Matrix result(size, size);
+
+    for (auto _ : state) {
+        result.setSize(size, size);
+        for(unsigned i = 0; i < size; i++) {
+            const float *a = A.line(i);
+            float *r = result.line(i);
+            for(unsigned k = 0; k < size; k++) {
+                const float *b = B.line(k);
+                for(unsigned j = 0; j < size; j++) {
+                    r[j] += a[k] * b[j];
+                }
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MatrixProductLines)->Arg(8)->Arg(16)->Arg(32)->Arg(64)->Arg(256)->Arg(512);
+
+// Blocked product with each micro-kernel, single threaded
+static void BM_Gemm(benchmark::State &state) {
+    const unsigned size = state.range(0);
+    const auto kernel = static_cast<Math::impl::GemmKernel>(state.range(1));
+    if(!Math::impl::isGemmKernelSupported(kernel)) {
+        state.SkipWithError("Kernel not supported by this CPU");
+        return;
+    }
+    const Math::Matrix A = randomMatrix(size, size, 1);
+    const Math::Matrix B = randomMatrix(size, size, 2);
+    Math::Matrix result(size, size);
+
+    for (auto _ : state) {
+        result.setSize(size, size);
+        Math::impl::gemm(size, size, size, A.data(), A.stride(), B.data(), B.stride(),
+                         result.data(), result.stride(), 1, kernel);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_Gemm)->ArgsProduct({{8, 16, 32, 64, 256, 512}, {0, 1, 2}});
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Common/Types/Field/Field.h>
+#include <Armorial/Planning/TeamPlanner/TeamPlanner.h>
+
+#include <random>
+
+namespace {
+    Common::Types::Field makeField() {
+        return Common::Types::Field(Common::Enums::Side::SIDE_LEFT, 500.0f, 9000.0f, 6000.0f, 180.0f, 1000.0f, 1000.0f, 2000.0f, 6000.0f);
+    }
+
+    enum Scenario { EMPTY, CROWDED, MOVING, WALL };
+
+    // Obstacles of each scenario; the crowded ones are the 21 other robots of an 11 vs 11 match
+    std::vector<Planning::Obstacle> obstacles(int scenario) {
+        std::vector<Planning::Obstacle> result;
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<float> x(-3500.0f, 3500.0f), y(-2800.0f, 2800.0f), speed(-2000.0f, 2000.0f);
+        switch(scenario) {
+        case CROWDED:
+        case MOVING:
+            for(int i = 0; i < 21; i++) {
+                const Geometry::Vector2D velocity = (scenario == MOVING) ? Geometry::Vector2D(speed(generator), speed(generator)) : Geometry::Vector2D(0.0f, 0.0f);
+                result.push_back({Geometry::Vector2D(x(generator), y(generator)), velocity, 90.0f});
+            }
+            break;
+        case WALL:
+            for(float wallY = -3000.0f; wallY <= 1000.0f; wallY += 150.0f) {
+                result.push_back({Geometry::Vector2D(0.0f, wallY), Geometry::Vector2D(0.0f, 0.0f), 90.0f});
+            }
+            break;
+        default:
+            break;
+        }
+
+        return result;
+    }
+
+    void reportPath(benchmark::State &state, const Planning::Path &path) {
+        state.counters["reached"] = path.reachesGoal;
+        state.counters["length"] = path.length;
+        state.counters["iterations"] = path.iterations;
+    }
+}
+
+// A single robot crossing the field with the default 200 us budget; the planner either reuses the
+// previous frame's path (1) or starts from scratch each frame (0)
+static void BM_PathPlannerScenario(benchmark::State &state) {
+    const std::vector<Planning::Obstacle> scenarioObstacles = obstacles(state.range(0));
+    const bool reuse = state.range(1);
+    const Geometry::Vector2D start(-4000.0f, -2000.0f), goal(4000.0f, 2000.0f);
+    Planning::PathPlanner planner(makeField());
+
+    for (auto _ : state) {
+        if(!reuse) {
+            planner.reset();
+        }
+        benchmark::DoNotOptimize(planner.plan(start, goal, scenarioObstacles).length);
+    }
+    reportPath(state, planner.path());
+}
+BENCHMARK(BM_PathPlannerScenario)->ArgsProduct({{EMPTY, CROWDED, MOVING, WALL}, {0, 1}});
+
+// A frame of a whole team among the opponents, planned by the given amount of threads
+static void BM_TeamPlannerFrame(benchmark::State &state) {
+    const size_t robots = state.range(0);
+    std::vector<Planning::Obstacle> frameObstacles = obstacles(MOVING);
+    std::vector<Planning::PlanningRequest> requests;
+    for(size_t robot = 0; robot < robots; robot++) {
+        const float y = -2500.0f + 5000.0f * robot / robots;
+        requests.push_back({Geometry::Vector2D(-4000.0f, y), Geometry::Vector2D(4000.0f, -y), frameObstacles.size()});
+        frameObstacles.push_back({requests.back().start, Geometry::Vector2D(0.0f, 0.0f), 90.0f});
+    }
+    Planning::TeamPlanner planner(makeField(), robots, Planning::PlannerSettings(), state.range(1));
+
+    size_t reached = 0;
+    for (auto _ : state) {
+        const std::vector<Planning::Path> &paths = planner.plan(requests, frameObstacles);
+        reached = 0;
+        for(const Planning::Path &path : paths) {
+            reached += path.reachesGoal;
+        }
+    }
+    state.counters["reached"] = reached;
+}
+BENCHMARK(BM_TeamPlannerFrame)->ArgsProduct({{6, 11}, {1, 4}})->UseRealTime();
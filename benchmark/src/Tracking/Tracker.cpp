@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Tracking/Tracker/Tracker.h>
+
+#include <random>
+
+// A frame of the tracker with the given amount of targets moving at 120 Hz, with noisy detections
+static void BM_TrackerUpdate(benchmark::State &state) {
+    const unsigned targets = state.range(0);
+    const float dt = 1.0f / 120.0f;
+    std::mt19937 generator(1);
+    // Lengths in millimeters, as in Tracking::TrackingSettings
+    std::uniform_real_distribution<float> position(-4000.0f, 4000.0f), velocity(-2000.0f, 2000.0f);
+    std::normal_distribution<float> noise(0.0f, 5.0f);
+
+    std::vector<Geometry::Vector2D> positions, velocities;
+    for(unsigned i = 0; i < targets; i++) {
+        positions.emplace_back(position(generator), position(generator));
+        velocities.emplace_back(velocity(generator), velocity(generator));
+    }
+
+    Tracking::TrackingSettings settings;
+    settings.model = static_cast<Tracking::MotionModel>(state.range(1));
+    Tracking::Tracker tracker(settings);
+    std::vector<Tracking::Detection> detections(targets);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for(unsigned i = 0; i < targets; i++) {
+            positions[i] = positions[i] + velocities[i] * dt;
+            detections[i].position = positions[i] + Geometry::Vector2D(noise(generator), noise(generator));
+            detections[i].orientation = Geometry::Angle(0.1f * i);
+        }
+        state.ResumeTiming();
+
+        tracker.update(detections, dt);
+        benchmark::DoNotOptimize(tracker.tracks().data());
+    }
+}
+BENCHMARK(BM_TrackerUpdate)->ArgsProduct({{8, 16, 32, 64}, {0, 1}});
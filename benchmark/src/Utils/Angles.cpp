@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <Armorial/Utils/Utils.h>
+
+#include <cmath>
+#include <random>
+
+namespace {
+    std::vector<float> randomValues(size_t count, float range) {
+        std::mt19937 generator(1);
+        std::uniform_real_distribution<float> distribution(-range, range);
+        std::vector<float> values(count);
+        for(float &value : values) {
+            value = distribution(generator);
+        }
+
+        return values;
+    }
+}
+
+// Normalization of accumulated orientations (range given in turns)
+static void BM_AngleNormalize(benchmark::State &state) {
+    const std::vector<float> values = randomValues(1024, state.range(0) * 2 * Geometry::Angle::PI);
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for(float value : values) {
+            sum += Geometry::Angle(value).value();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_AngleNormalize)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_Sin(benchmark::State &state) {
+    const std::vector<float> values = randomValues(1024, Geometry::Angle::PI);
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for(float value : values) {
+            sum += std::sin(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Sin);
+
+static void BM_FastSin(benchmark::State &state) {
+    const std::vector<float> values = randomValues(1024, Geometry::Angle::PI);
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for(float value : values) {
+            sum += Utils::Angles::fastSin(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_FastSin);
+
+static void BM_Atan2(benchmark::State &state) {
+    const std::vector<float> xs = randomValues(1024, 1.0f), ys = randomValues(1025, 1.0f);
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for(size_t i = 0; i < xs.size(); i++) {
+            sum += std::atan2(ys[i + 1], xs[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Atan2);
+
+static void BM_FastAtan2(benchmark::State &state) {
+    const std::vector<float> xs = randomValues(1024, 1.0f), ys = randomValues(1025, 1.0f);
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for(size_t i = 0; i < xs.size(); i++) {
+            sum += Utils::Angles::fastAtan2(ys[i + 1], xs[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_FastAtan2);
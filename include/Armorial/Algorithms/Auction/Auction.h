@@ -0,0 +1,55 @@
+#ifndef ARMORIAL_ALGORITHMS_AUCTION_H
+#define ARMORIAL_ALGORITHMS_AUCTION_H
+
+#include <Armorial/Algorithms/Auction/impl/auction_impl.h>
+
+#include <QPair>
+#include <QVector>
+
+namespace Algorithms {
+/*!
+ * \brief The Algorithms::Auction class matches robots to positions minimizing
+ * the total distance, as Algorithms::Hungarian does, but using the auction
+ * algorithm. It pays off for large assignment problems, where the bidding
+ * phase can be split across threads.
+ */
+template <class R, class PT> class Auction {
+public:
+  /*!
+   * \param robots, positions The robots and the candidate positions.
+   * \param threads The maximum amount of threads used in the bidding phase.
+   * \return The matched pairs of robot and position, or an empty list if there
+   * are more robots than positions.
+   */
+  inline static QVector<QPair<R, PT>>
+  match(const QVector<R> &robots, const QVector<PT> &positions,
+        unsigned threads = std::thread::hardware_concurrency()) {
+    QVector<QPair<R, PT>> result;
+    if (!(robots.size() <= positions.size())) {
+      return result;
+    }
+    const int n = static_cast<int>(robots.size());
+    const int m = static_cast<int>(positions.size());
+
+    impl::auction<float> auction(n, m, threads);
+
+    for (int i = 0; i < n; ++i) {
+      R robot = robots[i];
+      for (int j = 0; j < m; ++j) {
+        auction.a[i][j] = robot.distTo(positions[j]);
+      }
+    }
+
+    auction.solve();
+
+    for (int i = 0; i < n; ++i) {
+      const auto &position = positions[auction.pa[i]];
+      result.push_back(QPair<R, PT>(robots[i], position));
+    }
+
+    return result;
+  }
+};
+} // namespace Algorithms
+
+#endif // ARMORIAL_ALGORITHMS_AUCTION_H
@@ -0,0 +1,321 @@
+#ifndef ARMORIAL_ALGORITHMS_AUCTION_IMPL_H
+#define ARMORIAL_ALGORITHMS_AUCTION_IMPL_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Algorithms {
+namespace impl {
+using std::fill;
+using std::numeric_limits;
+using std::vector;
+
+/*!
+ * @brief The auction algorithm solves the assignment problem by letting the
+ * rows (persons) bid for the columns (objects), raising their prices until
+ * every person holds an object. Epsilon-scaling runs several auctions with a
+ * decreasing bid increment, reusing the prices of the previous one.
+ * The forward bidding phase is Jacobi-style (every unassigned person bids
+ * against the same prices) and is split across threads for large problems.
+ * Rectangular problems (n < m) are closed with reverse auction iterations,
+ * which lower the prices of the objects left unassigned.
+ * @note The result cost is within n * eps_final of the optimum.
+ * @link https://doi.org/10.1007/BF02186476
+ */
+template <typename T> class auction {
+public:
+  int n;
+  int m;
+  vector<vector<T>> a;
+  vector<int> pa;
+  unsigned threads;
+  // Minimum amount of bid evaluations (persons * m) worth splitting a round
+  int parallel_threshold;
+  // Factor which epsilon is divided by between scaling phases
+  double scaling_factor;
+  auction(int _n, int _m, unsigned _threads = 1)
+      : n(_n), m(_m), threads(std::max(1u, _threads)),
+        parallel_threshold(1 << 13), scaling_factor(5.0) {
+    assert(n <= m);
+    a = vector<vector<T>>(n, vector<T>(m));
+    pa = vector<int>(n, -1);
+  }
+  inline T current_score() {
+    T score = T(0);
+    for (int i = 0; i < n; i++) {
+      score += a[i][pa[i]];
+    }
+    return score;
+  }
+  inline T solve() {
+    if (n == 0) {
+      return T(0);
+    }
+    prepare();
+
+    // Start with a bid increment of the order of the cost range and scale it
+    // down until the total error bound (n * eps) becomes negligible
+    double range = 0.0;
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < m; j++) {
+        range = std::max(range, std::fabs(static_cast<double>(a[i][j])));
+      }
+    }
+    range = std::max(range, numeric_limits<double>::min());
+    const double eps_final = range * 1e-7 / n;
+    double eps = std::max(range / 2.0, eps_final);
+
+    start_workers();
+    while (true) {
+      forward_phase(eps);
+      reverse_phase(eps);
+      if (eps <= eps_final) {
+        break;
+      }
+      eps = std::max(eps / scaling_factor, eps_final);
+    }
+    stop_workers();
+
+    for (int i = 0; i < n; i++) {
+      pa[i] = assigned[i];
+    }
+    return current_score();
+  }
+
+private:
+  vector<double> price;
+  vector<double> profit;
+  vector<int> assigned;
+  vector<int> owner;
+  vector<int> unassigned;
+  vector<int> overpriced;
+  vector<int> bid_object;
+  vector<double> bid_price;
+  vector<double> best_bid;
+  vector<int> best_bidder;
+  vector<int> touched;
+
+  // Worker pool used in the bidding phase
+  vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable start_cv;
+  std::condition_variable done_cv;
+  unsigned generation = 0;
+  unsigned pending = 0;
+  bool stopping = false;
+  double round_eps = 0.0;
+
+  inline void prepare() {
+    price.assign(m, 0.0);
+    profit.assign(n, 0.0);
+    assigned.assign(n, -1);
+    owner.assign(m, -1);
+    bid_object.assign(n, -1);
+    bid_price.assign(n, 0.0);
+    best_bid.assign(m, -numeric_limits<double>::infinity());
+    best_bidder.assign(m, -1);
+    unassigned.reserve(n);
+    overpriced.reserve(m);
+    touched.reserve(m);
+  }
+  // Benefit of person i for object j
+  inline double value(int i, int j) const {
+    return -static_cast<double>(a[i][j]);
+  }
+  inline void bid(int i, double eps) {
+    double best = -numeric_limits<double>::infinity();
+    double second = -numeric_limits<double>::infinity();
+    int best_j = -1;
+    for (int j = 0; j < m; j++) {
+      double v = value(i, j) - price[j];
+      if (v > best) {
+        second = best;
+        best = v;
+        best_j = j;
+      } else if (v > second) {
+        second = v;
+      }
+    }
+    if (m == 1) {
+      second = best;
+    }
+    bid_object[i] = best_j;
+    bid_price[i] = price[best_j] + (best - second) + eps;
+  }
+  inline void bid_range(unsigned part, unsigned parts) {
+    const int count = static_cast<int>(unassigned.size());
+    const int begin = static_cast<int>((static_cast<long>(count) * part) / parts);
+    const int end = static_cast<int>((static_cast<long>(count) * (part + 1)) / parts);
+    for (int k = begin; k < end; k++) {
+      bid(unassigned[k], round_eps);
+    }
+  }
+  inline void start_workers() {
+    if (threads <= 1 || static_cast<long>(n) * m < parallel_threshold) {
+      return;
+    }
+    stopping = false;
+    for (unsigned t = 1; t < threads; t++) {
+      workers.emplace_back([this, t, seen = generation]() mutable {
+        while (true) {
+          {
+            std::unique_lock<std::mutex> lock(mutex);
+            start_cv.wait(lock, [&]() { return stopping || generation != seen; });
+            if (stopping) {
+              return;
+            }
+            seen = generation;
+          }
+          bid_range(t, threads);
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0) {
+              done_cv.notify_one();
+            }
+          }
+        }
+      });
+    }
+  }
+  inline void stop_workers() {
+    if (workers.empty()) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    start_cv.notify_all();
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    workers.clear();
+  }
+  inline void bidding_round(double eps) {
+    round_eps = eps;
+    const bool parallel = !workers.empty() &&
+        static_cast<long>(unassigned.size()) * m >= parallel_threshold;
+    if (!parallel) {
+      bid_range(0, 1);
+      return;
+    }
+    const unsigned parts = static_cast<unsigned>(workers.size()) + 1;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pending = parts - 1;
+      generation++;
+    }
+    start_cv.notify_all();
+    bid_range(0, parts);
+    std::unique_lock<std::mutex> lock(mutex);
+    done_cv.wait(lock, [&]() { return pending == 0; });
+  }
+  inline void forward_phase(double eps) {
+    fill(assigned.begin(), assigned.end(), -1);
+    fill(owner.begin(), owner.end(), -1);
+    unassigned.clear();
+    for (int i = 0; i < n; i++) {
+      unassigned.push_back(i);
+    }
+    while (!unassigned.empty()) {
+      bidding_round(eps);
+
+      // Assignment phase: each object goes to its highest bidder
+      touched.clear();
+      for (int i : unassigned) {
+        const int j = bid_object[i];
+        if (best_bidder[j] == -1) {
+          touched.push_back(j);
+        }
+        if (bid_price[i] > best_bid[j]) {
+          best_bid[j] = bid_price[i];
+          best_bidder[j] = i;
+        }
+      }
+      for (int j : touched) {
+        const int winner = best_bidder[j];
+        if (owner[j] != -1) {
+          assigned[owner[j]] = -1;
+        }
+        owner[j] = winner;
+        assigned[winner] = j;
+        price[j] = best_bid[j];
+        profit[winner] = value(winner, j) - price[j];
+        best_bid[j] = -numeric_limits<double>::infinity();
+        best_bidder[j] = -1;
+      }
+      // Displaced owners and losing bidders keep bidding in the next round
+      rebuild_unassigned();
+    }
+  }
+  inline void rebuild_unassigned() {
+    unassigned.clear();
+    for (int i = 0; i < n; i++) {
+      if (assigned[i] == -1) {
+        unassigned.push_back(i);
+      }
+    }
+  }
+  inline void reverse_phase(double eps) {
+    if (n == m) {
+      return;
+    }
+    // Every object left unassigned must end up with a price not greater than
+    // the lowest price among the assigned ones (lambda)
+    double lambda = numeric_limits<double>::infinity();
+    for (int j = 0; j < m; j++) {
+      if (owner[j] != -1) {
+        lambda = std::min(lambda, price[j]);
+      }
+    }
+    overpriced.clear();
+    for (int j = 0; j < m; j++) {
+      if (owner[j] == -1 && price[j] > lambda) {
+        overpriced.push_back(j);
+      }
+    }
+    while (!overpriced.empty()) {
+      const int j = overpriced.back();
+      overpriced.pop_back();
+
+      double best = -numeric_limits<double>::infinity();
+      double second = -numeric_limits<double>::infinity();
+      int best_i = -1;
+      for (int i = 0; i < n; i++) {
+        double v = value(i, j) - profit[i];
+        if (v > best) {
+          second = best;
+          best = v;
+          best_i = i;
+        } else if (v > second) {
+          second = v;
+        }
+      }
+      if (lambda >= best - eps) {
+        price[j] = lambda;
+        continue;
+      }
+      price[j] = std::max(lambda, second - eps);
+
+      // Object j takes its best person, releasing the object it held
+      const int released = assigned[best_i];
+      owner[released] = -1;
+      if (price[released] > lambda) {
+        overpriced.push_back(released);
+      }
+      owner[j] = best_i;
+      assigned[best_i] = j;
+      profit[best_i] = value(best_i, j) - price[j];
+    }
+  }
+};
+} // namespace impl
+} // namespace Algorithms
+
+#endif // ARMORIAL_ALGORITHMS_AUCTION_IMPL_H
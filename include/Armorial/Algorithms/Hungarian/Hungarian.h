@@ -1,8 +1,12 @@
 #ifndef ARMORIAL_ALGORITHMS_HUNGARIAN_H
 #define ARMORIAL_ALGORITHMS_HUNGARIAN_H
 
+#include <Armorial/Algorithms/Hungarian/impl/fixed_hungarian_impl.h>
 #include <Armorial/Algorithms/Hungarian/impl/hungarian_impl.h>
 
+#include <QPair>
+#include <QVector>
+
 namespace Algorithms {
 template <class R, class PT> class Hungarian {
 public:
@@ -34,6 +38,36 @@ public:
 
     return result;
   }
+
+  /*!
+   * \brief Fixed-size overload, for when the amount of robots and positions
+   * is known at compile time. Solved without any heap allocation, using an
+   * exhaustive search when there are few positions.
+   * \return An array where the i-th pair holds the i-th robot and its position.
+   */
+  template <std::size_t N, std::size_t M>
+  inline static std::array<QPair<R, PT>, N>
+  match(const std::array<R, N> &robots, const std::array<PT, M> &positions) {
+    static_assert(N <= M, "There should be at least one position per robot");
+    tourist::fixed_hungarian<float, static_cast<int>(N), static_cast<int>(M)>
+        hungarian;
+
+    for (std::size_t i = 0; i < N; ++i) {
+      R robot = robots[i];
+      for (std::size_t j = 0; j < M; ++j) {
+        hungarian.a[i][j] = robot.distTo(positions[j]);
+      }
+    }
+
+    hungarian.solve();
+
+    std::array<QPair<R, PT>, N> result;
+    for (std::size_t i = 0; i < N; ++i) {
+      result[i] = QPair<R, PT>(robots[i], positions[hungarian.pa[i]]);
+    }
+
+    return result;
+  }
 };
 } // namespace Algorithms
 
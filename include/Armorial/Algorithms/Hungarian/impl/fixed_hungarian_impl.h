@@ -0,0 +1,173 @@
+#ifndef ARMORIAL_ALGORITHMS_FIXED_HUNGARIAN_IMPL_H
+#define ARMORIAL_ALGORITHMS_FIXED_HUNGARIAN_IMPL_H
+
+#include <array>
+#include <limits>
+
+namespace tourist {
+using std::array;
+
+/*!
+ * @brief Fixed-size version of tourist::hungarian, for assignment problems
+ * whose size is known at compile time. All the storage lives in std::array
+ * members (no heap) and every method is constexpr, so small problems can even
+ * be solved at compile time.
+ * @note Tiny problems (at most `exhaustive_rows` rows and
+ * `exhaustive_arrangements` possible assignments) are solved by an exhaustive
+ * branch and bound search, which is faster than the Hungarian method there.
+ * @link https://github.com/the-tourist/algo/blob/master/flows/hungarian.cpp
+ */
+template <typename T, int N, int M> class fixed_hungarian {
+  static_assert(N >= 0 && N <= M, "fixed_hungarian requires N <= M");
+
+public:
+  // Exhaustive search only beats the Hungarian method while the amount of
+  // possible assignments (M! / (M - N)!) is small and there are few rows
+  static constexpr int exhaustive_rows = 4;
+  static constexpr long exhaustive_arrangements = 120;
+  static constexpr T inf = std::numeric_limits<T>::max();
+
+  array<array<T, M>, N> a{};
+  array<int, N + 1> pa{};
+  array<int, M + 1> pb{};
+
+  constexpr T solve() {
+    if constexpr (N <= exhaustive_rows &&
+                  arrangements() <= exhaustive_arrangements) {
+      return solve_exhaustive();
+    } else {
+      return solve_hungarian();
+    }
+  }
+
+  constexpr T solve_hungarian() {
+    for (int j = 0; j <= M; j++) {
+      v[j] = T(0);
+      pb[j] = -1;
+    }
+    for (int i = 0; i <= N; i++) {
+      u[i] = T(0);
+      pa[i] = -1;
+    }
+    for (int i = 0; i < N; i++) {
+      add_row(i);
+    }
+    return -v[M];
+  }
+
+  constexpr T solve_exhaustive() {
+    array<int, N + 1> current{};
+    array<bool, M> taken{};
+    // bound[i] is a lower bound of the cost of assigning rows i..N-1 (the sum
+    // of their minimum costs), used to prune partial assignments
+    array<T, N + 1> bound{};
+    for (int i = N - 1; i >= 0; i--) {
+      T lowest = a[i][0];
+      for (int j = 1; j < M; j++) {
+        lowest = (a[i][j] < lowest) ? a[i][j] : lowest;
+      }
+      bound[i] = bound[i + 1] + lowest;
+    }
+    // Start from the identity assignment, so pa stays valid even when no
+    // assignment costs less than inf (e.g. every cost is inf)
+    for (int i = 0; i < N; i++) {
+      pa[i] = i;
+    }
+    pa[N] = -1;
+    T best = inf;
+    search(0, T(0), bound, current, taken, best);
+    for (int j = 0; j <= M; j++) {
+      pb[j] = -1;
+    }
+    for (int i = 0; i < N; i++) {
+      pb[pa[i]] = i;
+    }
+    return best;
+  }
+
+  static constexpr long arrangements() {
+    long count = 1;
+    for (int k = 0; k < N && count <= exhaustive_arrangements; k++) {
+      count *= (M - k);
+    }
+    return count;
+  }
+
+private:
+  array<T, N + 1> u{};
+  array<T, M + 1> v{};
+  array<int, M> way{};
+  array<T, M> minv{};
+  array<bool, M + 1> used{};
+
+  constexpr void add_row(int i) {
+    for (int j = 0; j < M; j++) {
+      minv[j] = inf;
+    }
+    for (int j = 0; j <= M; j++) {
+      used[j] = false;
+    }
+    pb[M] = i;
+    pa[i] = M;
+    int j0 = M;
+    do {
+      used[j0] = true;
+      int i0 = pb[j0];
+      T delta = inf;
+      int j1 = -1;
+      for (int j = 0; j < M; j++) {
+        if (!used[j]) {
+          T cur = a[i0][j] - u[i0] - v[j];
+          if (cur < minv[j]) {
+            minv[j] = cur;
+            way[j] = j0;
+          }
+          if (minv[j] < delta) {
+            delta = minv[j];
+            j1 = j;
+          }
+        }
+      }
+      for (int j = 0; j <= M; j++) {
+        if (used[j]) {
+          u[pb[j]] += delta;
+          v[j] -= delta;
+        } else {
+          minv[j] -= delta;
+        }
+      }
+      j0 = j1;
+    } while (pb[j0] != -1);
+    do {
+      int j1 = way[j0];
+      pb[j0] = pb[j1];
+      pa[pb[j0]] = j0;
+      j0 = j1;
+    } while (j0 != M);
+  }
+
+  constexpr void search(int i, T cost, const array<T, N + 1> &bound,
+                        array<int, N + 1> &current, array<bool, M> &taken,
+                        T &best) {
+    if (i == N) {
+      if (cost < best) {
+        best = cost;
+        for (int k = 0; k < N; k++) {
+          pa[k] = current[k];
+        }
+      }
+      return;
+    }
+    for (int j = 0; j < M; j++) {
+      if (!taken[j] && cost + a[i][j] + bound[i + 1] < best) {
+        taken[j] = true;
+        current[i] = j;
+        search(i + 1, cost + a[i][j], bound, current, taken, best);
+        taken[j] = false;
+      }
+    }
+  }
+};
+} // namespace tourist
+
+#endif // ARMORIAL_ALGORITHMS_FIXED_HUNGARIAN_IMPL_H
@@ -1,6 +1,11 @@
 #ifndef ARMORIAL_ALGORITHMS_HUNGARIAN_IMPL_H
 #define ARMORIAL_ALGORITHMS_HUNGARIAN_IMPL_H
 
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <vector>
+
 namespace tourist {
 using std::fill;
 using std::numeric_limits;
@@ -5,6 +5,7 @@
 
 #include "Color/Color.h"
 #include "Quadrant/Quadrant.h"
+#include "Region/Region.h"
 #include "Side/Side.h"
 
 #endif // ARMORIAL_COMMON_ENUMS_H
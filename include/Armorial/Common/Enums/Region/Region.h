@@ -0,0 +1,33 @@
+#ifndef ARMORIAL_COMMON_ENUMS_REGION_H
+#define ARMORIAL_COMMON_ENUMS_REGION_H
+
+#include <cstdint>
+
+namespace Common {
+namespace Enums {
+    /*!
+     * \brief Field regions, as bit flags so the regions that contain a point can be combined in a
+     * single RegionMask.
+     */
+    enum Region : uint16_t {
+        REGION_FIELD = 1 << 0,
+        REGION_OUR_FIELD = 1 << 1,
+        REGION_THEIR_FIELD = 1 << 2,
+        REGION_OUR_PENALTY_AREA = 1 << 3,
+        REGION_THEIR_PENALTY_AREA = 1 << 4,
+        REGION_TOP_RIGHT_QUADRANT = 1 << 5,
+        REGION_TOP_LEFT_QUADRANT = 1 << 6,
+        REGION_BOTTOM_LEFT_QUADRANT = 1 << 7,
+        REGION_BOTTOM_RIGHT_QUADRANT = 1 << 8,
+        REGION_NEAR_OUR_GOAL = 1 << 9,
+        REGION_NEAR_THEIR_GOAL = 1 << 10
+    };
+
+    /*!
+     * \brief A combination of Region flags.
+     */
+    using RegionMask = uint16_t;
+}
+}
+
+#endif // ARMORIAL_COMMON_ENUMS_REGION_H
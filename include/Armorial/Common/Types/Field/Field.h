@@ -272,6 +272,12 @@ namespace Types {
          */
         bool isInsideTheirField(Geometry::Vector2D position);
 
+        /*!
+         * \return A copy of this field as seen in the canonical frame of Types::WorldSnapshot, where our
+         * team always plays at the left side.
+         */
+        Field canonical() const;
+
         /*!
          * \brief Multiply a scalar to Field components.
          * \param other A float scalar value.
@@ -0,0 +1,162 @@
+#ifndef ARMORIAL_COMMON_TYPES_FIELDGEOMETRY_H
+#define ARMORIAL_COMMON_TYPES_FIELDGEOMETRY_H
+
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+#include <Armorial/Geometry/Circle/Circle.h>
+#include <Armorial/Geometry/Rectangle/Rectangle.h>
+
+namespace Common {
+namespace Types {
+    class Field;
+
+    /*!
+     * \brief The Types::FieldGeometry class holds every region and point derived from a Types::Field,
+     * computed once at construction with the play side already resolved.
+     *
+     * The Field accessors build a new Geometry::Rectangle (and branch on the play side) at each call;
+     * a FieldGeometry should instead be built whenever the field dimensions or the play side change,
+     * and queried by the planners as many times as needed.
+     */
+    class FieldGeometry
+    {
+    public:
+        /*!
+         * \brief FieldGeometry default constructor
+         */
+        FieldGeometry() = default;
+
+        /*!
+         * \brief Constructs a FieldGeometry instance with the regions of the given field.
+         * \param field The field which regions should be computed.
+         */
+        explicit FieldGeometry(const Field &field);
+
+        /*!
+         * \return True if we are playing at left side and False otherwise.
+         */
+        bool playingLeftSide() const;
+
+        /*!
+         * \brief Getters for the regions of the field, as returned by the respective Field methods.
+         */
+        const Geometry::Rectangle& field() const;
+        const Geometry::Rectangle& ourField() const;
+        const Geometry::Rectangle& theirField() const;
+        const Geometry::Rectangle& ourPenaltyArea() const;
+        const Geometry::Rectangle& theirPenaltyArea() const;
+        const Geometry::Rectangle& topRightQuadrant() const;
+        const Geometry::Rectangle& topLeftQuadrant() const;
+        const Geometry::Rectangle& bottomLeftQuadrant() const;
+        const Geometry::Rectangle& bottomRightQuadrant() const;
+        const Geometry::Circle& centerCircle() const;
+
+        /*!
+         * \brief Getters for the points of the field, as returned by the respective Field methods.
+         */
+        const Geometry::Vector2D& ourGoalCenter() const;
+        const Geometry::Vector2D& ourGoalLeftPost() const;
+        const Geometry::Vector2D& ourGoalRightPost() const;
+        const Geometry::Vector2D& ourPenaltyMark() const;
+        const Geometry::Vector2D& theirGoalCenter() const;
+        const Geometry::Vector2D& theirGoalLeftPost() const;
+        const Geometry::Vector2D& theirGoalRightPost() const;
+        const Geometry::Vector2D& theirPenaltyMark() const;
+        const Geometry::Vector2D& topRightCorner() const;
+        const Geometry::Vector2D& topLeftCorner() const;
+        const Geometry::Vector2D& bottomLeftCorner() const;
+        const Geometry::Vector2D& bottomRightCorner() const;
+
+        /*!
+         * \brief Verify if position is inside a region, with the same result as the respective Field
+         * method but without branches.
+         * \param position A Geometry::Vector2D that represents the position.
+         * \param margin A margin to expand (positive) or shrink (negative) the region.
+         * \return True if the point is inside the region.
+         */
+        bool isInsideField(const Geometry::Vector2D &position, float margin = 0.0f) const;
+        bool isInsideOurPenaltyArea(const Geometry::Vector2D &position, float margin = 0.0f) const;
+        bool isInsideTheirPenaltyArea(const Geometry::Vector2D &position, float margin = 0.0f) const;
+        bool isInsideOurField(const Geometry::Vector2D &position, float margin = 0.0f) const;
+        bool isInsideTheirField(const Geometry::Vector2D &position, float margin = 0.0f) const;
+
+        /*!
+         * \brief Axis-aligned limits of a region, used by the containment checks.
+         */
+        struct Bounds {
+            float minX = 0.0f;
+            float maxX = 0.0f;
+            float minY = 0.0f;
+            float maxY = 0.0f;
+        };
+
+        /*!
+         * \param rectangle The given Geometry::Rectangle.
+         * \return The limits of the rectangle, taken from the same corners Rectangle::contains compares against.
+         */
+        static Bounds boundsOf(const Geometry::Rectangle &rectangle);
+
+    private:
+        static bool inside(const Bounds &bounds, const Geometry::Vector2D &position, float margin);
+
+        bool _playingLeftSide = true;
+
+        Geometry::Rectangle _field;
+        Geometry::Rectangle _ourField;
+        Geometry::Rectangle _theirField;
+        Geometry::Rectangle _ourPenaltyArea;
+        Geometry::Rectangle _theirPenaltyArea;
+        Geometry::Rectangle _topRightQuadrant;
+        Geometry::Rectangle _topLeftQuadrant;
+        Geometry::Rectangle _bottomLeftQuadrant;
+        Geometry::Rectangle _bottomRightQuadrant;
+        Geometry::Circle _centerCircle;
+
+        Geometry::Vector2D _ourGoalCenter;
+        Geometry::Vector2D _ourGoalLeftPost;
+        Geometry::Vector2D _ourGoalRightPost;
+        Geometry::Vector2D _ourPenaltyMark;
+        Geometry::Vector2D _theirGoalCenter;
+        Geometry::Vector2D _theirGoalLeftPost;
+        Geometry::Vector2D _theirGoalRightPost;
+        Geometry::Vector2D _theirPenaltyMark;
+        Geometry::Vector2D _topRightCorner;
+        Geometry::Vector2D _topLeftCorner;
+        Geometry::Vector2D _bottomLeftCorner;
+        Geometry::Vector2D _bottomRightCorner;
+
+        Bounds _fieldBounds;
+        Bounds _ourFieldBounds;
+        Bounds _theirFieldBounds;
+        Bounds _ourPenaltyAreaBounds;
+        Bounds _theirPenaltyAreaBounds;
+    };
+
+    inline bool FieldGeometry::inside(const Bounds &bounds, const Geometry::Vector2D &position, float margin) {
+        // Non-short-circuit '&' so the four comparisons compile to a single flag sequence
+        return (position.x() >= bounds.minX - margin) & (position.x() <= bounds.maxX + margin)
+               & (position.y() >= bounds.minY - margin) & (position.y() <= bounds.maxY + margin);
+    }
+
+    inline bool FieldGeometry::isInsideField(const Geometry::Vector2D &position, float margin) const {
+        return inside(_fieldBounds, position, margin);
+    }
+
+    inline bool FieldGeometry::isInsideOurPenaltyArea(const Geometry::Vector2D &position, float margin) const {
+        return inside(_ourPenaltyAreaBounds, position, margin);
+    }
+
+    inline bool FieldGeometry::isInsideTheirPenaltyArea(const Geometry::Vector2D &position, float margin) const {
+        return inside(_theirPenaltyAreaBounds, position, margin);
+    }
+
+    inline bool FieldGeometry::isInsideOurField(const Geometry::Vector2D &position, float margin) const {
+        return inside(_ourFieldBounds, position, margin);
+    }
+
+    inline bool FieldGeometry::isInsideTheirField(const Geometry::Vector2D &position, float margin) const {
+        return inside(_theirFieldBounds, position, margin);
+    }
+}
+}
+
+#endif // ARMORIAL_COMMON_TYPES_FIELDGEOMETRY_H
@@ -0,0 +1,107 @@
+#ifndef ARMORIAL_COMMON_TYPES_FIELDREGIONGRID_H
+#define ARMORIAL_COMMON_TYPES_FIELDREGIONGRID_H
+
+#include <Armorial/Common/Types/FieldGeometry/FieldGeometry.h>
+#include <Armorial/Common/Enums/Region/Region.h>
+
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace Common {
+namespace Types {
+    class Field;
+
+    /*!
+     * \brief The Types::FieldRegionGrid class answers which regions of a Types::Field contain a
+     * point (see Enums::Region) in constant time.
+     *
+     * At construction the field (expanded by the near goal radius) is split into square cells, and
+     * each cell stores the mask of the regions that fully contain it. Cells crossed by a region
+     * border are flagged, and points falling in them (or outside the grid) are classified exactly,
+     * so the result is always the same as classifyExact().
+     */
+    class FieldRegionGrid
+    {
+    public:
+        /*!
+         * \brief FieldRegionGrid default constructor
+         */
+        FieldRegionGrid() = default;
+
+        /*!
+         * \brief Constructs a FieldRegionGrid instance for the given field.
+         * \param field The field which regions should be classified.
+         * \param resolution The side of each grid cell, in the field units, which should be positive.
+         * \param nearGoalRadius The distance from a goal center under which a point is near the goal.
+         * \note A smaller resolution leaves fewer points to the exact fallback, at the cost of memory.
+         */
+        FieldRegionGrid(const Field &field, float resolution, float nearGoalRadius);
+
+        /*!
+         * \param position A Geometry::Vector2D that represents the position.
+         * \return The mask of the regions that contain the given position.
+         */
+        Enums::RegionMask classify(const Geometry::Vector2D &position) const;
+
+        /*!
+         * \brief Classifies each of the count positions, as in classify().
+         */
+        void classify(const Geometry::Vector2D *positions, Enums::RegionMask *out, size_t count) const;
+
+        /*!
+         * \param position A Geometry::Vector2D that represents the position.
+         * \return The mask of the regions that contain the given position, computed without the grid.
+         */
+        Enums::RegionMask classifyExact(const Geometry::Vector2D &position) const;
+
+        /*!
+         * \return The Types::FieldGeometry the regions are taken from.
+         */
+        const FieldGeometry& geometry() const;
+
+        /*!
+         * \brief Getters for the grid dimensions.
+         */
+        float resolution() const;
+        size_t columns() const;
+        size_t rows() const;
+
+    private:
+        /*!
+         * \brief Cell flag that tells a region border crosses the cell. It is outside the range used
+         * by Enums::Region.
+         */
+        static constexpr Enums::RegionMask BOUNDARY = 1 << 15;
+
+        FieldGeometry _geometry;
+        float _nearGoalRadius = 0.0f;
+
+        float _resolution = 0.0f;
+        float _inverseResolution = 0.0f;
+        float _minX = 0.0f;
+        float _minY = 0.0f;
+        size_t _columns = 0;
+        size_t _rows = 0;
+        std::vector<Enums::RegionMask> _cells;
+    };
+
+    inline Enums::RegionMask FieldRegionGrid::classify(const Geometry::Vector2D &position) const {
+        const float column = (position.x() - _minX) * _inverseResolution;
+        const float row = (position.y() - _minY) * _inverseResolution;
+
+        // Written so NaN coordinates also fall back to the exact classification
+        if(column >= 0.0f && row >= 0.0f && column < float(_columns) && row < float(_rows)) {
+            const Enums::RegionMask cell = _cells[size_t(row) * _columns + size_t(column)];
+            if(!(cell & BOUNDARY)) {
+                return cell;
+            }
+        }
+
+        return classifyExact(position);
+    }
+}
+}
+
+#endif // ARMORIAL_COMMON_TYPES_FIELDREGIONGRID_H
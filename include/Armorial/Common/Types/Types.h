@@ -2,7 +2,10 @@
 #define ARMORIAL_COMMON_TYPES_H
 
 #include "Field/Field.h"
+#include "FieldGeometry/FieldGeometry.h"
+#include "FieldRegionGrid/FieldRegionGrid.h"
 #include "Traits/Traits.h"
 #include "Object/Object.h"
+#include "WorldSnapshot/WorldSnapshot.h"
 
 #endif // ARMORIAL_COMMON_TYPES_H
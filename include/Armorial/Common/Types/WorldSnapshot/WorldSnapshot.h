@@ -0,0 +1,128 @@
+#ifndef ARMORIAL_COMMON_TYPES_WORLDSNAPSHOT_H
+#define ARMORIAL_COMMON_TYPES_WORLDSNAPSHOT_H
+
+#include <Armorial/Common/Types/Types.h>
+#include <Armorial/Common/Enums/Side/Side.h>
+
+#include <Armorial/Geometry/Angle/Angle.h>
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+#include <Armorial/Geometry/Transform2D/Transform2D.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace Common {
+namespace Types {
+    class Object;
+
+    /*!
+     * \brief The Types::WorldSnapshot class stores the state of every object in the field (ball and
+     * robots) in contiguous per-attribute arrays, so the whole world can be converted between the
+     * field frame and the canonical frame in a single pass.
+     *
+     * In the canonical frame our team always attacks towards +x, i.e. it looks like we are playing at
+     * the left side. When playing at the right side, the conversion is a rotation of the world by PI
+     * around the field center: positions, velocities and accelerations are negated and orientations
+     * are turned by PI. Negating is its own inverse, so the same pass converts the vectors back to
+     * the field frame. Turning by PI rounds in float, so the field frame orientations are also kept
+     * aside and restored from there; converting back and forth gives the exact original values.
+     */
+    class WorldSnapshot
+    {
+    public:
+        /*!
+         * \brief WorldSnapshot default constructor.
+         */
+        WorldSnapshot() = default;
+
+        /*!
+         * \brief Constructs an empty WorldSnapshot with room for the given number of objects.
+         * \param capacity The number of objects to reserve space for.
+         */
+        explicit WorldSnapshot(size_t capacity);
+
+        /*!
+         * \brief Appends an object to the snapshot, in the field frame.
+         * \param position, velocity, acceleration, orientation, angularSpeed The object data.
+         * \return The index of the object in the snapshot.
+         */
+        size_t add(const Geometry::Vector2D &position, const Geometry::Vector2D &velocity,
+                   const Geometry::Vector2D &acceleration = Geometry::Vector2D(),
+                   const Geometry::Angle &orientation = Geometry::Angle(), float angularSpeed = 0.0f);
+
+        /*!
+         * \brief Appends a copy of the given Types::Object state to the snapshot, in the field frame.
+         * \return The index of the object in the snapshot.
+         */
+        size_t add(const Object &object);
+
+        /*!
+         * \brief Removes all the objects from the snapshot and returns it to the field frame.
+         */
+        void clear();
+
+        /*!
+         * \return The number of objects in the snapshot.
+         */
+        size_t size() const;
+
+        /*!
+         * \brief Getters for the attributes of the object at the given index, in the current frame.
+         */
+        Geometry::Vector2D position(size_t index) const;
+        Geometry::Vector2D velocity(size_t index) const;
+        Geometry::Vector2D acceleration(size_t index) const;
+        Geometry::Angle orientation(size_t index) const;
+        float angularSpeed(size_t index) const;
+
+        /*!
+         * \brief Contiguous arrays with the attributes of all the objects, in the current frame.
+         */
+        const std::vector<Geometry::Vector2D>& positions() const;
+        const std::vector<Geometry::Vector2D>& velocities() const;
+        const std::vector<Geometry::Vector2D>& accelerations() const;
+        const std::vector<float>& orientations() const;
+        const std::vector<float>& angularSpeeds() const;
+
+        /*!
+         * \brief Converts the snapshot from the field frame to the canonical frame, given the side
+         * our team plays. Does nothing if it is already in the canonical frame.
+         * \param playSide The Side enum that indicates which is the side our team plays.
+         */
+        void toCanonical(const Enums::Side playSide);
+
+        /*!
+         * \brief Converts the snapshot back to the field frame. Does nothing if it is already in the
+         * field frame.
+         */
+        void toField();
+
+        /*!
+         * \return True if the snapshot holds mirrored (canonical frame, right side) data.
+         */
+        bool isMirrored() const;
+
+        /*!
+         * \return The transform that maps points computed in the current frame to the field frame,
+         * e.g. to send a target position computed from canonical data to a robot.
+         */
+        Geometry::Transform2D toFieldTransform() const;
+
+    private:
+        /*!
+         * \brief Rotates every object by PI around the field center.
+         */
+        void mirror();
+
+        std::vector<Geometry::Vector2D> _positions;
+        std::vector<Geometry::Vector2D> _velocities;
+        std::vector<Geometry::Vector2D> _accelerations;
+        std::vector<float> _orientations;
+        std::vector<float> _fieldOrientations;
+        std::vector<float> _angularSpeeds;
+        bool _mirrored = false;
+    };
+}
+}
+
+#endif // ARMORIAL_COMMON_TYPES_WORLDSNAPSHOT_H
@@ -1,11 +1,12 @@
 #ifndef ARMORIAL_GEOMETRY_ANGLE_H
 #define ARMORIAL_GEOMETRY_ANGLE_H
 
+#include <algorithm>
 #include <math.h>
 
 namespace Geometry {
     /*!
-     * \brief The Geometry::Angle class is a class that stores angles on the interval [-π, π) and allows
+     * \brief The Geometry::Angle class is a class that stores angles on the interval [-π, π] and allows
      * operations with angles.
      */
     class Angle
@@ -27,7 +28,7 @@ namespace Geometry {
          * \param angle The given float value of the angle. As it is normalized after you can give it
          * outside the range [-π, π].
          */
-        Angle(const float &angle = 0.0);
+        constexpr Angle(const float &angle = 0.0);
 
         /*!
          * \brief Compute the shortest direction to achieve the target angle from the actual angle.
@@ -66,7 +67,7 @@ namespace Geometry {
          * \return A new Angle instance that contains the result of the addition operation.
          * \note The resulted angle value will be normalized.
          */
-        Angle operator+(const Angle &other) const;
+        constexpr Angle operator+(const Angle &other) const;
 
         /*!
          * \brief Compute the subtraction operator between this Angle and other Angle instance.
@@ -74,7 +75,7 @@ namespace Geometry {
          * \return A new Angle instance that contains the result of the subtraction operation.
          * \note The resulted angle value will be normalized.
          */
-        Angle operator-(const Angle &other) const;
+        constexpr Angle operator-(const Angle &other) const;
 
         /*!
          * \brief Compute the addition equal operator between this Angle and other Angle instance.
@@ -82,7 +83,7 @@ namespace Geometry {
          * \return A new Angle instance that contains the result of the addition equal operation.
          * \note The resulted angle value will be normalized.
          */
-        Angle &operator+=(const Angle &other);
+        constexpr Angle &operator+=(const Angle &other);
 
         /*!
          * \brief Compute the subtration equal operator between this Angle and other Angle instance.
@@ -90,7 +91,7 @@ namespace Geometry {
          * \return A new Angle instance that contains the result of the subtration equal operation.
          * \note The resulted angle value will be normalized.
          */
-        Angle &operator-=(const Angle &other);
+        constexpr Angle &operator-=(const Angle &other);
 
         /*!
          * \brief Set the angle value using a scalar value.
@@ -98,23 +99,95 @@ namespace Geometry {
          * \return A new angle instance that contains the set angle value.
          * \note The set angle will be normalized.
          */
-        Angle &operator=(const float &scalar);
+        constexpr Angle &operator=(const float &scalar);
 
         /*!
          * \brief Get the actual value of angle for this Angle instance.
          * \return A float containing the value of the angle.
          */
-        float value() const;
+        constexpr float value() const;
     private:
         // Angle value
         float _angle;
 
         /*!
-         * \brief Compute the angle normalization to the range [-π, π).
+         * \brief Compute the angle normalization to the range [-π, π], in constant time.
          * \return A Angle instance that contains the normalized angle in the range.
          */
-        Angle normalize();
+        constexpr Angle normalize();
     };
+
+    constexpr Angle::Angle(const float &angle) : _angle(angle) {
+        normalize();
+    }
+
+    constexpr float Angle::value() const {
+        return _angle;
+    }
+
+    constexpr Angle Angle::normalize() {
+        // Remove the whole turns at once and wrap the remainder (in (-2π, 2π)) with selects, so the
+        // cost does not depend on the value. Values in [-π, π] (both ends included) are kept as they are
+        constexpr double turn = 2.0 * double(Geometry::Angle::PI);
+        constexpr double maxTurns = 1e15;
+        const double turns = _angle * (1.0 / turn);
+        const double wholeTurns = (turns > -maxTurns && turns < maxTurns) ? double((long long) turns) : 0.0;
+        double wrapped = _angle - wholeTurns * turn;
+        wrapped -= (wrapped > Geometry::Angle::PI) ? turn : 0.0;
+        wrapped += (wrapped < -Geometry::Angle::PI) ? turn : 0.0;
+        _angle = float(wrapped);
+
+        return *this;
+    }
+
+    inline Angle::Direction Angle::rotateDirection(const Angle &target) const {
+        float angleDiff = target.value() - this->value();
+        bool positive = (angleDiff >= 0.0);
+        bool large = fabs(angleDiff) >= Geometry::Angle::PI;
+
+        return Angle::Direction(positive ^ large);
+    }
+
+    inline float Angle::shortestAngleDiff(const Angle &target) const {
+        // Both values are in [-π, π], so the difference is in [-2π, 2π] and the shortest way around
+        // is either the difference itself or the rest of the turn
+        const float diff = fabs(target.value() - this->value());
+        return std::min(diff, 2 * Geometry::Angle::PI - diff);
+    }
+
+    inline bool Angle::operator==(const Angle &other) const {
+        return this->shortestAngleDiff(other) < 1e-4;
+    }
+
+    inline bool Angle::operator!=(const Angle &other) const {
+        return !(*this == other);
+    }
+
+    constexpr Angle Angle::operator+(const Angle &other) const {
+        return Angle(this->value() + other.value());
+    }
+
+    constexpr Angle Angle::operator-(const Angle &other) const {
+        return Angle(this->value() - other.value());
+    }
+
+    constexpr Angle &Angle::operator+=(const Angle &other) {
+        this->_angle += other.value();
+        this->normalize();
+        return *this;
+    }
+
+    constexpr Angle &Angle::operator-=(const Angle &other) {
+        this->_angle -= other.value();
+        this->normalize();
+        return *this;
+    }
+
+    constexpr Angle &Angle::operator=(const float &scalar) {
+        this->_angle = scalar;
+        this->normalize();
+        return *this;
+    }
 }
 
 #endif // ARMORIAL_GEOMETRY_ANGLE_H
@@ -0,0 +1,110 @@
+#ifndef ARMORIAL_GEOMETRY_ANGULARSWEEP_H
+#define ARMORIAL_GEOMETRY_ANGULARSWEEP_H
+
+#include <Armorial/Geometry/Angle/Angle.h>
+#include <Armorial/Geometry/Circle/Circle.h>
+#include <Armorial/Geometry/LineSegment/LineSegment.h>
+#include <Armorial/Geometry/Rotation2D/Rotation2D.h>
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Geometry {
+    /*!
+     * \brief The Geometry::AngularSweep class computes which parts of a target segment (e.g. their
+     * goal, between its posts) can be seen from an origin (e.g. a shooter position) past a set of
+     * circular obstacles (e.g. the robots), as angular intervals.
+     *
+     * Each obstacle casts its exact tangent shadow; the shadows are sorted by their start angle and
+     * swept once, in O(n log n). Obstacles entirely behind the target line (from the origin side) are
+     * ignored, and the ones crossing it cast their full shadow. An origin inside an obstacle sees
+     * nothing.
+     *
+     * An instance keeps its buffers between calls to compute(), so it can evaluate many origins per
+     * frame without allocating.
+     */
+    class AngularSweep
+    {
+    public:
+        /*!
+         * \brief A free angular interval.
+         * \param from, to The points of the target where the interval starts and ends.
+         * \param direction The direction from the origin that bisects the interval.
+         * \param width The angular width of the interval, in radians.
+         */
+        struct Interval {
+            Vector2D from;
+            Vector2D to;
+            Angle direction;
+            float width = 0.0f;
+        };
+
+        /*!
+         * \brief AngularSweep default constructor.
+         */
+        AngularSweep() = default;
+
+        /*!
+         * \brief Computes the free intervals of the target seen from the origin.
+         * \param origin The point the target is seen from.
+         * \param target The target segment.
+         * \param obstacles, count The obstacles.
+         * \return The free intervals, ordered from the target start to its end.
+         */
+        const std::vector<Interval>& compute(const Vector2D &origin, const LineSegment &target,
+                                             const Circle *obstacles, size_t count);
+        const std::vector<Interval>& compute(const Vector2D &origin, const LineSegment &target,
+                                             const std::vector<Circle> &obstacles);
+
+        /*!
+         * \return The free intervals found by the last call to compute().
+         */
+        [[nodiscard]] const std::vector<Interval>& intervals() const;
+
+        /*!
+         * \return The widest free interval found by the last call to compute(), or std::nullopt if
+         * the target is fully blocked.
+         */
+        [[nodiscard]] std::optional<Interval> largest() const;
+
+        /*!
+         * \return The point of the target that bisects the widest free interval, or std::nullopt if
+         * the target is fully blocked.
+         */
+        [[nodiscard]] std::optional<Vector2D> bestAimPoint() const;
+
+        /*!
+         * \return The total angular width of the free intervals found by the last call to compute().
+         */
+        [[nodiscard]] float freeWidth() const;
+
+    private:
+        /*!
+         * \return The interval between the given angles of the local frame.
+         */
+        Interval makeInterval(float from, float to) const;
+
+        /*!
+         * \return The point where the ray from the origin with the given direction meets the target.
+         */
+        Vector2D targetPoint(const Vector2D &direction) const;
+
+        /*!
+         * \return The direction of the given angle of the local frame.
+         */
+        Vector2D localDirection(float angle) const;
+
+        // The local frame is centered at the origin and its x axis bisects the target
+        Vector2D _origin;
+        Vector2D _targetStart;
+        Vector2D _targetEnd;
+        Rotation2D _frame;
+
+        std::vector<std::pair<float, float>> _shadows;
+        std::vector<Interval> _intervals;
+    };
+}
+
+#endif // ARMORIAL_GEOMETRY_ANGULARSWEEP_H
@@ -5,6 +5,7 @@
 #include <Armorial/Geometry/Circle/Circle.h>
 #include <Armorial/Geometry/Line/Line.h>
 #include <Armorial/Geometry/Angle/Angle.h>
+#include <Armorial/Utils/StaticVector/StaticVector.h>
 
 #include <math.h>
 
@@ -84,9 +85,9 @@ namespace Geometry {
         /*!
          * \brief Compute the points at which a given LineSegment intersects this Arc instance, if these points exists.
          * \param lineSegment The given LineSegment instance.
-         * \return A std::vector object containing the Vector2D points which defines the intersection points.
+         * \return A Utils::StaticVector object containing the Vector2D points which defines the intersection points.
          */
-        std::vector<Vector2D> intersectionWithLine(const LineSegment &lineSegment) const;
+        Utils::StaticVector<Vector2D, 2> intersectionWithLine(const LineSegment &lineSegment) const;
 
         /*!
          * \brief toString method that returns a QString object.
@@ -0,0 +1,83 @@
+#ifndef ARMORIAL_GEOMETRY_BATCH_H
+#define ARMORIAL_GEOMETRY_BATCH_H
+
+#include <Armorial/Geometry/Transform2D/Transform2D.h>
+
+#include <cstddef>
+
+namespace Geometry {
+/*!
+ * \brief The Geometry::Batch functions apply the Geometry::Vector2D operations to contiguous arrays
+ * of vectors (e.g. the candidate points sampled by a planner), using SSE or AVX2 instructions when
+ * the running CPU supports them. The results match the respective Vector2D operations as long as
+ * floating point contraction is disabled (-ffp-contract=off, as Armorial.pro builds), since otherwise
+ * the compiler may fuse the inline Vector2D operations into FMA instructions.
+ * \note The output array may be the same as an input array (in place), but it should not partially
+ * overlap one.
+ */
+namespace Batch {
+    /*!
+     * \brief Kernels available for the batch operations.
+     */
+    enum class Kernel { Scalar, SSE, AVX2 };
+
+    /*!
+     * \return The fastest kernel supported by the running CPU.
+     */
+    Kernel bestKernel();
+
+    /*!
+     * \return True if the given kernel is supported by the running CPU.
+     */
+    bool isKernelSupported(Kernel kernel);
+
+    /*!
+     * \brief Computes out[i] = a[i] + b[i] for each of the count vectors.
+     */
+    void add(const Vector2D *a, const Vector2D *b, Vector2D *out, size_t count, Kernel kernel = bestKernel());
+
+    /*!
+     * \brief Computes out[i] = v[i].scale(scalar) for each of the count vectors.
+     */
+    void scale(const Vector2D *v, float scalar, Vector2D *out, size_t count, Kernel kernel = bestKernel());
+
+    /*!
+     * \brief Computes out[i] = a[i].dotProduct(b[i]) for each of the count vectors.
+     */
+    void dot(const Vector2D *a, const Vector2D *b, float *out, size_t count, Kernel kernel = bestKernel());
+
+    /*!
+     * \brief Computes out[i] = v[i].length() for each of the count vectors.
+     */
+    void length(const Vector2D *v, float *out, size_t count, Kernel kernel = bestKernel());
+
+    /*!
+     * \brief Computes out[i] = v[i].dist(point) for each of the count vectors.
+     */
+    void dist(const Vector2D *v, const Vector2D &point, float *out, size_t count, Kernel kernel = bestKernel());
+
+    /*!
+     * \brief Computes out[i] = v[i].normalize() for each of the count vectors, where the zero
+     * vector stays zero.
+     */
+    void normalize(const Vector2D *v, Vector2D *out, size_t count, Kernel kernel = bestKernel());
+
+    /*!
+     * \brief Computes out[i] = v[i].rotate(radians) for each of the count vectors.
+     */
+    void rotate(const Vector2D *v, float radians, Vector2D *out, size_t count, Kernel kernel = bestKernel());
+
+    /*!
+     * \brief Computes out[i] = rotation.rotate(v[i]) for each of the count vectors.
+     */
+    void rotate(const Vector2D *v, const Rotation2D &rotation, Vector2D *out, size_t count, Kernel kernel = bestKernel());
+
+    /*!
+     * \brief Computes out[i] = transform.apply(v[i]) for each of the count vectors.
+     */
+    void transform(const Vector2D *v, const Transform2D &transform, Vector2D *out, size_t count,
+                   Kernel kernel = bestKernel());
+}
+}
+
+#endif // ARMORIAL_GEOMETRY_BATCH_H
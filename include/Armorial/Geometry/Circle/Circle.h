@@ -3,6 +3,7 @@
 
 #include <Armorial/Geometry/Line/Line.h>
 #include <Armorial/Geometry/LineSegment/LineSegment.h>
+#include <Armorial/Utils/StaticVector/StaticVector.h>
 
 #include <vector>
 #include <QString>
@@ -14,14 +15,14 @@ namespace Geometry {
         /*!
          * \brief Construct a Circle instance with center at (0, 0) and radius 1.0
          */
-        Circle();
+        constexpr Circle();
 
         /*!
          * \brief Construct a Circle instance with given center and radius.
          * \param center The given center.
          * \param radius The given radius.
          */
-        Circle(const Vector2D &center, const float &radius);
+        constexpr Circle(const Vector2D &center, const float &radius);
 
         /*!
          * \brief Default copy constructor
@@ -32,13 +33,13 @@ namespace Geometry {
          * \brief Get the center of this Circle instance.
          * \return A Vector2D instance containing the center coordinates of this Circle instance.
          */
-        [[nodiscard]] Vector2D center() const;
+        [[nodiscard]] constexpr Vector2D center() const;
 
         /*!
          * \brief Get the radius of this Circle instance.
          * \return A float value containing the radius of this Circle.
          */
-        [[nodiscard]] float radius() const;
+        [[nodiscard]] constexpr float radius() const;
 
         /*!
          * \brief Compute the intersection of the Circle instance with the Line instance.
@@ -46,7 +47,7 @@ namespace Geometry {
          * \return A vector of points where this Circle intersects with the Line or
          * an empty vector of points if this Circle does not intersect with the Line.
          */
-        [[nodiscard]] std::vector<Vector2D> intersects(const LineSegment& line_segment) const;
+        [[nodiscard]] Utils::StaticVector<Vector2D, 2> intersects(const LineSegment& line_segment) const;
 
         /*!
          * \brief Check if this Circle contains a given point.
@@ -73,7 +74,7 @@ namespace Geometry {
          * \brief Move this Circle center coordinates by a given amount.
          * \param amount The given amount.
          */
-        void move(const Vector2D& amount);
+        constexpr void move(const Vector2D& amount);
 
         /*!
          * \brief Check if two given Circle instances are equal comparing their center coordinates and radius.
@@ -94,10 +95,10 @@ namespace Geometry {
          * \param other The given Vector2D instance.
          * \return A Circle instance that contains the result of the operation.
          */
-        Circle operator+(const Vector2D& other) const;
-        Circle operator-(const Vector2D& other) const;
-        Circle operator+=(const Vector2D& other);
-        Circle operator-=(const Vector2D& other);
+        constexpr Circle operator+(const Vector2D& other) const;
+        constexpr Circle operator-(const Vector2D& other) const;
+        constexpr Circle operator+=(const Vector2D& other);
+        constexpr Circle operator-=(const Vector2D& other);
 
         /*!
          * \brief Compute a scale operation of this Circle instance by scaling the radius by a given float value.
@@ -125,6 +126,60 @@ namespace Geometry {
         Vector2D _center;
         float _radius;
     };
+
+    constexpr Circle::Circle() : _center(0.0f, 0.0f), _radius(1.0f) {
+    }
+
+    constexpr Circle::Circle(const Vector2D &center, const float &radius) : _center(center), _radius(radius) {
+    }
+
+    constexpr Vector2D Circle::center() const {
+        return _center;
+    }
+
+    constexpr float Circle::radius() const {
+        return _radius;
+    }
+
+    inline bool Circle::contains(const Vector2D &other) const {
+        return (fabs((center() - other).length()) <= radius());
+    }
+
+    constexpr void Circle::move(const Vector2D &amount) {
+        this->_center += amount;
+    }
+
+    constexpr Circle Circle::operator+(const Vector2D &other) const {
+        return Circle(center() + other, radius());
+    }
+
+    constexpr Circle Circle::operator-(const Vector2D &other) const {
+        return Circle(center() - other, radius());
+    }
+
+    constexpr Circle Circle::operator+=(const Vector2D &other) {
+        return Circle(_center += other, radius());
+    }
+
+    constexpr Circle Circle::operator-=(const Vector2D &other) {
+        return Circle(_center -= other, radius());
+    }
+
+    inline Circle Circle::operator*(const float &scale) const {
+        return Circle(center(), radius() * fabs(scale));
+    }
+
+    inline Circle Circle::operator/(const float &scale) const {
+        return Circle(center(), radius() / fabs(scale));
+    }
+
+    inline Circle Circle::operator*=(const float &scale) {
+        return Circle(center(), _radius *= fabs(scale));
+    }
+
+    inline Circle Circle::operator/=(const float &scale) {
+        return Circle(center(), _radius /= fabs(scale));
+    }
 }
 
 #endif // CIRCLE_H
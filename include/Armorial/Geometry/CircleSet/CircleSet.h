@@ -0,0 +1,97 @@
+#ifndef ARMORIAL_GEOMETRY_CIRCLESET_H
+#define ARMORIAL_GEOMETRY_CIRCLESET_H
+
+#include <Armorial/Geometry/Batch/Batch.h>
+#include <Armorial/Geometry/Circle/Circle.h>
+#include <Armorial/Geometry/LineSegment/LineSegment.h>
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace Geometry {
+    /*!
+     * \brief The Geometry::CircleSet class stores a set of circles (e.g. the robots in the field) in
+     * contiguous per-coordinate arrays, and tests line segments (e.g. pass lanes) against all of them
+     * at once, using SSE or AVX2 instructions when the running CPU supports them.
+     *
+     * Each circle may have a radius that grows along the segment, to account for how much an
+     * opponent can move while the ball travels: the point at a distance s from the segment start is
+     * blocked if it is within radius + radiusGrowth * s of the circle center.
+     */
+    class CircleSet
+    {
+    public:
+        /*!
+         * \brief The result of testing a segment against the set.
+         * \param blocked True if any circle intersects the segment.
+         * \param index The index of the intersecting circle the segment enters first.
+         * \param distance The distance from the segment start to the point where it enters that circle.
+         */
+        struct Obstruction {
+            bool blocked = false;
+            size_t index = 0;
+            float distance = std::numeric_limits<float>::infinity();
+        };
+
+        /*!
+         * \brief CircleSet default constructor, which builds an empty set.
+         */
+        CircleSet() = default;
+
+        /*!
+         * \brief Constructs a CircleSet instance with the given circles, with fixed radii.
+         */
+        explicit CircleSet(const std::vector<Circle> &circles);
+
+        /*!
+         * \brief Appends a circle to the set.
+         * \param circle The circle to add.
+         * \param radiusGrowth How much the radius grows per unit of distance along a tested segment.
+         * \return The index of the circle in the set.
+         */
+        size_t add(const Circle &circle, float radiusGrowth = 0.0f);
+
+        /*!
+         * \brief Removes all the circles, keeping the allocated storage.
+         */
+        void clear();
+
+        /*!
+         * \return The number of circles in the set.
+         */
+        [[nodiscard]] size_t size() const;
+
+        /*!
+         * \return The circle at the given index, with its radius at the segment start.
+         */
+        [[nodiscard]] Circle circle(size_t index) const;
+
+        /*!
+         * \return True if any circle of the set intersects the given segment. With fixed radii, this
+         * is the same as calling Circle::doesIntersect() for each circle.
+         */
+        [[nodiscard]] bool isBlocked(const LineSegment &segment, Batch::Kernel kernel = Batch::bestKernel()) const;
+
+        /*!
+         * \return The obstruction of the given segment by the circles of the set.
+         */
+        [[nodiscard]] Obstruction obstruction(const LineSegment &segment, Batch::Kernel kernel = Batch::bestKernel()) const;
+
+        /*!
+         * \brief Computes out[i] = obstruction(segments[i]) for each of the count segments.
+         */
+        void obstructions(const LineSegment *segments, Obstruction *out, size_t count,
+                          Batch::Kernel kernel = Batch::bestKernel()) const;
+
+    private:
+        std::vector<float> _xs;
+        std::vector<float> _ys;
+        std::vector<float> _radii;
+        std::vector<float> _radiusGrowths;
+        // Derived from the radius growths, where the test of each circle is made along a segment
+        std::vector<float> _growthSlopes;
+    };
+}
+
+#endif // ARMORIAL_GEOMETRY_CIRCLESET_H
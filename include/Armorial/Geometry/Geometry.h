@@ -2,12 +2,21 @@
 #define ARMORIAL_GEOMETRY_H
 
 #include "Angle/Angle.h"
+#include "AngularSweep/AngularSweep.h"
 #include "Arc/Arc.h"
+#include "Batch/Batch.h"
 #include "Circle/Circle.h"
+#include "CircleSet/CircleSet.h"
+#include "KDTree/KDTree.h"
 #include "Line/Line.h"
 #include "LineSegment/LineSegment.h"
 #include "Polygon/Polygon.h"
+#include "PreparedPolygon/PreparedPolygon.h"
 #include "Rectangle/Rectangle.h"
+#include "Rotation2D/Rotation2D.h"
+#include "SweepAndPrune/SweepAndPrune.h"
+#include "SweptCircle/SweptCircle.h"
+#include "Transform2D/Transform2D.h"
 #include "Triangle/Triangle.h"
 #include "Vector2D/Vector2D.h"
 
@@ -0,0 +1,106 @@
+#ifndef ARMORIAL_GEOMETRY_KDTREE_H
+#define ARMORIAL_GEOMETRY_KDTREE_H
+
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+#include <Armorial/Geometry/Rectangle/Rectangle.h>
+#include <Armorial/Geometry/Polygon/Polygon.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace Geometry {
+    /*!
+     * \brief The Geometry::KDTree class provides a spatial index over a set of points (e.g. the
+     * robots in the field or the candidates sampled by a planner), answering nearest neighbour and
+     * range queries without testing every point.
+     *
+     * The tree is implicit (stored as the reordered points, split at the median of the widest axis),
+     * so it is meant to be rebuilt every frame with build(), which reuses the allocated storage.
+     * Queries return the indices the points had in the array given to build().
+     */
+    class KDTree
+    {
+    public:
+        /*!
+         * \brief KDTree default constructor, which builds an empty tree.
+         */
+        KDTree() = default;
+
+        /*!
+         * \brief Constructs a KDTree instance over the given points.
+         */
+        explicit KDTree(const std::vector<Vector2D> &points);
+
+        /*!
+         * \brief Rebuilds this tree over the given points.
+         */
+        void build(const std::vector<Vector2D> &points);
+        void build(const Vector2D *points, size_t count);
+
+        /*!
+         * \return The number of indexed points.
+         */
+        [[nodiscard]] size_t size() const;
+
+        /*!
+         * \return True if this tree holds no points.
+         */
+        [[nodiscard]] bool empty() const;
+
+        /*!
+         * \param query The point to search from.
+         * \return The index of the point nearest to query, or std::nullopt if the tree is empty.
+         */
+        [[nodiscard]] std::optional<size_t> nearest(const Vector2D &query) const;
+
+        /*!
+         * \param query The point to search from.
+         * \param k The number of points to find.
+         * \return The indices of the min(k, size()) points nearest to query, sorted by distance.
+         */
+        [[nodiscard]] std::vector<size_t> kNearest(const Vector2D &query, size_t k) const;
+
+        /*!
+         * \return The indices of the points at most radius away from center, in no particular order.
+         */
+        [[nodiscard]] std::vector<size_t> withinRadius(const Vector2D &center, float radius) const;
+
+        /*!
+         * \return The indices of the points the given rectangle contains, in no particular order.
+         */
+        [[nodiscard]] std::vector<size_t> inRectangle(const Rectangle &rectangle) const;
+
+        /*!
+         * \return The indices of the points the given polygon contains, in no particular order.
+         */
+        [[nodiscard]] std::vector<size_t> inPolygon(const Polygon &polygon) const;
+
+    private:
+        struct Entry {
+            Vector2D point;
+            size_t index;
+        };
+
+        /*!
+         * \brief Ranges with up to LeafSize points are not split, and are searched linearly.
+         */
+        static constexpr size_t LeafSize = 8;
+
+        void buildRange(size_t begin, size_t end);
+
+        template<typename Visitor>
+        void visitBox(size_t begin, size_t end, float minX, float maxX, float minY, float maxY, Visitor &visitor) const;
+
+        void searchNearest(size_t begin, size_t end, const Vector2D &query, float &bestDistance, size_t &best) const;
+
+        void searchNearest(size_t begin, size_t end, const Vector2D &query, size_t k,
+                           std::vector<std::pair<float, size_t>> &heap) const;
+
+        std::vector<Entry> _entries;
+        // Split axis of each internal node, stored at the position of its median (0 for x, 1 for y)
+        std::vector<unsigned char> _axes;
+    };
+}
+
+#endif // ARMORIAL_GEOMETRY_KDTREE_H
@@ -82,6 +82,17 @@ namespace Geometry {
         Vector2D _p1; // One of the points located on the Line
         Vector2D _p2; // Another of the points located on the Line, _p2 != _p1
     };
+
+    inline float Line::distanceToLine(const Vector2D &point) const {
+        return (project(point) - point).length();
+    }
+
+    inline Vector2D Line::project(const Vector2D &point) const {
+        Vector2D ab = _p2 - _p1;
+        Vector2D ap = point - _p1;
+
+        return _p1 + ab * (ap.dotProduct(ab) / pow(ab.length(), 2));
+    }
 }
 
 #endif // LINE_H
@@ -25,7 +25,7 @@ namespace Geometry {
          * \param start The given start coordinate.
          * \param end The given end coordinate.
          */
-        LineSegment(const Vector2D &start, const Vector2D &end);
+        constexpr LineSegment(const Vector2D &start, const Vector2D &end);
 
         /*!
          * \brief Default LineSegment copy constructor.
@@ -35,12 +35,12 @@ namespace Geometry {
         /*!
          * \return The start position of this LineSegment instance.
          */
-        [[nodiscard]] Vector2D start() const;
+        [[nodiscard]] constexpr Vector2D start() const;
 
         /*!
          * \return The end position of this LineSegment instance.
          */
-        [[nodiscard]] Vector2D end() const;
+        [[nodiscard]] constexpr Vector2D end() const;
 
         /*!
          * \brief Computes the length of this LineSegment instance.
@@ -52,7 +52,7 @@ namespace Geometry {
          * \brief Computes the length2 of this LineSegment instance.
          * \return A float value containing the length2 of this LineSegment instance.
          */
-        [[nodiscard]] float length2() const;
+        [[nodiscard]] constexpr float length2() const;
 
         /*!
          * \brief Check if this LineSegment instance is a point, i.e. it start and end points are the same.
@@ -108,13 +108,13 @@ namespace Geometry {
          * \brief Computes the direction vector.
          * \return A Vector2D instance that represents the direction in which this LineSegment instance points.
          */
-        [[nodiscard]] Vector2D direction() const;
+        [[nodiscard]] constexpr Vector2D direction() const;
 
         /*!
          * \brief Move the line start and end points by a given Vector2D instance.
          * \param amount The given Vector2D instance.
          */
-        void move(const Vector2D &amount);
+        constexpr void move(const Vector2D &amount);
 
         /*!
          * \brief Computes the rotation of this LineSegment instance around the pivot by a given angle.
@@ -154,6 +154,38 @@ namespace Geometry {
         Vector2D _start;
         Vector2D _end;
     };
+
+    constexpr LineSegment::LineSegment(const Vector2D &start, const Vector2D &end) : _start(start), _end(end) {
+    }
+
+    constexpr Vector2D LineSegment::start() const {
+        return _start;
+    }
+
+    constexpr Vector2D LineSegment::end() const {
+        return _end;
+    }
+
+    inline float LineSegment::length() const {
+        return (end() - start()).length();
+    }
+
+    constexpr float LineSegment::length2() const {
+        return (end() - start()).length2();
+    }
+
+    inline bool LineSegment::isPoint() const {
+        return (start() == end());
+    }
+
+    constexpr Vector2D LineSegment::direction() const {
+        return (end() - start());
+    }
+
+    constexpr void LineSegment::move(const Vector2D &amount) {
+        _start += amount;
+        _end += amount;
+    }
 }
 
 #endif // ARMORIAL_GEOMETRY_LINESEGMENT_H
@@ -3,6 +3,7 @@
 
 #include <Armorial/Geometry/Vector2D/Vector2D.h>
 #include <Armorial/Geometry/LineSegment/LineSegment.h>
+#include <Armorial/Geometry/Circle/Circle.h>
 
 namespace Geometry {
     /*!
@@ -63,6 +64,11 @@ namespace Geometry {
          */
         [[nodiscard]] size_t amountOfVertices() const;
 
+        /*!
+         * \return The boundary line segment from the vertex at the given index to the next one.
+         */
+        [[nodiscard]] LineSegment edge(const size_t &id) const;
+
         /*!
          * \return A list that contains all the line segments that forms the boundary.
          */
@@ -79,6 +85,22 @@ namespace Geometry {
          */
         [[nodiscard]] bool isConvex() const;
 
+        /*!
+         * \brief Checks if the given counter-clockwise vertices are in strictly increasing angle around the
+         * first one and go around the boundary a single time. isConvex() only compares the signs of the turns,
+         * so it also accepts self-intersecting stars: both checks are needed for a simple convex polygon.
+         * \param fan The given vertices, in counter-clockwise order.
+         * \return True if the vertices pass the check and False otherwise.
+         */
+        [[nodiscard]] static bool isConvexFan(const std::vector<Vector2D> &fan);
+
+        /*!
+         * \brief Computes the cross product of (a - origin) and (b - origin).
+         * \return A positive value if origin, a and b turn counter-clockwise, a negative value if they turn
+         * clockwise and zero if they are collinear.
+         */
+        [[nodiscard]] static float orientation(const Vector2D &origin, const Vector2D &a, const Vector2D &b);
+
         /*!
          * \brief Check if this polygon contains a given point.
          * \param point The given point.
@@ -121,6 +143,42 @@ namespace Geometry {
          */
         bool isSimple() const;
 
+        /*!
+         * \brief Computes the convex hull of a given set of points using the monotone chain algorithm, in O(n log n).
+         * \param points The given points.
+         * \return The convex hull, with its vertices in counter-clockwise order and without collinear vertices.
+         */
+        [[nodiscard]] static Polygon convexHull(std::vector<Vector2D> points);
+
+        /*!
+         * \brief Moves the boundary of this polygon outwards (positive distance) or inwards (negative distance).
+         * Corners that grow are rounded with arcs that circumscribe the exact circle, so an inflated polygon always
+         * contains the exact result; corners that shrink are mitered.
+         * \param distance The given offset distance.
+         * \param arcSegments The amount of segments a full circle would be approximated with.
+         * \return The offset polygon, with its vertices in counter-clockwise order.
+         * \note Convex polygons are shrunk exactly. For concave polygons the result may self-intersect when the
+         * distance is large compared to their edges.
+         */
+        [[nodiscard]] Polygon offset(const float &distance, const size_t &arcSegments = 16) const;
+
+        /*!
+         * \brief Computes the Minkowski sum of this polygon with a given disk, i.e. this polygon inflated by the
+         * disk radius and moved by its center (e.g. an obstacle inflated by the robot radius).
+         * \param disk The given disk.
+         * \param arcSegments The amount of segments the disk is approximated with.
+         * \return The Minkowski sum polygon, see \ref offset.
+         */
+        [[nodiscard]] Polygon minkowskiSum(const Circle &disk, const size_t &arcSegments = 16) const;
+
+        /*!
+         * \brief Clips this polygon by a given convex polygon using the Sutherland-Hodgman algorithm.
+         * \param convexClipper The given convex polygon, with its vertices in any orientation.
+         * \return The part of this polygon that is inside the given one, with the orientation of this polygon, or an
+         * empty polygon if there is none.
+         */
+        [[nodiscard]] Polygon clip(const Polygon &convexClipper) const;
+
         /*!
          * \brief toString method that returns a QString object.
          * \return The Vertices Points.
@@ -136,6 +194,10 @@ namespace Geometry {
     private:
         std::vector<Vector2D> _vertices;
     };
+
+    inline float Polygon::orientation(const Vector2D &origin, const Vector2D &a, const Vector2D &b) {
+        return (a.x() - origin.x()) * (b.y() - origin.y()) - (a.y() - origin.y()) * (b.x() - origin.x());
+    }
 }
 
 #endif // ARMORIAL_GEOMETRY_POLYGON_H
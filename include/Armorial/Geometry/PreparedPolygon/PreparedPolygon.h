@@ -0,0 +1,108 @@
+#ifndef ARMORIAL_GEOMETRY_PREPAREDPOLYGON_H
+#define ARMORIAL_GEOMETRY_PREPAREDPOLYGON_H
+
+#include <Armorial/Geometry/Polygon/Polygon.h>
+#include <Armorial/Geometry/Rectangle/Rectangle.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace Geometry {
+    /*!
+     * \brief The Geometry::PreparedPolygon class holds an immutable copy of a Geometry::Polygon with
+     * the data its queries need precomputed, for polygons that are tested many times (e.g. obstacles
+     * and zones checked against every planner candidate).
+     *
+     * It caches the bounding box (to reject far points and segments), the edges and the coefficients
+     * of the crossing test, as well as the area, perimeter and centroid. Convex polygons are tested
+     * with a binary search over the wedges around their first vertex, in O(log n); self-intersecting
+     * polygons (e.g. stars, which Polygon::isConvex() accepts) use the crossing test.
+     * \note Points exactly on the boundary may be classified either way, as in Polygon::contains().
+     */
+    class PreparedPolygon
+    {
+    public:
+        /*!
+         * \brief PreparedPolygon default constructor, which holds an empty polygon.
+         */
+        PreparedPolygon() = default;
+
+        /*!
+         * \brief Constructs a PreparedPolygon instance from the given polygon.
+         */
+        explicit PreparedPolygon(const Polygon &polygon);
+
+        /*!
+         * \return The polygon this instance was prepared from.
+         */
+        [[nodiscard]] const Polygon& polygon() const;
+
+        /*!
+         * \return The smallest axis-aligned rectangle that contains the polygon.
+         */
+        [[nodiscard]] const Rectangle& boundingBox() const;
+
+        /*!
+         * \return The cached results of the respective Polygon methods.
+         */
+        [[nodiscard]] float area() const;
+        [[nodiscard]] float perimeterLength() const;
+        [[nodiscard]] const Vector2D& centroid() const;
+        [[nodiscard]] bool isConvex() const;
+
+        /*!
+         * \brief Check if this polygon contains a given point.
+         * \param point The given point.
+         * \return True if this polygon contains the given point and False otherwise.
+         */
+        [[nodiscard]] bool contains(const Vector2D &point) const;
+
+        /*!
+         * \brief Computes out[i] = contains(points[i]) for each of the count points.
+         */
+        void contains(const Vector2D *points, bool *out, size_t count) const;
+
+        /*!
+         * \brief Check if the boundary of this polygon contains a given point.
+         * \param point The given point.
+         * \return True if the boundary of this polygon contains the given point and False otherwise.
+         */
+        [[nodiscard]] bool isOnBoundary(const Vector2D &point) const;
+
+        /*!
+         * \brief Check if this polygon boundary intersects a given line segment.
+         * \param lineSegment The given line segment.
+         * \return True if this polygon intersects a given line segment and False otherwise.
+         */
+        [[nodiscard]] bool doesIntersect(const LineSegment &lineSegment) const;
+
+    private:
+        /*!
+         * \brief The crossing test terms of an edge: the x coordinate where it crosses the height y
+         * is x + slope * (y - y1), for y between y1 and y2.
+         */
+        struct Edge {
+            float x, y1, y2, slope;
+        };
+
+        [[nodiscard]] bool insideBoundingBox(const Vector2D &point) const;
+        [[nodiscard]] bool crossingTest(const Vector2D &point) const;
+        [[nodiscard]] bool wedgeTest(const Vector2D &point) const;
+
+        Polygon _polygon;
+        Rectangle _boundingBox;
+        float _minX = 0.0f, _maxX = 0.0f, _minY = 0.0f, _maxY = 0.0f;
+
+        float _area = 0.0f;
+        float _perimeterLength = 0.0f;
+        Vector2D _centroid;
+        bool _convex = false;
+
+        std::vector<LineSegment> _boundary;
+        std::vector<Edge> _edges;
+        // Vertices in counter-clockwise order, filled for convex polygons only
+        std::vector<Vector2D> _fan;
+    };
+}
+
+#endif // ARMORIAL_GEOMETRY_PREPAREDPOLYGON_H
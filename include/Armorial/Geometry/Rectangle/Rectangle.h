@@ -3,6 +3,7 @@
 
 #include <Armorial/Geometry/Vector2D/Vector2D.h>
 #include <Armorial/Geometry/LineSegment/LineSegment.h>
+#include <Armorial/Utils/StaticVector/StaticVector.h>
 
 #include <Armorial/Common/Types/Traits/Traits.h>
 
@@ -117,7 +118,7 @@ namespace Geometry {
         /*!
          * \return Returns a list of LineSegment instances containig all the boundary line segments of this Rectangle.
          */
-        std::vector<LineSegment> boundary() const;
+        Utils::StaticVector<LineSegment, 4> boundary() const;
 
         /*!
          * \brief Check if two Rectangles instances have the same corners.
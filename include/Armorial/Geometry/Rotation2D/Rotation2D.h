@@ -0,0 +1,131 @@
+#ifndef ARMORIAL_GEOMETRY_ROTATION2D_H
+#define ARMORIAL_GEOMETRY_ROTATION2D_H
+
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+
+#include <cmath>
+#include <cstddef>
+
+namespace Geometry {
+    /*!
+     * \brief The Geometry::Rotation2D class stores a rotation of the plane as the pair (cos, sin) of
+     * its angle (a unit complex number). The trigonometric functions are evaluated once, when the
+     * rotation is created, so rotating many points (e.g. the vertices of a robot footprint) or
+     * composing rotations only takes multiplications.
+     */
+    class Rotation2D
+    {
+    public:
+        /*!
+         * \brief Creates the identity rotation.
+         */
+        constexpr Rotation2D();
+
+        /*!
+         * \brief Creates the rotation by the given angle.
+         * \param angle The angle of the rotation, where positive angles rotate counter-clockwise.
+         */
+        explicit Rotation2D(const Angle &angle);
+
+        /*!
+         * \brief Creates the rotation that takes the x-axis to the given direction.
+         * \param direction The given direction, which is normalized (the zero vector gives the identity).
+         */
+        static Rotation2D fromDirection(const Vector2D &direction);
+
+        /*!
+         * \return The cosine and the sine of the rotation angle.
+         */
+        [[nodiscard]] constexpr float cos() const;
+        [[nodiscard]] constexpr float sin() const;
+
+        /*!
+         * \return The angle of this rotation.
+         */
+        [[nodiscard]] Angle angle() const;
+
+        /*!
+         * \return The rotation by the opposite angle.
+         */
+        [[nodiscard]] constexpr Rotation2D inverse() const;
+
+        /*!
+         * \return A copy of this rotation with (cos, sin) scaled back to unit length, which removes the
+         * rounding errors accumulated by long chains of compositions.
+         */
+        [[nodiscard]] Rotation2D normalized() const;
+
+        /*!
+         * \return The given vector rotated around the origin.
+         */
+        [[nodiscard]] constexpr Vector2D rotate(const Vector2D &vector) const;
+
+        /*!
+         * \return The given point rotated around the given pivot.
+         */
+        [[nodiscard]] constexpr Vector2D rotateAround(const Vector2D &point, const Vector2D &pivot) const;
+
+        /*!
+         * \brief Rotates an array of vectors around the origin, using the Geometry::Batch kernels.
+         * \param vectors, out The input and output arrays, which may be the same.
+         * \param count The number of vectors.
+         */
+        void rotate(const Vector2D *vectors, Vector2D *out, size_t count) const;
+
+        /*!
+         * \return The composition of this rotation with other, which rotates by other first.
+         */
+        [[nodiscard]] constexpr Rotation2D operator*(const Rotation2D &other) const;
+
+        /*!
+         * \return The given vector rotated around the origin.
+         */
+        [[nodiscard]] constexpr Vector2D operator*(const Vector2D &vector) const;
+
+    private:
+        constexpr Rotation2D(float c, float s);
+
+        float _cos;
+        float _sin;
+    };
+
+    constexpr Rotation2D::Rotation2D() : _cos(1.0f), _sin(0.0f) {
+    }
+
+    constexpr Rotation2D::Rotation2D(float c, float s) : _cos(c), _sin(s) {
+    }
+
+    inline Rotation2D::Rotation2D(const Angle &angle) : _cos(std::cos(angle.value())), _sin(std::sin(angle.value())) {
+    }
+
+    constexpr float Rotation2D::cos() const {
+        return _cos;
+    }
+
+    constexpr float Rotation2D::sin() const {
+        return _sin;
+    }
+
+    constexpr Rotation2D Rotation2D::inverse() const {
+        return Rotation2D(_cos, -_sin);
+    }
+
+    constexpr Vector2D Rotation2D::rotate(const Vector2D &vector) const {
+        return Vector2D(vector.x() * _cos - vector.y() * _sin, vector.x() * _sin + vector.y() * _cos);
+    }
+
+    constexpr Vector2D Rotation2D::rotateAround(const Vector2D &point, const Vector2D &pivot) const {
+        return rotate(point - pivot) + pivot;
+    }
+
+    constexpr Rotation2D Rotation2D::operator*(const Rotation2D &other) const {
+        // Product of the unit complex numbers, which adds the angles
+        return Rotation2D(_cos * other._cos - _sin * other._sin, _sin * other._cos + _cos * other._sin);
+    }
+
+    constexpr Vector2D Rotation2D::operator*(const Vector2D &vector) const {
+        return rotate(vector);
+    }
+}
+
+#endif // ARMORIAL_GEOMETRY_ROTATION2D_H
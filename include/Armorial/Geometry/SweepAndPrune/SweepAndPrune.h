@@ -0,0 +1,73 @@
+#ifndef ARMORIAL_GEOMETRY_SWEEPANDPRUNE_H
+#define ARMORIAL_GEOMETRY_SWEEPANDPRUNE_H
+
+#include <Armorial/Geometry/SweptCircle/SweptCircle.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace Geometry {
+    /*!
+     * \brief The Geometry::SweepAndPrune class finds all the pairs of a set of swept circles (e.g. all
+     * the robots in the field) that collide within a time horizon.
+     *
+     * The broadphase sorts the boxes that bound each circle over the horizon by their left side and
+     * sweeps them, so that only pairs whose boxes overlap reach the exact SweptCircle::collisionTime()
+     * test. The buffers are kept between updates.
+     */
+    class SweepAndPrune
+    {
+    public:
+        /*!
+         * \brief A collision between two circles of the set.
+         * \param first, second The indices of the circles, first < second.
+         * \param time The earliest time at which they touch.
+         */
+        struct Collision {
+            size_t first;
+            size_t second;
+            float time;
+        };
+
+        /*!
+         * \brief SweepAndPrune default constructor.
+         */
+        SweepAndPrune() = default;
+
+        /*!
+         * \brief Finds the collisions of the given swept circles.
+         * \param circles The given swept circles.
+         * \param horizon The last time to consider.
+         * \return The collisions within the horizon, sorted by time.
+         */
+        const std::vector<Collision>& update(const std::vector<SweptCircle> &circles, const float &horizon);
+
+        /*!
+         * \return The collisions found by the last update, sorted by time.
+         */
+        [[nodiscard]] const std::vector<Collision>& collisions() const;
+
+        /*!
+         * \return The earliest collision found by the last update, or std::nullopt if there is none.
+         */
+        [[nodiscard]] std::optional<Collision> earliest() const;
+
+        /*!
+         * \return The amount of pairs that passed the broadphase in the last update.
+         */
+        [[nodiscard]] size_t candidates() const;
+
+    private:
+        struct Bounds {
+            float minX, maxX, minY, maxY;
+        };
+
+        std::vector<Bounds> _bounds;
+        std::vector<size_t> _order;
+        std::vector<Collision> _collisions;
+        size_t _candidates = 0;
+    };
+}
+
+#endif // ARMORIAL_GEOMETRY_SWEEPANDPRUNE_H
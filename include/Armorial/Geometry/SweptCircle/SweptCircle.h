@@ -0,0 +1,87 @@
+#ifndef ARMORIAL_GEOMETRY_SWEPTCIRCLE_H
+#define ARMORIAL_GEOMETRY_SWEPTCIRCLE_H
+
+#include <Armorial/Geometry/Circle/Circle.h>
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+
+#include <optional>
+
+namespace Geometry {
+    /*!
+     * \brief The Geometry::SweptCircle class describes a circle moving with constant velocity (e.g. a
+     * robot between two frames), whose center at time t is center + velocity * t. Unlike testing the
+     * circles of each frame, the continuous tests below do not miss fast objects that pass through
+     * each other between frames.
+     */
+    class SweptCircle
+    {
+    public:
+        /*!
+         * \brief Construct a SweptCircle instance with the given circle at time 0 and velocity.
+         */
+        constexpr SweptCircle(const Circle &circle, const Vector2D &velocity);
+
+        /*!
+         * \return The circle at time 0.
+         */
+        [[nodiscard]] constexpr const Circle& circle() const;
+
+        /*!
+         * \return The velocity of the circle.
+         */
+        [[nodiscard]] constexpr const Vector2D& velocity() const;
+
+        /*!
+         * \return The circle at the given time.
+         */
+        [[nodiscard]] constexpr Circle at(const float &time) const;
+
+        /*!
+         * \brief Computes the time at which the centers of this and a given swept circle are the closest.
+         * \param other The given swept circle.
+         * \return The time of closest approach, which is negative if they are moving apart and 0 if
+         * they have the same velocity.
+         */
+        [[nodiscard]] float timeOfClosestApproach(const SweptCircle &other) const;
+
+        /*!
+         * \return The distance between the centers of this and a given swept circle at the given time.
+         */
+        [[nodiscard]] float distanceAt(const SweptCircle &other, const float &time) const;
+
+        /*!
+         * \brief Computes the earliest time at which this and a given swept circle touch.
+         * \param other The given swept circle.
+         * \param horizon The last time to consider.
+         * \return The collision time in [0, horizon], 0 if they already overlap, or std::nullopt if they
+         * do not touch until the horizon.
+         */
+        [[nodiscard]] std::optional<float> collisionTime(const SweptCircle &other, const float &horizon) const;
+
+        /*!
+         * \brief Computes the earliest time at which this swept circle touches a given static circle.
+         * \see collisionTime(const SweptCircle&, const float&)
+         */
+        [[nodiscard]] std::optional<float> collisionTime(const Circle &other, const float &horizon) const;
+
+    private:
+        Circle _circle;
+        Vector2D _velocity;
+    };
+
+    constexpr SweptCircle::SweptCircle(const Circle &circle, const Vector2D &velocity) : _circle(circle), _velocity(velocity) {}
+
+    constexpr const Circle& SweptCircle::circle() const {
+        return _circle;
+    }
+
+    constexpr const Vector2D& SweptCircle::velocity() const {
+        return _velocity;
+    }
+
+    constexpr Circle SweptCircle::at(const float &time) const {
+        return Circle(_circle.center() + _velocity * time, _circle.radius());
+    }
+}
+
+#endif // ARMORIAL_GEOMETRY_SWEPTCIRCLE_H
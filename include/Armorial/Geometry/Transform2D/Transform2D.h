@@ -0,0 +1,106 @@
+#ifndef ARMORIAL_GEOMETRY_TRANSFORM2D_H
+#define ARMORIAL_GEOMETRY_TRANSFORM2D_H
+
+#include <Armorial/Geometry/Rotation2D/Rotation2D.h>
+
+namespace Geometry {
+    /*!
+     * \brief The Geometry::Transform2D class stores a rigid transformation of the plane (an element of
+     * SE(2)): a Geometry::Rotation2D around the origin followed by a translation. The transform of a
+     * pose maps coordinates in the frame of a body at that pose (e.g. the vertices of a robot
+     * footprint) to the world frame, and composing and inverting transforms changes between frames.
+     */
+    class Transform2D
+    {
+    public:
+        /*!
+         * \brief Creates the identity transform.
+         */
+        constexpr Transform2D() = default;
+
+        /*!
+         * \brief Creates the transform that rotates by the given rotation, then translates.
+         */
+        constexpr Transform2D(const Rotation2D &rotation, const Vector2D &translation);
+
+        /*!
+         * \brief Creates the transform from the frame of a body at the given pose to the world frame.
+         * \param position The position of the body.
+         * \param orientation The orientation of the body.
+         */
+        static Transform2D fromPose(const Vector2D &position, const Angle &orientation);
+
+        /*!
+         * \return The rotation and the translation of this transform.
+         */
+        [[nodiscard]] constexpr const Rotation2D& rotation() const;
+        [[nodiscard]] constexpr const Vector2D& translation() const;
+
+        /*!
+         * \return The inverse transform, such that inverse() * (*this) is the identity.
+         */
+        [[nodiscard]] constexpr Transform2D inverse() const;
+
+        /*!
+         * \return The given point transformed.
+         */
+        [[nodiscard]] constexpr Vector2D apply(const Vector2D &point) const;
+
+        /*!
+         * \brief Transforms an array of points, using the Geometry::Batch kernels.
+         * \param points, out The input and output arrays, which may be the same.
+         * \param count The number of points.
+         */
+        void apply(const Vector2D *points, Vector2D *out, size_t count) const;
+
+        /*!
+         * \return The composition of this transform with other, which applies other first.
+         */
+        [[nodiscard]] constexpr Transform2D operator*(const Transform2D &other) const;
+
+        /*!
+         * \return The given point transformed.
+         */
+        [[nodiscard]] constexpr Vector2D operator*(const Vector2D &point) const;
+
+    private:
+        Rotation2D _rotation;
+        Vector2D _translation;
+    };
+
+    constexpr Transform2D::Transform2D(const Rotation2D &rotation, const Vector2D &translation)
+        : _rotation(rotation), _translation(translation) {
+    }
+
+    inline Transform2D Transform2D::fromPose(const Vector2D &position, const Angle &orientation) {
+        return Transform2D(Rotation2D(orientation), position);
+    }
+
+    constexpr const Rotation2D& Transform2D::rotation() const {
+        return _rotation;
+    }
+
+    constexpr const Vector2D& Transform2D::translation() const {
+        return _translation;
+    }
+
+    constexpr Transform2D Transform2D::inverse() const {
+        // x = R y + t  <=>  y = R^-1 x - R^-1 t
+        const Rotation2D inverseRotation = _rotation.inverse();
+        return Transform2D(inverseRotation, Vector2D() - inverseRotation.rotate(_translation));
+    }
+
+    constexpr Vector2D Transform2D::apply(const Vector2D &point) const {
+        return _rotation.rotate(point) + _translation;
+    }
+
+    constexpr Transform2D Transform2D::operator*(const Transform2D &other) const {
+        return Transform2D(_rotation * other._rotation, apply(other._translation));
+    }
+
+    constexpr Vector2D Transform2D::operator*(const Vector2D &point) const {
+        return apply(point);
+    }
+}
+
+#endif // ARMORIAL_GEOMETRY_TRANSFORM2D_H
@@ -3,6 +3,7 @@
 
 #include <Armorial/Geometry/Vector2D/Vector2D.h>
 #include <Armorial/Geometry/LineSegment/LineSegment.h>
+#include <Armorial/Utils/StaticVector/StaticVector.h>
 
 namespace Geometry {
     /*!
@@ -24,7 +25,7 @@ namespace Geometry {
         /*!
          * \return The corners of this Triangle instance.
          */
-        [[nodiscard]] std::vector<Vector2D> corners() const;
+        [[nodiscard]] Utils::StaticVector<Vector2D, 3> corners() const;
 
         /*!
          * \brief Computes if this Triangle contains a given point.
@@ -43,7 +44,7 @@ namespace Geometry {
          * \brief Get the boundary lines of this Triangle.
          * \return A list containing the line segments that compunds the boundary of the Triangle.
          */
-        [[nodiscard]] std::vector<LineSegment> boundary() const;
+        [[nodiscard]] Utils::StaticVector<LineSegment, 3> boundary() const;
 
         /*!
          * \brief Check if this Triangle intersect a given line segment.
@@ -57,7 +58,7 @@ namespace Geometry {
          * \param lineSegment The given line segment.
          * \return A list containing the intersection points with this Triangle and the given line segment.
          */
-        [[nodiscard]] std::vector<Vector2D> intersect(const LineSegment& lineSegment) const;
+        [[nodiscard]] Utils::StaticVector<Vector2D, 3> intersect(const LineSegment& lineSegment) const;
 
         /*!
          * \brief toString method that returns a QString object.
@@ -5,9 +5,15 @@
 
 #include <QString>
 
+#include <assert.h>
+#include <limits>
+#include <math.h>
+
 namespace Geometry {
     /*!
      * \brief The Geometry::Vector2D class stores a vector of two floats that starts from (0, 0) to (_x, _y).
+     * \note The accessors and the arithmetic are defined in this header (constexpr where possible), so
+     * they inline into geometric loops and can be used in compile-time constants.
      */
     class Vector2D
     {
@@ -22,7 +28,7 @@ namespace Geometry {
          * \param x The x value.
          * \param y The y value.
          */
-        Vector2D(const float &x, const float &y);
+        constexpr Vector2D(const float &x, const float &y);
 
         /*!
          * \brief Vector2D constructor that receive a Geometry::Angle and length as parameter.
@@ -47,20 +53,20 @@ namespace Geometry {
          * \brief Get the _x coordinate value.
          * \return A float value containing the _x coordinate.
          */
-        float x() const;
+        constexpr float x() const;
 
         /*!
          * \brief Get the _y coordinate value.
          * \return A float value containing the _y coordinate.
          */
-        float y() const;
+        constexpr float y() const;
 
         /*!
          * \brief Caculate the dot product of this Vector2D instance and another.
          * \param other The other Vector2D instance.
          * \return The dot product between the two Vector2D instances.
          */
-        [[nodiscard]] float dotProduct(const Vector2D &other) const;
+        [[nodiscard]] constexpr float dotProduct(const Vector2D &other) const;
 
         /*!
          * \brief Compute the distance from this Vector2D instance to another.
@@ -74,7 +80,7 @@ namespace Geometry {
          * \param scalar The scalar value which will be used to compute the scale.
          * \return A Vector2D instance that contains a copy of this Vector2D instance scaled.
          */
-        Vector2D scale(const float &scalar) const;
+        constexpr Vector2D scale(const float &scalar) const;
 
         /*!
          * \brief Compute the normalization of this Vector2D instance to a length of 1.
@@ -93,7 +99,7 @@ namespace Geometry {
          * \brief Computes the length2 of this Vector2D instance.
          * \return The length2 of this Vector2D instance.
          */
-        float length2() const;
+        constexpr float length2() const;
 
         /*!
          * \brief Computes the angle of this Vector2D instance viewed from the center of the field (0.0, 0.0). <br>
@@ -121,7 +127,7 @@ namespace Geometry {
          * \param factor The factor which will be used to calculate the interpolation/extrapolation between the Vector2D instances.
          * \return A Vector2D that contains the result from the operation.
          */
-        Vector2D lerp(const Vector2D &other, const float &factor) const;
+        constexpr Vector2D lerp(const Vector2D &other, const float &factor) const;
 
         /*!
          * \brief Computate the rotation of this Vector2D instance around the origin.
@@ -202,21 +208,21 @@ namespace Geometry {
          * \param other The other Vector2D instance.
          * \return A Vector2D instance which coordinates has the sum result.
          */
-        Vector2D operator+=(const Vector2D &other);
+        constexpr Vector2D operator+=(const Vector2D &other);
 
         /*!
          * \brief Subtract other Vector2D instance coordinates onto this.
          * \param other The other Vector2D instance.
          * \return A Vector2D instance which coordinates has the subtract result.
          */
-        Vector2D operator-=(const Vector2D &other);
+        constexpr Vector2D operator-=(const Vector2D &other);
 
         /*!
          * \brief Multiply other Vector2D instance coordinates onto this.
          * \param other The other Vector2D instance.
          * \return A Vector2D instance which coordinates has the multiply result.
          */
-        Vector2D operator*=(const Vector2D &other);
+        constexpr Vector2D operator*=(const Vector2D &other);
 
         /*!
          * \brief Divide other Vector2D instance coordinates onto this.
@@ -230,84 +236,84 @@ namespace Geometry {
          * \param other A float scalar value.
          * \return A Vector2D instance which coordinates has the sum result.
          */
-        Vector2D operator+=(const float &scalar);
+        constexpr Vector2D operator+=(const float &scalar);
 
         /*!
          * \brief Subtract a scalar to Vector2D components.
          * \param other A float scalar value.
          * \return A Vector2D instance which coordinates has the subtract result.
          */
-        Vector2D operator-=(const float &scalar);
+        constexpr Vector2D operator-=(const float &scalar);
 
         /*!
          * \brief Multiply a scalar to Vector2D components.
          * \param other A float scalar value.
          * \return A Vector2D instance which coordinates has the multiplication result.
          */
-        Vector2D operator*=(const float &scalar);
+        constexpr Vector2D operator*=(const float &scalar);
 
         /*!
          * \brief Divide a scalar to Vector2D components.
          * \param other A float scalar value.
          * \return A Vector2D instance which coordinates has the division result.
          */
-        Vector2D operator/=(const float &scalar);
+        constexpr Vector2D operator/=(const float &scalar);
 
         /*!
          * \brief Add another Vector2D instance component-wise to this.
          * \param other The other Vector2D instance.
          * \return A Vector2D instance which contains the result of the sum.
          */
-        Vector2D operator+(const Vector2D &other) const;
+        constexpr Vector2D operator+(const Vector2D &other) const;
 
         /*!
          * \brief Add a scalar component-wise to this instance.
          * \param other The float scalar value.
          * \return A Vector2D instance which contains the result of the sum.
          */
-        Vector2D operator+(const float &scalar) const;
+        constexpr Vector2D operator+(const float &scalar) const;
 
         /*!
          * \brief Subtract another Vector2D instance component-wise to this.
          * \param other The other Vector2D instance.
          * \return A Vector2D instance which contains the result of the subtraction.
          */
-        Vector2D operator-(const Vector2D &other) const;
+        constexpr Vector2D operator-(const Vector2D &other) const;
 
         /*!
          * \brief Subtract a scalar component-wise to this instance.
          * \param other The float scalar value.
          * \return A Vector2D instance which contains the result of the subtraction.
          */
-        Vector2D operator-(const float &scalar) const;
+        constexpr Vector2D operator-(const float &scalar) const;
 
         /*!
          * \brief Multiply another Vector2D instance component-wise to this.
          * \param other The other Vector2D instance.
          * \return A Vector2D instance which contains the result of the multiplication.
          */
-        Vector2D operator*(const Vector2D &other) const;
+        constexpr Vector2D operator*(const Vector2D &other) const;
 
         /*!
          * \brief Multiply a scalar component-wise to this instance.
          * \param other The float scalar value.
          * \return A Vector2D instance which contains the result of the multiplication.
          */
-        Vector2D operator*(const float &scalar) const;
+        constexpr Vector2D operator*(const float &scalar) const;
 
         /*!
          * \brief Divide another Vector2D instance component-wise to this.
          * \param other The other Vector2D instance.
          * \return A Vector2D instance which contains the result of the division.
          */
-        Vector2D operator/(const Vector2D &other) const;
+        constexpr Vector2D operator/(const Vector2D &other) const;
 
         /*!
          * \brief Divide a scalar component-wise to this instance.
          * \param other The float scalar value.
          * \return A Vector2D instance which contains the result of the division.
          */
-        Vector2D operator/(const float &scalar) const;
+        constexpr Vector2D operator/(const float &scalar) const;
 
         /*!
          * \brief toString method that returns a QString object.
@@ -322,9 +328,144 @@ namespace Geometry {
         std::string toStdString();
 
     private:
-        float _x;
-        float _y;
+        float _x = 0.0f;
+        float _y = 0.0f;
     };
+
+    constexpr Vector2D::Vector2D(const float &x, const float &y) : _x(x), _y(y) {
+    }
+
+    inline Vector2D::Vector2D(const Angle &angle, const float &length)
+        : _x(cos(angle.value()) * length), _y(sin(angle.value()) * length) {
+    }
+
+    constexpr float Vector2D::x() const {
+        return _x;
+    }
+
+    constexpr float Vector2D::y() const {
+        return _y;
+    }
+
+    constexpr float Vector2D::dotProduct(const Vector2D &other) const {
+        return (_x * other._x + _y * other._y);
+    }
+
+    inline float Vector2D::dist(const Vector2D &other) const {
+        return (*this - other).length();
+    }
+
+    constexpr Vector2D Vector2D::scale(const float &scalar) const {
+        return Vector2D(_x * scalar, _y * scalar);
+    }
+
+    inline Vector2D Vector2D::normalize() const {
+        // Same threshold as Utils::Compare::isEqual(length(), 0.0f)
+        if(this->length() <= std::numeric_limits<double>::epsilon()) return Vector2D(0.0f, 0.0f);
+
+        float d = 1.0 / length();
+        return Vector2D(_x * d, _y * d);
+    }
+
+    inline float Vector2D::length() const {
+        return sqrt(length2());
+    }
+
+    constexpr float Vector2D::length2() const {
+        return (_x * _x + _y * _y);
+    }
+
+    constexpr Vector2D Vector2D::lerp(const Vector2D &other, const float &factor) const {
+        return (this->scale(factor) + other.scale(1 - factor));
+    }
+
+    inline Vector2D Vector2D::rotate(const float &radians) const {
+        float c = cos(radians);
+        float s = sin(radians);
+
+        return Vector2D(_x * c - _y * s, _x * s + _y * c);
+    }
+
+    inline float Vector2D::crossProductMagnitude(const Vector2D &other) const {
+        return std::fabs(_x * other._y - _y * other._x);
+    }
+
+    inline bool Vector2D::operator==(const Vector2D &other) const {
+        return fabs(this->_x - other._x) < 1e-4 && fabs(this->_y - other._y) < 1e-4;
+    }
+
+    inline bool Vector2D::operator!=(const Vector2D &other) const {
+        return !(*this == other);
+    }
+
+    inline bool Vector2D::operator<(const Vector2D &other) const {
+        return this->length() < other.length();
+    }
+
+    constexpr Vector2D Vector2D::operator+=(const Vector2D &other) {
+        return Vector2D(this->_x += other._x, this->_y += other._y);
+    }
+
+    constexpr Vector2D Vector2D::operator+=(const float &scalar) {
+        return Vector2D(_x += scalar, _y += scalar);
+    }
+
+    constexpr Vector2D Vector2D::operator-=(const Vector2D &other) {
+        return Vector2D(_x -= other._x, _y -= other._y);
+    }
+
+    constexpr Vector2D Vector2D::operator-=(const float &scalar) {
+        return Vector2D(_x -= scalar, _y -= scalar);
+    }
+
+    constexpr Vector2D Vector2D::operator*=(const Vector2D &other) {
+        return Vector2D(_x *= other._x, _y *= other._y);
+    }
+
+    constexpr Vector2D Vector2D::operator*=(const float &scalar) {
+        return Vector2D(_x *= scalar, _y *= scalar);
+    }
+
+    inline Vector2D Vector2D::operator/=(const Vector2D &other) {
+        assert(!(other == Vector2D()) && "Division by zero");
+        return Vector2D(_x /= other._x, _y /= other._y);
+    }
+
+    constexpr Vector2D Vector2D::operator/=(const float &scalar) {
+        return Vector2D(_x /= scalar, _y /= scalar);
+    }
+
+    constexpr Vector2D Vector2D::operator+(const Vector2D &other) const {
+        return Vector2D(_x + other._x, _y + other._y);
+    }
+
+    constexpr Vector2D Vector2D::operator+(const float &scalar) const {
+        return Vector2D(_x + scalar, _y + scalar);
+    }
+
+    constexpr Vector2D Vector2D::operator-(const Vector2D &other) const {
+        return Vector2D(_x - other._x, _y - other._y);
+    }
+
+    constexpr Vector2D Vector2D::operator-(const float &scalar) const {
+        return Vector2D(_x - scalar, _y - scalar);
+    }
+
+    constexpr Vector2D Vector2D::operator*(const Vector2D &other) const {
+        return Vector2D(_x * other._x, _y * other._y);
+    }
+
+    constexpr Vector2D Vector2D::operator*(const float &scalar) const {
+        return Vector2D(_x * scalar, _y * scalar);
+    }
+
+    constexpr Vector2D Vector2D::operator/(const Vector2D &other) const {
+        return Vector2D(_x / other._x, _y / other._y);
+    }
+
+    constexpr Vector2D Vector2D::operator/(const float &scalar) const {
+        return Vector2D(_x / scalar, _y / scalar);
+    }
 }
 
 #endif // ARMORIAL_GEOMETRY_VECTOR2D_H
@@ -0,0 +1,72 @@
+#ifndef ARMORIAL_MATH_CHOLESKY_H
+#define ARMORIAL_MATH_CHOLESKY_H
+
+#include <Armorial/Math/Matrix/Matrix.h>
+#include <Armorial/Math/MatrixView/MatrixView.h>
+
+namespace Math {
+    /*!
+     * \brief The Math::Cholesky class computes the Cholesky decomposition (A = LLᵀ) of a symmetric
+     * positive-definite matrix, such as covariance matrixes. It is about twice as fast as the
+     * LU decomposition and does not need pivoting.
+     * \note Only the lower triangle of the given matrix is read. The decomposition is computed in
+     * double precision, and the results are rounded to float.
+     */
+    class Cholesky {
+    public:
+        /*!
+         * \brief Cholesky constructor, which decomposes the given matrix.
+         * \param matrix The given symmetric square matrix, or a view of it (e.g. a block of a larger matrix).
+         */
+        Cholesky(const Matrix &matrix);
+        Cholesky(const MatrixView &matrix);
+
+        /*!
+         * \return The number of lines (and columns) of the decomposed matrix.
+         */
+        unsigned size() const { return _size; }
+
+        /*!
+         * \return True if the decomposed matrix is positive-definite, false otherwise. If it is not,
+         * none of the other methods give meaningful results.
+         */
+        bool isPositiveDefinite() const { return _positiveDefinite; }
+
+        /*!
+         * \return The determinant of the decomposed matrix, or zero if it is not positive-definite.
+         */
+        float determinant() const;
+
+        /*!
+         * \brief Solves the linear system A * X = B, where A is the decomposed matrix.
+         * \param B The given right-hand side (or a view of it), with size() lines and any number of columns.
+         * \return A std::optional<Matrix> containing X, or std::nullopt if the decomposed matrix is
+         * not positive-definite.
+         */
+        std::optional<Matrix> solve(const Matrix &B) const;
+        std::optional<Matrix> solve(const MatrixView &B) const;
+
+        /*!
+         * \return A std::optional<Matrix> containing the inverse of the decomposed matrix, or
+         * std::nullopt if it is not positive-definite.
+         */
+        std::optional<Matrix> inverse() const;
+
+        /*!
+         * \return The lower triangular factor L.
+         */
+        Matrix L() const;
+
+    private:
+        /*!
+         * \brief Solves A * x = b in place for a single right-hand side.
+         */
+        void solveInPlace(std::vector<double> &b) const;
+
+        unsigned _size;
+        std::vector<double> _l;
+        bool _positiveDefinite;
+    };
+}
+
+#endif // ARMORIAL_MATH_CHOLESKY_H
@@ -0,0 +1,561 @@
+#ifndef ARMORIAL_MATH_FIXEDMATRIX_H
+#define ARMORIAL_MATH_FIXEDMATRIX_H
+
+#include <Armorial/Math/Matrix/Matrix.h>
+
+#include <array>
+#include <limits>
+#include <assert.h>
+
+namespace Math {
+    /*!
+     * \brief The Math::FixedMatrix class provides a floating-point matrix whose dimensions are known
+     * at compile time, such as the ones used in small filters. Its elements are stored inline (no
+     * heap allocation), dimension mismatches are compile errors and all of its operations are
+     * constexpr, with loops over compile-time bounds which the compiler fully unrolls for small sizes.
+     * \tparam R The number of lines.
+     * \tparam C The number of columns.
+     * \note It converts from and to the dynamic Math::Matrix.
+     */
+    template <unsigned R, unsigned C>
+    class FixedMatrix {
+        static_assert(R > 0 && C > 0, "FixedMatrix dimensions should be positive");
+
+    public:
+        /*!
+         * \brief FixedMatrix constructor that initializes all elements with zeros.
+         */
+        constexpr FixedMatrix() : _data{} {}
+
+        /*!
+         * \brief FixedMatrix constructor that receives the elements as a nested list, e.g.
+         * FixedMatrix<2, 2>({{1, 2}, {3, 4}}). Missing elements are initialized with zeros.
+         * \param values The given elements, in row-major order.
+         */
+        constexpr FixedMatrix(const float (&values)[R][C]) : _data{} {
+            for(unsigned i = 0; i < R; i++) {
+                for(unsigned j = 0; j < C; j++) {
+                    _data[i * C + j] = values[i][j];
+                }
+            }
+        }
+
+        /*!
+         * \brief FixedMatrix constructor that copies the elements of a dynamic Math::Matrix.
+         * \param M The given matrix, which should have R lines and C columns.
+         */
+        explicit FixedMatrix(const Matrix &M) : _data{} {
+            assert(M.lines() == R && M.columns() == C);
+            for(unsigned i = 0; i < R; i++) {
+                for(unsigned j = 0; j < C; j++) {
+                    _data[i * C + j] = M.get(i, j);
+                }
+            }
+        }
+
+        /*!
+         * \return A dynamic Math::Matrix instance with the elements of this FixedMatrix instance.
+         */
+        Matrix toMatrix() const {
+            Matrix M(R, C);
+            for(unsigned i = 0; i < R; i++) {
+                for(unsigned j = 0; j < C; j++) {
+                    M.set(i, j, _data[i * C + j]);
+                }
+            }
+
+            return M;
+        }
+
+        /*!
+         * \return The number of lines in this FixedMatrix type.
+         */
+        static constexpr unsigned lines() { return R; }
+
+        /*!
+         * \return The number of columns in this FixedMatrix type.
+         */
+        static constexpr unsigned columns() { return C; }
+
+        /*!
+         * \param i The given line number.
+         * \param j The given column number.
+         * \return A float containing the value at the given line and column.
+         */
+        constexpr float get(unsigned i, unsigned j) const {
+            assert(i < R && j < C);
+            return _data[i * C + j];
+        }
+
+        /*!
+         * \brief Set a given value in the given line and column.
+         * \param i The given line.
+         * \param j The given column.
+         * \param value The given value.
+         */
+        constexpr void set(unsigned i, unsigned j, float value) {
+            assert(i < R && j < C);
+            _data[i * C + j] = value;
+        }
+
+        /*!
+         * \brief Access operators to the element at the given line and column.
+         */
+        constexpr float& operator()(unsigned i, unsigned j) {
+            assert(i < R && j < C);
+            return _data[i * C + j];
+        }
+        constexpr const float& operator()(unsigned i, unsigned j) const {
+            assert(i < R && j < C);
+            return _data[i * C + j];
+        }
+
+        /*!
+         * \return A pointer to the elements of this FixedMatrix instance, in row-major order.
+         */
+        constexpr float* data() { return _data.data(); }
+        constexpr const float* data() const { return _data.data(); }
+
+        /*!
+         * \return A FixedMatrix instance containing a identity matrix.
+         */
+        static constexpr FixedMatrix identity() {
+            return diag(1.0f);
+        }
+
+        /*!
+         * \param diagValue The given value to set in the diagonal.
+         * \return A FixedMatrix instance containing 'diagValue' value on its diagonal.
+         */
+        static constexpr FixedMatrix diag(float diagValue) {
+            static_assert(R == C, "Diagonal matrixes should be square");
+            FixedMatrix M;
+            for(unsigned i = 0; i < R; i++) {
+                M._data[i * C + i] = diagValue;
+            }
+
+            return M;
+        }
+
+        /*!
+         * \return The transposed FixedMatrix of this instance.
+         */
+        constexpr FixedMatrix<C, R> transposed() const {
+            FixedMatrix<C, R> T;
+            for(unsigned i = 0; i < R; i++) {
+                for(unsigned j = 0; j < C; j++) {
+                    T(j, i) = _data[i * C + j];
+                }
+            }
+
+            return T;
+        }
+
+        /*!
+         * \return The determinant of this FixedMatrix instance, using closed forms up to 4x4 and
+         * Gaussian elimination with partial pivoting for larger matrixes.
+         */
+        constexpr float determinant() const {
+            static_assert(R == C, "Determinant is only defined for square matrixes");
+            const FixedMatrix &m = *this;
+            if constexpr (R == 1) {
+                return m(0, 0);
+            } else if constexpr (R == 2) {
+                return m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+            } else if constexpr (R == 3) {
+                return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1))
+                     - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0))
+                     + m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+            } else if constexpr (R == 4) {
+                const Minors4 minors = m.minors4();
+                return minors.determinant();
+            } else {
+                // Gaussian elimination, in double precision
+                std::array<double, R * C> a{};
+                for(unsigned k = 0; k < R * C; k++) {
+                    a[k] = _data[k];
+                }
+
+                double det = 1.0;
+                for(unsigned k = 0; k < R; k++) {
+                    unsigned pivot = k;
+                    for(unsigned i = k + 1; i < R; i++) {
+                        if(abs(a[i * C + k]) > abs(a[pivot * C + k])) {
+                            pivot = i;
+                        }
+                    }
+                    if(!(abs(a[pivot * C + k]) > 0.0)) {
+                        return 0.0f;
+                    }
+                    if(pivot != k) {
+                        for(unsigned j = 0; j < C; j++) {
+                            const double temp = a[k * C + j];
+                            a[k * C + j] = a[pivot * C + j];
+                            a[pivot * C + j] = temp;
+                        }
+                        det = -det;
+                    }
+                    det *= a[k * C + k];
+                    for(unsigned i = k + 1; i < R; i++) {
+                        const double factor = a[i * C + k] / a[k * C + k];
+                        for(unsigned j = k + 1; j < C; j++) {
+                            a[i * C + j] -= factor * a[k * C + j];
+                        }
+                    }
+                }
+
+                return float(det);
+            }
+        }
+
+        /*!
+         * \return True if this FixedMatrix instance is singular to float precision, false otherwise.
+         * \note It runs Gaussian elimination with partial pivoting and applies the same rule as
+         * Math::LU::isSingular(): a pivot is negligible when it is below the float rounding error of
+         * its original line or column, whichever is smaller.
+         */
+        constexpr bool isSingular() const {
+            static_assert(R == C, "Singularity is only defined for square matrixes");
+            std::array<double, R * C> a{};
+            std::array<double, R> lineMax{};
+            std::array<double, C> columnMax{};
+            std::array<unsigned, R> lines{};
+            for(unsigned i = 0; i < R; i++) {
+                lines[i] = i;
+                for(unsigned j = 0; j < C; j++) {
+                    a[i * C + j] = _data[i * C + j];
+                    lineMax[i] = (abs(a[i * C + j]) > lineMax[i]) ? abs(a[i * C + j]) : lineMax[i];
+                    columnMax[j] = (abs(a[i * C + j]) > columnMax[j]) ? abs(a[i * C + j]) : columnMax[j];
+                }
+            }
+
+            const double epsilon = R * double(std::numeric_limits<float>::epsilon());
+            for(unsigned k = 0; k < R; k++) {
+                unsigned pivot = k;
+                for(unsigned i = k + 1; i < R; i++) {
+                    if(abs(a[i * C + k]) > abs(a[pivot * C + k])) {
+                        pivot = i;
+                    }
+                }
+                if(pivot != k) {
+                    for(unsigned j = 0; j < C; j++) {
+                        const double temp = a[k * C + j];
+                        a[k * C + j] = a[pivot * C + j];
+                        a[pivot * C + j] = temp;
+                    }
+                    const unsigned line = lines[k];
+                    lines[k] = lines[pivot];
+                    lines[pivot] = line;
+                }
+
+                const double diagonal = a[k * C + k];
+                const double reference = (lineMax[lines[k]] < columnMax[k]) ? lineMax[lines[k]] : columnMax[k];
+                if(abs(diagonal) <= epsilon * reference) {
+                    return true;
+                }
+                for(unsigned i = k + 1; i < R; i++) {
+                    const double factor = a[i * C + k] / diagonal;
+                    for(unsigned j = k + 1; j < C; j++) {
+                        a[i * C + j] -= factor * a[k * C + j];
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        /*!
+         * \brief Computes the inverse of this FixedMatrix instance, using closed forms (the adjugate
+         * divided by the determinant) up to 4x4 and Gauss-Jordan elimination with partial pivoting
+         * for larger matrixes.
+         * \return A std::optional<FixedMatrix> object which contains the inverse, or std::nullopt if
+         * isSingular() (or if the closed form determinant underflows float).
+         */
+        constexpr std::optional<FixedMatrix> inverse() const {
+            static_assert(R == C, "Inverse is only defined for square matrixes");
+            if(isSingular()) {
+                return std::nullopt;
+            }
+
+            const FixedMatrix &m = *this;
+            FixedMatrix inv;
+            if constexpr (R == 1) {
+                inv(0, 0) = 1.0f / m(0, 0);
+            } else if constexpr (R == 2) {
+                const float det = determinant();
+                if(!(abs(det) > 0.0)) {
+                    return std::nullopt;
+                }
+                const float invDet = 1.0f / det;
+                inv(0, 0) = m(1, 1) * invDet;
+                inv(0, 1) = -m(0, 1) * invDet;
+                inv(1, 0) = -m(1, 0) * invDet;
+                inv(1, 1) = m(0, 0) * invDet;
+            } else if constexpr (R == 3) {
+                inv(0, 0) = m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1);
+                inv(1, 0) = m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2);
+                inv(2, 0) = m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0);
+                const float det = m(0, 0) * inv(0, 0) + m(0, 1) * inv(1, 0) + m(0, 2) * inv(2, 0);
+                if(!(abs(det) > 0.0)) {
+                    return std::nullopt;
+                }
+                inv(0, 1) = m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2);
+                inv(1, 1) = m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0);
+                inv(2, 1) = m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1);
+                inv(0, 2) = m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1);
+                inv(1, 2) = m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2);
+                inv(2, 2) = m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+                inv *= (1.0f / det);
+            } else if constexpr (R == 4) {
+                const Minors4 s = m.minors4();
+                const float det = s.determinant();
+                if(!(abs(det) > 0.0)) {
+                    return std::nullopt;
+                }
+                inv(0, 0) =  m(1, 1) * s.c5 - m(1, 2) * s.c4 + m(1, 3) * s.c3;
+                inv(0, 1) = -m(0, 1) * s.c5 + m(0, 2) * s.c4 - m(0, 3) * s.c3;
+                inv(0, 2) =  m(3, 1) * s.s5 - m(3, 2) * s.s4 + m(3, 3) * s.s3;
+                inv(0, 3) = -m(2, 1) * s.s5 + m(2, 2) * s.s4 - m(2, 3) * s.s3;
+                inv(1, 0) = -m(1, 0) * s.c5 + m(1, 2) * s.c2 - m(1, 3) * s.c1;
+                inv(1, 1) =  m(0, 0) * s.c5 - m(0, 2) * s.c2 + m(0, 3) * s.c1;
+                inv(1, 2) = -m(3, 0) * s.s5 + m(3, 2) * s.s2 - m(3, 3) * s.s1;
+                inv(1, 3) =  m(2, 0) * s.s5 - m(2, 2) * s.s2 + m(2, 3) * s.s1;
+                inv(2, 0) =  m(1, 0) * s.c4 - m(1, 1) * s.c2 + m(1, 3) * s.c0;
+                inv(2, 1) = -m(0, 0) * s.c4 + m(0, 1) * s.c2 - m(0, 3) * s.c0;
+                inv(2, 2) =  m(3, 0) * s.s4 - m(3, 1) * s.s2 + m(3, 3) * s.s0;
+                inv(2, 3) = -m(2, 0) * s.s4 + m(2, 1) * s.s2 - m(2, 3) * s.s0;
+                inv(3, 0) = -m(1, 0) * s.c3 + m(1, 1) * s.c1 - m(1, 2) * s.c0;
+                inv(3, 1) =  m(0, 0) * s.c3 - m(0, 1) * s.c1 + m(0, 2) * s.c0;
+                inv(3, 2) = -m(3, 0) * s.s3 + m(3, 1) * s.s1 - m(3, 2) * s.s0;
+                inv(3, 3) =  m(2, 0) * s.s3 - m(2, 1) * s.s1 + m(2, 2) * s.s0;
+                inv *= (1.0f / det);
+            } else {
+                // Gauss-Jordan elimination on [A | I], in double precision
+                std::array<double, R * C> a{};
+                std::array<double, R * C> b{};
+                for(unsigned i = 0; i < R; i++) {
+                    for(unsigned j = 0; j < C; j++) {
+                        a[i * C + j] = _data[i * C + j];
+                    }
+                    b[i * C + i] = 1.0;
+                }
+
+                for(unsigned k = 0; k < R; k++) {
+                    unsigned pivot = k;
+                    for(unsigned i = k + 1; i < R; i++) {
+                        if(abs(a[i * C + k]) > abs(a[pivot * C + k])) {
+                            pivot = i;
+                        }
+                    }
+                    if(!(abs(a[pivot * C + k]) > 0.0)) {
+                        return std::nullopt;
+                    }
+                    if(pivot != k) {
+                        for(unsigned j = 0; j < C; j++) {
+                            double temp = a[k * C + j];
+                            a[k * C + j] = a[pivot * C + j];
+                            a[pivot * C + j] = temp;
+                            temp = b[k * C + j];
+                            b[k * C + j] = b[pivot * C + j];
+                            b[pivot * C + j] = temp;
+                        }
+                    }
+                    const double invPivot = 1.0 / a[k * C + k];
+                    for(unsigned j = 0; j < C; j++) {
+                        a[k * C + j] *= invPivot;
+                        b[k * C + j] *= invPivot;
+                    }
+                    for(unsigned i = 0; i < R; i++) {
+                        const double factor = a[i * C + k];
+                        if(i == k) {
+                            continue;
+                        }
+                        for(unsigned j = 0; j < C; j++) {
+                            a[i * C + j] -= factor * a[k * C + j];
+                            b[i * C + j] -= factor * b[k * C + j];
+                        }
+                    }
+                }
+
+                for(unsigned k = 0; k < R * C; k++) {
+                    inv._data[k] = float(b[k]);
+                }
+            }
+
+            return inv;
+        }
+
+        /*!
+         * \brief Operators between this FixedMatrix instance and a given FixedMatrix instance.
+         * \param M The given FixedMatrix instance.
+         */
+        constexpr FixedMatrix operator+(const FixedMatrix &M) const {
+            FixedMatrix temp = *this;
+            temp += M;
+            return temp;
+        }
+
+        constexpr FixedMatrix operator-(const FixedMatrix &M) const {
+            FixedMatrix temp = *this;
+            temp -= M;
+            return temp;
+        }
+
+        template <unsigned K>
+        constexpr FixedMatrix<R, K> operator*(const FixedMatrix<C, K> &M) const {
+            FixedMatrix<R, K> temp;
+            for(unsigned i = 0; i < R; i++) {
+                for(unsigned k = 0; k < C; k++) {
+                    const float aik = _data[i * C + k];
+                    for(unsigned j = 0; j < K; j++) {
+                        temp(i, j) += aik * M(k, j);
+                    }
+                }
+            }
+
+            return temp;
+        }
+
+        constexpr FixedMatrix& operator+=(const FixedMatrix &M) {
+            for(unsigned k = 0; k < R * C; k++) {
+                _data[k] += M._data[k];
+            }
+
+            return *this;
+        }
+
+        constexpr FixedMatrix& operator-=(const FixedMatrix &M) {
+            for(unsigned k = 0; k < R * C; k++) {
+                _data[k] -= M._data[k];
+            }
+
+            return *this;
+        }
+
+        constexpr bool operator==(const FixedMatrix &M) const {
+            for(unsigned k = 0; k < R * C; k++) {
+                if(!isZero(double(_data[k]) - double(M._data[k]))) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        constexpr bool operator!=(const FixedMatrix &M) const {
+            return !((*this) == M);
+        }
+
+        /*!
+         * \brief Operators between this FixedMatrix instance and a given scalar.
+         * \param k The given scalar.
+         */
+        constexpr FixedMatrix operator+(float k) const {
+            FixedMatrix temp = *this;
+            temp += k;
+            return temp;
+        }
+
+        constexpr FixedMatrix operator-(float k) const {
+            return (*this) + (-k);
+        }
+
+        constexpr FixedMatrix operator*(float k) const {
+            FixedMatrix temp = *this;
+            temp *= k;
+            return temp;
+        }
+
+        constexpr FixedMatrix operator/(float k) const {
+            FixedMatrix temp = *this;
+            temp /= k;
+            return temp;
+        }
+
+        constexpr FixedMatrix& operator+=(float k) {
+            for(unsigned i = 0; i < R * C; i++) {
+                _data[i] += k;
+            }
+
+            return *this;
+        }
+
+        constexpr FixedMatrix& operator-=(float k) {
+            return (*this) += (-k);
+        }
+
+        constexpr FixedMatrix& operator*=(float k) {
+            for(unsigned i = 0; i < R * C; i++) {
+                _data[i] *= k;
+            }
+
+            return *this;
+        }
+
+        constexpr FixedMatrix& operator/=(float k) {
+            assert(!isZero(k));
+            for(unsigned i = 0; i < R * C; i++) {
+                _data[i] /= k;
+            }
+
+            return *this;
+        }
+
+    private:
+        /*!
+         * \brief The 2x2 minors of the two upper (s) and two lower (c) lines of a 4x4 matrix, from
+         * which its determinant and adjugate are computed with the Laplace expansion theorem.
+         */
+        struct Minors4 {
+            float s0, s1, s2, s3, s4, s5;
+            float c0, c1, c2, c3, c4, c5;
+
+            constexpr float determinant() const {
+                return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            }
+        };
+
+        constexpr Minors4 minors4() const {
+            const FixedMatrix &m = *this;
+            return Minors4{m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1),
+                           m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2),
+                           m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3),
+                           m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2),
+                           m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3),
+                           m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3),
+                           m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1),
+                           m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2),
+                           m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3),
+                           m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2),
+                           m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3),
+                           m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3)};
+        }
+
+        static constexpr double abs(double value) {
+            return (value < 0.0) ? -value : value;
+        }
+
+        // Same tolerance as Utils::Compare::isEqual, usable in constant expressions
+        static constexpr bool isZero(double value) {
+            return abs(value) <= std::numeric_limits<double>::epsilon();
+        }
+
+        std::array<float, R * C> _data;
+    };
+
+    /*!
+     * \brief Column vector with N lines, e.g. the state of a filter.
+     */
+    template <unsigned N>
+    using FixedVector = FixedMatrix<N, 1>;
+
+    /*!
+     * \brief Operator between a scalar and a FixedMatrix instance.
+     */
+    template <unsigned R, unsigned C>
+    constexpr FixedMatrix<R, C> operator*(float k, const FixedMatrix<R, C> &M) {
+        return M * k;
+    }
+}
+
+#endif // ARMORIAL_MATH_FIXEDMATRIX_H
@@ -0,0 +1,84 @@
+#ifndef ARMORIAL_MATH_LU_H
+#define ARMORIAL_MATH_LU_H
+
+#include <Armorial/Math/Matrix/Matrix.h>
+#include <Armorial/Math/MatrixView/MatrixView.h>
+
+namespace Math {
+    /*!
+     * \brief The Math::LU class computes the LU decomposition with partial pivoting (PA = LU) of a
+     * square matrix, which allows computing its determinant, inverse and solving linear systems
+     * in O(n³) time.
+     * \note The decomposition is computed in double precision, and the results are rounded to float.
+     */
+    class LU {
+    public:
+        /*!
+         * \brief LU constructor, which decomposes the given matrix.
+         * \param matrix The given square matrix, or a view of it (e.g. a block of a larger matrix).
+         */
+        LU(const Matrix &matrix);
+        LU(const MatrixView &matrix);
+
+        /*!
+         * \return The number of lines (and columns) of the decomposed matrix.
+         */
+        unsigned size() const { return _size; }
+
+        /*!
+         * \return True if the decomposed matrix is singular (or numerically close to singular), false otherwise.
+         * \note A pivot is negligible when it is below the float rounding error of its original line or
+         * column, whichever is smaller, so badly scaled but invertible matrixes are not singular.
+         */
+        bool isSingular() const { return _singular; }
+
+        /*!
+         * \return The determinant of the decomposed matrix, as the product of the pivots. It is not forced
+         * to zero for isSingular() matrixes, whose determinant is only as small as their rounding error.
+         */
+        float determinant() const;
+
+        /*!
+         * \brief Solves the linear system A * X = B, where A is the decomposed matrix.
+         * \param B The given right-hand side (or a view of it), with size() lines and any number of columns.
+         * \return A std::optional<Matrix> containing X, or std::nullopt if the decomposed matrix is singular.
+         */
+        std::optional<Matrix> solve(const Matrix &B) const;
+        std::optional<Matrix> solve(const MatrixView &B) const;
+
+        /*!
+         * \return A std::optional<Matrix> containing the inverse of the decomposed matrix, or
+         * std::nullopt if it is singular.
+         */
+        std::optional<Matrix> inverse() const;
+
+        /*!
+         * \return The unit lower triangular factor L.
+         */
+        Matrix L() const;
+
+        /*!
+         * \return The upper triangular factor U.
+         */
+        Matrix U() const;
+
+        /*!
+         * \return The line permutation, where the i-th line of PA is the permutation()[i]-th line of A.
+         */
+        const std::vector<unsigned>& permutation() const { return _permutation; }
+
+    private:
+        /*!
+         * \brief Solves A * x = b in place for a single right-hand side.
+         */
+        void solveInPlace(std::vector<double> &b) const;
+
+        unsigned _size;
+        std::vector<double> _lu;
+        std::vector<unsigned> _permutation;
+        int _sign;
+        bool _singular;
+    };
+}
+
+#endif // ARMORIAL_MATH_LU_H
@@ -1,6 +1,15 @@
 #ifndef ARMORIAL_MATH_H
 #define ARMORIAL_MATH_H
 
+#include "Cholesky/Cholesky.h"
+#include "FixedMatrix/FixedMatrix.h"
+#include "LU/LU.h"
 #include "Matrix/Matrix.h"
+#include "MatrixExpression/MatrixExpression.h"
+#include "MatrixSlice/MatrixSlice.h"
+#include "MatrixView/MatrixView.h"
+#include "PolynomialFit/PolynomialFit.h"
+#include "QR/QR.h"
+#include "SVD/SVD.h"
 
 #endif // ARMORIAL_MATH_H
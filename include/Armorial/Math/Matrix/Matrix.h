@@ -1,15 +1,28 @@
 #ifndef ARMORIAL_MATH_MATRIX_H
 #define ARMORIAL_MATH_MATRIX_H
 
+#include <Armorial/Math/MatrixExpression/MatrixExpression.h>
+
+#include <cstddef>
 #include <optional>
+#include <utility>
 #include <vector>
+#include <assert.h>
 
 namespace Math {
+    class MatrixView;
+    class MatrixSlice;
+
     /*!
      * \brief The Math::Matrix class provides a interface for floating-point matrixes,
      * providing custom constructors and methods for matrix computations.
+     * \note The elements are stored in a single row-major buffer aligned to Matrix::Alignment
+     * bytes. Each line starts at a multiple of stride() elements, so that all the lines are
+     * aligned as well. The padding elements at the end of each line have unspecified values.
+     * \note Arithmetic operators between matrixes return lazily evaluated expressions (see
+     * Math::MatrixExpression), which are computed without temporaries when assigned to a Matrix.
      */
-    class Matrix {
+    class Matrix : public MatrixExpression<Matrix> {
     public:
         /*!
          * \brief Matrix constructor that allocates a matrix with given lines and columns.
@@ -32,6 +45,19 @@ namespace Math {
          */
         Matrix(const Matrix &M);
 
+        /*!
+         * \brief Matrix move constructor, which takes the buffer of the given matrix, leaving it empty.
+         * \param M The given matrix.
+         */
+        Matrix(Matrix &&M) noexcept;
+
+        /*!
+         * \brief Matrix constructor that evaluates the given matrix expression.
+         * \param expression The given expression, e.g. A * B + C.
+         */
+        template <typename E>
+        Matrix(const MatrixExpression<E> &expression);
+
         /*!
          * \brief Matrix destructor, which deallocate the matrix.
          */
@@ -41,10 +67,17 @@ namespace Math {
          * \brief Set the matrix size, deallocating and reallocating another one.
          * \param lines The given new number of lines.
          * \param columns The given new number of columns.
-         * \note This method erases all the previous data.
+         * \note This method erases all the previous data. The current buffer is reused if it is
+         * large enough for the new size.
          */
         void setSize(unsigned lines, unsigned columns);
 
+        /*!
+         * \brief Swaps the contents (buffer and shape) of this Matrix instance with the given one.
+         * \param M The given Matrix instance.
+         */
+        void swap(Matrix &M) noexcept;
+
         /*!
          * \return The number of lines in this Matrix instance.
          */
@@ -55,6 +88,25 @@ namespace Math {
          */
         unsigned columns() const { return _columns; }
 
+        /*!
+         * \return The distance, in elements, between the start of two consecutive lines.
+         */
+        unsigned stride() const { return _stride; }
+
+        /*!
+         * \return A pointer to the first element of this Matrix instance, or nullptr if it is empty.
+         * The element (i, j) is located at data()[i * stride() + j].
+         */
+        float* data() { return _data; }
+        const float* data() const { return _data; }
+
+        /*!
+         * \param i The given line number.
+         * \return A pointer to the first element of the given line.
+         */
+        float* line(unsigned i) { return _data + i * _stride; }
+        const float* line(unsigned i) const { return _data + i * _stride; }
+
         /*!
          * \param i The given line number.
          * \param j The given column number.
@@ -71,9 +123,19 @@ namespace Math {
         void set(unsigned i, unsigned j, float value);
 
         /*!
-         * \return The transposed Matrix of this instance.
+         * \brief Views over the elements of this Matrix instance, which copy nothing. The const
+         * overloads return read-only views (see Math::MatrixView), and the others return writable
+         * slices (see Math::MatrixSlice).
+         * \param i, j The first line and column of the block.
+         * \param lines, columns The size of the block.
+         * \return A view of the given block, of the i-th line or of the j-th column.
          */
-        Matrix transposed() const;
+        MatrixView block(unsigned i, unsigned j, unsigned lines, unsigned columns) const;
+        MatrixSlice block(unsigned i, unsigned j, unsigned lines, unsigned columns);
+        MatrixView lineBlock(unsigned i) const;
+        MatrixSlice lineBlock(unsigned i);
+        MatrixView columnBlock(unsigned j) const;
+        MatrixSlice columnBlock(unsigned j);
 
         /*!
          * \brief Computes the matrix cofactor ignoring 'p' line and 'q' column.
@@ -86,14 +148,24 @@ namespace Math {
         /*!
          * \return Returns the computed adjoint Matrix from this instance.
          */
-        Matrix adjoint();
+        Matrix adjoint() const;
+
+        /*!
+         * \brief Computes the inverse of this Matrix instance using its LU decomposition.
+         * \return A std::optional<Matrix> object which contains a Matrix instance if this
+         * Matrix instance is not singular.
+         */
+        std::optional<Matrix> inverse() const;
 
         /*!
-         * \brief Computes the inverse of this Matrix instance.
-         * \return A std::optional<Matrix> object which contains a Matrix instance if the
-         * determinant value of this Matrix instance differs from zero.
+         * \brief Solves the linear system A * X = B, where A is this Matrix instance, using its LU
+         * decomposition, which is faster and more accurate than computing the inverse of A.
+         * \param B The given right-hand side, with lines() lines and any number of columns.
+         * \return A std::optional<Matrix> containing X, or std::nullopt if this Matrix instance is singular.
+         * \note Use Math::Cholesky instead for symmetric positive-definite matrixes, and Math::LU when
+         * solving several systems with the same matrix.
          */
-        std::optional<Matrix> inverse();
+        std::optional<Matrix> solve(const Matrix &B) const;
 
         /*!
          * \param size The given size.
@@ -102,12 +174,17 @@ namespace Math {
         static Matrix identity(unsigned size);
 
         /*!
-         * \brief Computes the determinant of a given matrix.
+         * \brief Computes the determinant of a given matrix using its LU decomposition.
          * \param m The given matrix.
          * \param columns The given number of columns of the given matrix.
-         * \return A integer containing the determinant value for the given matrix.
+         * \return A float containing the determinant value for the given matrix.
          */
-        static float determinant(Matrix m, unsigned columns);
+        static float determinant(const Matrix &m, unsigned columns);
+
+        /*!
+         * \return The determinant of this Matrix instance, computed using its LU decomposition.
+         */
+        float determinant() const;
 
         /*!
          * \param size The size of the matrix.
@@ -119,35 +196,56 @@ namespace Math {
         /*!
          * \brief Makes a copy for this Matrix instance given another Matrix instance.
          * \param M The given Matrix instance.
+         * \note The current buffer is reused if it is large enough.
          */
         void copyFrom(const Matrix &M);
 
+        /*!
+         * \brief In-place variants of the matrix operators, which store the result of the operation
+         * in a given output Matrix instance. The output buffer is reused if it is large enough, so
+         * keeping an output matrix between calls avoids any allocation.
+         * \param A, B The given operands.
+         * \param result The Matrix instance where the result will be stored. It can be one of the
+         * operands in add() and subtract(), but not in multiply().
+         * \note Large products are computed by the cache-blocked SIMD kernel of impl::gemm().
+         */
+        static void add(const Matrix &A, const Matrix &B, Matrix &result);
+        static void subtract(const Matrix &A, const Matrix &B, Matrix &result);
+        static void multiply(const Matrix &A, const Matrix &B, Matrix &result);
+        static void multiply(const MatrixView &A, const MatrixView &B, Matrix &result);
+        static void multiply(const Matrix &A, float k, Matrix &result);
+
         /*!
          * \brief Prints the content of this Matrix instance.
          */
         void print();
 
         /*!
-         * \brief Operators between this Matrix instance and a given Matrix instance.
+         * \brief Assignment operators. The copy assignment reuses the current buffer if it is large
+         * enough, while the move assignment takes the buffer of the given Matrix instance.
          * \param M The given Matrix instance.
          */
-        void operator=(const Matrix &M);
-        Matrix operator+(const Matrix &M) const;
-        Matrix operator-(const Matrix &M) const;
-        Matrix operator*(const Matrix &M) const;
-        void operator+=(const Matrix &M);
-        void operator-=(const Matrix &M);
-        bool operator==(const Matrix &M);
+        Matrix& operator=(const Matrix &M);
+        Matrix& operator=(Matrix &&M) noexcept;
 
         /*!
-         * \brief Operators between this Matrix instance and a given scalar.
-         * \param k The given scalar.
-         * \return A new Matrix instance containing the result of the operation.
+         * \brief Evaluates the given matrix expression into this Matrix instance, reusing its buffer.
+         * \param expression The given expression, e.g. F * P * F.transposed() + Q.
+         * \note If the expression reads this Matrix instance, it is evaluated into a per-thread scratch
+         * matrix which is then swapped with this one, so the steady state does not allocate either.
          */
-        Matrix operator+(float k) const;
-        Matrix operator-(float k) const;
-        Matrix operator*(float k) const;
-        Matrix operator/(float k) const;
+        template <typename E>
+        Matrix& operator=(const MatrixExpression<E> &expression);
+
+        /*!
+         * \brief Operators between this Matrix instance and a given matrix expression.
+         * \param expression The given expression.
+         * \note This methods computes and store the result directly on this Matrix instance.
+         */
+        template <typename E>
+        void operator+=(const MatrixExpression<E> &expression);
+        template <typename E>
+        void operator-=(const MatrixExpression<E> &expression);
 
         /*!
          * \brief Operators between this Matrix instance and a given scalar.
@@ -159,9 +257,48 @@ namespace Math {
         void operator*=(float k);
         void operator/=(float k);
 
+        /*!
+         * \brief Alignment, in bytes, of the buffer and of each line of the matrix.
+         */
+        static constexpr unsigned Alignment = 32;
+
+        /*!
+         * \brief Matrix expression interface (see Math::MatrixExpression).
+         */
+        static constexpr bool CheapCoefficients = true;
+        float coeff(unsigned i, unsigned j) const { return _data[i * _stride + j]; }
+        void evaluateLine(unsigned i, float *out) const {
+            const float *l = line(i);
+            std::copy(l, l + _columns, out);
+        }
+        void accumulateLine(unsigned i, float scale, float *out) const {
+            const float *l = line(i);
+            for(unsigned j = 0; j < _columns; j++) {
+                out[j] += scale * l[j];
+            }
+        }
+        bool references(const Matrix *M) const { return this == M; }
+
     private:
+        /*!
+         * \brief Set the matrix size without initializing its elements.
+         */
+        void reshape(unsigned lines, unsigned columns);
+
+        /*!
+         * \brief Evaluates the given expression into this Matrix instance, which it should not read.
+         */
+        template <typename E>
+        void evaluate(const E &expression);
+
+        /*!
+         * \return A per-thread Matrix used to evaluate expressions that read their destination.
+         */
+        static Matrix& scratch();
+
         /*!
          * \brief Allocate into this Matrix instance using the _lines and _columns params.
+         * \note The current buffer is kept if it has enough capacity.
          */
         void allocate();
 
@@ -177,8 +314,100 @@ namespace Math {
 
         unsigned _lines;
         unsigned _columns;
-        float** _matrix;
+        unsigned _stride;
+        size_t _capacity;
+        float* _data;
     };
+
+    template <typename E>
+    Matrix::Matrix(const MatrixExpression<E> &expression) : Matrix() {
+        evaluate(expression.derived());
+    }
+
+    template <typename E>
+    Matrix& Matrix::operator=(const MatrixExpression<E> &expression) {
+        const E &e = expression.derived();
+        if(e.references(this)) {
+            Matrix &temp = scratch();
+            temp.evaluate(e);
+            swap(temp);
+        } else {
+            evaluate(e);
+        }
+
+        return *this;
+    }
+
+    template <typename E>
+    void Matrix::operator+=(const MatrixExpression<E> &expression) {
+        const E &e = expression.derived();
+        assert(lines() == e.lines() && columns() == e.columns());
+        if(e.references(this)) {
+            (*this) = (*this) + e;
+            return;
+        }
+
+        for(unsigned i = 0; i < lines(); i++) {
+            e.accumulateLine(i, 1.0f, line(i));
+        }
+    }
+
+    template <typename E>
+    void Matrix::operator-=(const MatrixExpression<E> &expression) {
+        const E &e = expression.derived();
+        assert(lines() == e.lines() && columns() == e.columns());
+        if(e.references(this)) {
+            (*this) = (*this) - e;
+            return;
+        }
+
+        for(unsigned i = 0; i < lines(); i++) {
+            e.accumulateLine(i, -1.0f, line(i));
+        }
+    }
+
+    template <typename E>
+    void Matrix::evaluate(const E &expression) {
+        if constexpr (IsMatrixProduct<E>::value) {
+            // Plain products go through the blocked kernel of multiply()
+            multiply(expression.left(), expression.right(), *this);
+        } else if constexpr (IsMatrixProductSum<E>::value) {
+            multiply(expression.left().left(), expression.left().right(), *this);
+            for(unsigned i = 0; i < lines(); i++) {
+                expression.right().accumulateLine(i, IsMatrixProductSum<E>::sign, line(i));
+            }
+        } else {
+            reshape(expression.lines(), expression.columns());
+            for(unsigned i = 0; i < lines(); i++) {
+                expression.evaluateLine(i, line(i));
+            }
+        }
+    }
+
+    /*!
+     * \brief Operators between a temporary Matrix and a matrix expression, which store the result
+     * in the temporary instead of allocating a new Matrix.
+     */
+    template <typename E>
+    Matrix operator+(Matrix &&M, const MatrixExpression<E> &expression) {
+        M += expression;
+        return std::move(M);
+    }
+
+    template <typename E>
+    Matrix operator-(Matrix &&M, const MatrixExpression<E> &expression) {
+        M -= expression;
+        return std::move(M);
+    }
+
+    /*!
+     * \brief Operators between a temporary Matrix and a scalar, which store the result in the
+     * temporary instead of allocating a new Matrix.
+     */
+    Matrix operator+(Matrix &&M, float k);
+    Matrix operator-(Matrix &&M, float k);
+    Matrix operator*(Matrix &&M, float k);
+    Matrix operator/(Matrix &&M, float k);
 }
 
 #endif // ARMORIAL_MATH_MATRIX_H
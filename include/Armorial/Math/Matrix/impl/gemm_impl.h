@@ -0,0 +1,38 @@
+#ifndef ARMORIAL_MATH_GEMM_IMPL_H
+#define ARMORIAL_MATH_GEMM_IMPL_H
+
+namespace Math {
+namespace impl {
+    /*!
+     * \brief Micro-kernels available for the matrix product.
+     */
+    enum class GemmKernel { Scalar, SSE, AVX2 };
+
+    /*!
+     * \return The fastest micro-kernel supported by the running CPU.
+     */
+    GemmKernel bestGemmKernel();
+
+    /*!
+     * \return True if the given micro-kernel is supported by the running CPU.
+     */
+    bool isGemmKernelSupported(GemmKernel kernel);
+
+    /*!
+     * \brief Computes C += A * B, where A is m x k, B is k x n and C is m x n, all in row-major order.
+     * The operands are split in blocks that fit in the caches, packed in contiguous panels and
+     * multiplied by a register-tiled SIMD micro-kernel. Large products are split across threads.
+     * \param m, n, k The dimensions of the product.
+     * \param A, B, C The operands and the result, and lda, ldb, ldc the distance between their lines.
+     * \param threads The maximum amount of threads. Zero uses all the hardware threads.
+     * \param kernel The micro-kernel, which should be supported by the running CPU.
+     */
+    void gemm(unsigned m, unsigned n, unsigned k,
+              const float *A, unsigned lda,
+              const float *B, unsigned ldb,
+              float *C, unsigned ldc,
+              unsigned threads = 0, GemmKernel kernel = bestGemmKernel());
+}
+}
+
+#endif // ARMORIAL_MATH_GEMM_IMPL_H
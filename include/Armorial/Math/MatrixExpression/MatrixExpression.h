@@ -0,0 +1,382 @@
+#ifndef ARMORIAL_MATH_MATRIXEXPRESSION_H
+#define ARMORIAL_MATH_MATRIXEXPRESSION_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <assert.h>
+
+namespace Math {
+    class Matrix;
+
+    template <typename E> class MatrixTranspose;
+
+    /*!
+     * \brief The Math::MatrixExpression class is the base of every lazily evaluated matrix expression
+     * (CRTP). Operators between expressions do not compute anything: they build a lightweight tree,
+     * which is evaluated line by line straight into the destination Matrix when it is assigned. This
+     * way, an expression such as F * P * F.transposed() + Q needs no intermediate Matrix.
+     * \tparam E The derived expression type, which provides:
+     * - lines() and columns();
+     * - coeff(i, j), the element at the given line and column;
+     * - evaluateLine(i, out), which writes the i-th line into out;
+     * - accumulateLine(i, scale, out), which adds scale times the i-th line into out;
+     * - references(M), which tells whether the given Matrix is read by the expression;
+     * - CheapCoefficients, which tells whether coeff(i, j) runs in constant time.
+     * \note Expressions keep references to the Matrix instances they read, so they should be
+     * assigned to a Matrix before these go out of scope (avoid storing them with auto).
+     */
+    template <typename E>
+    class MatrixExpression {
+    public:
+        /*!
+         * \return This expression as its derived type.
+         */
+        const E& derived() const { return static_cast<const E&>(*this); }
+
+        /*!
+         * \return A view of the transpose of this expression, which does not copy any element.
+         */
+        MatrixTranspose<E> transposed() const { return MatrixTranspose<E>(derived()); }
+
+    protected:
+        MatrixExpression() = default;
+        ~MatrixExpression() = default;
+    };
+
+    /*!
+     * \brief How an expression is stored inside another: Matrix leaves are kept by reference and the
+     * remaining (lightweight) expressions by value.
+     */
+    template <typename E>
+    using MatrixNested = std::conditional_t<std::is_same_v<E, Matrix>, const Matrix&, const E>;
+
+    /*!
+     * \brief How an expression is stored when it has to be read element by element in any order:
+     * expressions whose elements are expensive to compute (products) are evaluated into a Matrix.
+     */
+    template <typename E>
+    using MatrixEvaluated = std::conditional_t<E::CheapCoefficients, MatrixNested<E>, const Matrix>;
+
+    /*!
+     * \brief Buffer for a single matrix line, which lives inline for up to InlineSize columns.
+     */
+    class MatrixLineBuffer {
+    public:
+        static constexpr unsigned InlineSize = 64;
+
+        float* get(unsigned size) {
+            if(size <= InlineSize) {
+                return _inline;
+            }
+            if(_heap.size() < size) {
+                _heap.resize(size);
+            }
+            return _heap.data();
+        }
+
+    private:
+        float _inline[InlineSize];
+        std::vector<float> _heap;
+    };
+
+    /*!
+     * \brief Transpose of a matrix expression.
+     */
+    template <typename E>
+    class MatrixTranspose : public MatrixExpression<MatrixTranspose<E>> {
+    public:
+        static constexpr bool CheapCoefficients = true;
+
+        explicit MatrixTranspose(const E &expression) : _expression(expression) {}
+
+        unsigned lines() const { return _expression.columns(); }
+        unsigned columns() const { return _expression.lines(); }
+        float coeff(unsigned i, unsigned j) const { return _expression.coeff(j, i); }
+
+        void evaluateLine(unsigned i, float *out) const {
+            for(unsigned j = 0; j < columns(); j++) {
+                out[j] = _expression.coeff(j, i);
+            }
+        }
+
+        void accumulateLine(unsigned i, float scale, float *out) const {
+            for(unsigned j = 0; j < columns(); j++) {
+                out[j] += scale * _expression.coeff(j, i);
+            }
+        }
+
+        bool references(const Matrix *M) const { return _expression.references(M); }
+
+        /*!
+         * \return The transposed expression.
+         */
+        const E& nested() const { return _expression; }
+
+    private:
+        MatrixEvaluated<E> _expression;
+    };
+
+    template <typename E>
+    struct IsMatrixTranspose : std::false_type {};
+
+    template <>
+    struct IsMatrixTranspose<MatrixTranspose<Matrix>> : std::true_type {};
+
+    /*!
+     * \brief Element-wise sum (Sign = 1) or difference (Sign = -1) of two matrix expressions.
+     */
+    template <typename L, typename R, int Sign>
+    class MatrixSum : public MatrixExpression<MatrixSum<L, R, Sign>> {
+    public:
+        static constexpr bool CheapCoefficients = L::CheapCoefficients && R::CheapCoefficients;
+
+        MatrixSum(const L &left, const R &right) : _left(left), _right(right) {
+            assert(left.lines() == right.lines() && left.columns() == right.columns());
+        }
+
+        unsigned lines() const { return _left.lines(); }
+        unsigned columns() const { return _left.columns(); }
+        float coeff(unsigned i, unsigned j) const { return _left.coeff(i, j) + Sign * _right.coeff(i, j); }
+
+        const auto& left() const { return _left; }
+        const auto& right() const { return _right; }
+
+        void evaluateLine(unsigned i, float *out) const {
+            _left.evaluateLine(i, out);
+            _right.accumulateLine(i, float(Sign), out);
+        }
+
+        void accumulateLine(unsigned i, float scale, float *out) const {
+            _left.accumulateLine(i, scale, out);
+            _right.accumulateLine(i, Sign * scale, out);
+        }
+
+        bool references(const Matrix *M) const { return _left.references(M) || _right.references(M); }
+
+    private:
+        MatrixNested<L> _left;
+        MatrixNested<R> _right;
+    };
+
+    /*!
+     * \brief Product of two matrix expressions. Each line of the result is computed as the sum of the
+     * lines of the right operand weighted by the elements of the respective line of the left one, which
+     * walks all the operands contiguously. When the right operand is a transposed Matrix, each element
+     * is computed instead as the dot product of two (contiguous) lines.
+     */
+    template <typename L, typename R>
+    class MatrixProduct : public MatrixExpression<MatrixProduct<L, R>> {
+    public:
+        static constexpr bool CheapCoefficients = false;
+
+        MatrixProduct(const L &left, const R &right) : _left(left), _right(right) {
+            assert(left.columns() == right.lines());
+        }
+
+        unsigned lines() const { return _left.lines(); }
+        unsigned columns() const { return _right.columns(); }
+
+        const auto& left() const { return _left; }
+        const auto& right() const { return _right; }
+
+        float coeff(unsigned i, unsigned j) const {
+            float value = 0.0f;
+            for(unsigned k = 0; k < _left.columns(); k++) {
+                value += _left.coeff(i, k) * _right.coeff(k, j);
+            }
+            return value;
+        }
+
+        void evaluateLine(unsigned i, float *out) const {
+            std::fill(out, out + columns(), 0.0f);
+            accumulateLine(i, 1.0f, out);
+        }
+
+        void accumulateLine(unsigned i, float scale, float *out) const {
+            const float *leftLine;
+            if constexpr (std::is_same_v<L, Matrix>) {
+                leftLine = _left.line(i);
+            } else {
+                float *buffer = _buffer.get(_left.columns());
+                _left.evaluateLine(i, buffer);
+                leftLine = buffer;
+            }
+
+            if constexpr (IsMatrixTranspose<R>::value) {
+                const auto &right = _right.nested();
+                for(unsigned j = 0; j < columns(); j++) {
+                    const float *rightLine = right.line(j);
+                    float value = 0.0f;
+                    for(unsigned k = 0; k < _left.columns(); k++) {
+                        value += leftLine[k] * rightLine[k];
+                    }
+                    out[j] += scale * value;
+                }
+            } else {
+                for(unsigned k = 0; k < _left.columns(); k++) {
+                    _right.accumulateLine(k, scale * leftLine[k], out);
+                }
+            }
+        }
+
+        bool references(const Matrix *M) const { return _left.references(M) || _right.references(M); }
+
+    private:
+        MatrixNested<L> _left;
+        MatrixEvaluated<R> _right;
+        mutable MatrixLineBuffer _buffer;
+    };
+
+    /*!
+     * \brief Products between two Matrix instances (optionally followed by a sum or difference),
+     * which Matrix evaluates as a whole with the blocked product kernel instead of line by line.
+     */
+    template <typename E>
+    struct IsMatrixProduct : std::false_type {};
+
+    template <>
+    struct IsMatrixProduct<MatrixProduct<Matrix, Matrix>> : std::true_type {};
+
+    template <typename E>
+    struct IsMatrixProductSum : std::false_type {};
+
+    template <typename R, int Sign>
+    struct IsMatrixProductSum<MatrixSum<MatrixProduct<Matrix, Matrix>, R, Sign>> : std::true_type {
+        static constexpr float sign = Sign;
+    };
+
+    /*!
+     * \brief Operations between a matrix expression and a scalar.
+     */
+    enum class MatrixScalarOperation { Add, Multiply, Divide };
+
+    template <typename E, MatrixScalarOperation Operation>
+    class MatrixScalar : public MatrixExpression<MatrixScalar<E, Operation>> {
+    public:
+        static constexpr bool CheapCoefficients = E::CheapCoefficients;
+
+        MatrixScalar(const E &expression, float k) : _expression(expression), _k(k) {
+            if constexpr (Operation == MatrixScalarOperation::Divide) {
+                assert(std::fabs(k) > std::numeric_limits<double>::epsilon());
+            }
+        }
+
+        unsigned lines() const { return _expression.lines(); }
+        unsigned columns() const { return _expression.columns(); }
+        float coeff(unsigned i, unsigned j) const { return apply(_expression.coeff(i, j)); }
+
+        void evaluateLine(unsigned i, float *out) const {
+            _expression.evaluateLine(i, out);
+            for(unsigned j = 0; j < columns(); j++) {
+                out[j] = apply(out[j]);
+            }
+        }
+
+        void accumulateLine(unsigned i, float scale, float *out) const {
+            if constexpr (Operation == MatrixScalarOperation::Multiply) {
+                _expression.accumulateLine(i, scale * _k, out);
+            } else {
+                float *line = _buffer.get(columns());
+                evaluateLine(i, line);
+                for(unsigned j = 0; j < columns(); j++) {
+                    out[j] += scale * line[j];
+                }
+            }
+        }
+
+        bool references(const Matrix *M) const { return _expression.references(M); }
+
+    private:
+        float apply(float value) const {
+            if constexpr (Operation == MatrixScalarOperation::Add) {
+                return value + _k;
+            } else if constexpr (Operation == MatrixScalarOperation::Multiply) {
+                return value * _k;
+            } else {
+                return value / _k;
+            }
+        }
+
+        MatrixNested<E> _expression;
+        float _k;
+        mutable MatrixLineBuffer _buffer;
+    };
+
+    /*!
+     * \brief Operators between matrix expressions, which return lazily evaluated expressions.
+     */
+    template <typename L, typename R>
+    MatrixSum<L, R, 1> operator+(const MatrixExpression<L> &left, const MatrixExpression<R> &right) {
+        return MatrixSum<L, R, 1>(left.derived(), right.derived());
+    }
+
+    template <typename L, typename R>
+    MatrixSum<L, R, -1> operator-(const MatrixExpression<L> &left, const MatrixExpression<R> &right) {
+        return MatrixSum<L, R, -1>(left.derived(), right.derived());
+    }
+
+    template <typename L, typename R>
+    MatrixProduct<L, R> operator*(const MatrixExpression<L> &left, const MatrixExpression<R> &right) {
+        return MatrixProduct<L, R>(left.derived(), right.derived());
+    }
+
+    /*!
+     * \brief Operators between a matrix expression and a scalar, which return lazily evaluated expressions.
+     */
+    template <typename E>
+    MatrixScalar<E, MatrixScalarOperation::Add> operator+(const MatrixExpression<E> &expression, float k) {
+        return MatrixScalar<E, MatrixScalarOperation::Add>(expression.derived(), k);
+    }
+
+    template <typename E>
+    MatrixScalar<E, MatrixScalarOperation::Add> operator-(const MatrixExpression<E> &expression, float k) {
+        return MatrixScalar<E, MatrixScalarOperation::Add>(expression.derived(), -k);
+    }
+
+    template <typename E>
+    MatrixScalar<E, MatrixScalarOperation::Multiply> operator*(const MatrixExpression<E> &expression, float k) {
+        return MatrixScalar<E, MatrixScalarOperation::Multiply>(expression.derived(), k);
+    }
+
+    template <typename E>
+    MatrixScalar<E, MatrixScalarOperation::Multiply> operator*(float k, const MatrixExpression<E> &expression) {
+        return MatrixScalar<E, MatrixScalarOperation::Multiply>(expression.derived(), k);
+    }
+
+    template <typename E>
+    MatrixScalar<E, MatrixScalarOperation::Divide> operator/(const MatrixExpression<E> &expression, float k) {
+        return MatrixScalar<E, MatrixScalarOperation::Divide>(expression.derived(), k);
+    }
+
+    /*!
+     * \brief Compares two matrix expressions with the same shape, element by element, with the same
+     * tolerance as Utils::Compare::isEqual.
+     */
+    template <typename L, typename R>
+    bool operator==(const MatrixExpression<L> &left, const MatrixExpression<R> &right) {
+        const L &l = left.derived();
+        const R &r = right.derived();
+        assert(l.columns() == r.columns());
+        assert(l.lines() == r.lines());
+
+        MatrixLineBuffer leftBuffer, rightBuffer;
+        float *leftLine = leftBuffer.get(l.columns());
+        float *rightLine = rightBuffer.get(r.columns());
+        for(unsigned i = 0; i < l.lines(); i++) {
+            l.evaluateLine(i, leftLine);
+            r.evaluateLine(i, rightLine);
+            for(unsigned j = 0; j < l.columns(); j++) {
+                if(std::fabs(rightLine[j] - leftLine[j]) > std::numeric_limits<double>::epsilon()) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+#endif // ARMORIAL_MATH_MATRIXEXPRESSION_H
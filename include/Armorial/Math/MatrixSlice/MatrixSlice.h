@@ -0,0 +1,195 @@
+#ifndef ARMORIAL_MATH_MATRIXSLICE_H
+#define ARMORIAL_MATH_MATRIXSLICE_H
+
+#include <Armorial/Math/MatrixView/MatrixView.h>
+
+namespace Math {
+    /*!
+     * \brief The Math::MatrixSlice class is a writable Math::MatrixView: assigning to a slice writes
+     * straight into the elements of the Matrix it was taken from, so block-structured algorithms
+     * can update parts of a matrix in place, without copies.
+     * \note As a view, copying a slice copies the view (not the elements), while assigning to a
+     * slice (even from another slice) copies the elements.
+     */
+    class MatrixSlice : public MatrixView {
+    public:
+        /*!
+         * \brief MatrixSlice constructor, which views a whole Matrix.
+         */
+        MatrixSlice(Matrix &M) : MatrixView(M) {}
+
+        /*!
+         * \brief MatrixSlice constructor, which views elements given by a pointer and strides.
+         * \see MatrixView::MatrixView.
+         */
+        MatrixSlice(float *data, unsigned lines, unsigned columns, unsigned lineStride, unsigned columnStride = 1,
+                    Matrix *owner = nullptr)
+            : MatrixView(data, lines, columns, lineStride, columnStride, owner) {}
+
+        MatrixSlice(const MatrixSlice &slice) = default;
+
+        /*!
+         * \brief Writable element access.
+         */
+        float& operator()(unsigned i, unsigned j) {
+            assert(i < _lines && j < _columns);
+            return *writableElement(i, j);
+        }
+
+        using MatrixView::operator();
+
+        void set(unsigned i, unsigned j, float value) { (*this)(i, j) = value; }
+
+        /*!
+         * \return Writable slices of a block, line, column or strided subset of this slice.
+         * \see MatrixView::block, MatrixView::strided.
+         */
+        MatrixSlice block(unsigned i, unsigned j, unsigned lines, unsigned columns) {
+            return MatrixSlice(MatrixView::block(i, j, lines, columns));
+        }
+        MatrixSlice lineBlock(unsigned i) { return block(i, 0, 1, _columns); }
+        MatrixSlice columnBlock(unsigned j) { return block(0, j, _lines, 1); }
+        MatrixSlice strided(unsigned lineStep, unsigned columnStep) {
+            return MatrixSlice(MatrixView::strided(lineStep, columnStep));
+        }
+        MatrixSlice transposed() { return MatrixSlice(MatrixView::transposed()); }
+
+        using MatrixView::block;
+        using MatrixView::lineBlock;
+        using MatrixView::columnBlock;
+        using MatrixView::strided;
+        using MatrixView::transposed;
+
+        /*!
+         * \brief Assigns the elements of a matrix expression (of the same size) to this slice.
+         * \note If the expression reads the Matrix this slice was taken from, it is evaluated into a
+         * temporary first, so overlapping blocks are handled correctly.
+         */
+        template <typename E>
+        MatrixSlice& operator=(const MatrixExpression<E> &expression);
+        MatrixSlice& operator=(const MatrixSlice &slice);
+
+        /*!
+         * \brief Adds (or subtracts) a matrix expression of the same size to this slice.
+         */
+        template <typename E>
+        MatrixSlice& operator+=(const MatrixExpression<E> &expression);
+        template <typename E>
+        MatrixSlice& operator-=(const MatrixExpression<E> &expression);
+
+        /*!
+         * \brief Element-wise operations with a scalar.
+         */
+        MatrixSlice& operator*=(float k);
+        MatrixSlice& operator/=(float k) { return (*this) *= (1.0f / k); }
+
+        /*!
+         * \brief Sets every element of this slice to the given value.
+         */
+        void fill(float value);
+
+    private:
+        explicit MatrixSlice(const MatrixView &view) : MatrixView(view) {}
+
+        // The elements are only viewed as const by the base class
+        float* writableElement(unsigned i, unsigned j) { return const_cast<float*>(element(i, j)); }
+        float* writableLine(unsigned i) { return writableElement(i, 0); }
+
+        /*!
+         * \brief Writes or adds (with the given scale) a line into the i-th line of this slice.
+         */
+        void storeLine(unsigned i, const float *line);
+        void addLine(unsigned i, float scale, const float *line);
+
+        template <typename E>
+        void apply(const E &expression, float scale, bool accumulate);
+    };
+
+    template <typename E>
+    MatrixSlice& MatrixSlice::operator=(const MatrixExpression<E> &expression) {
+        apply(expression.derived(), 1.0f, false);
+        return *this;
+    }
+
+    inline MatrixSlice& MatrixSlice::operator=(const MatrixSlice &slice) {
+        apply(static_cast<const MatrixView&>(slice), 1.0f, false);
+        return *this;
+    }
+
+    template <typename E>
+    MatrixSlice& MatrixSlice::operator+=(const MatrixExpression<E> &expression) {
+        apply(expression.derived(), 1.0f, true);
+        return *this;
+    }
+
+    template <typename E>
+    MatrixSlice& MatrixSlice::operator-=(const MatrixExpression<E> &expression) {
+        apply(expression.derived(), -1.0f, true);
+        return *this;
+    }
+
+    inline MatrixSlice& MatrixSlice::operator*=(float k) {
+        for(unsigned i = 0; i < _lines; i++) {
+            for(unsigned j = 0; j < _columns; j++) {
+                *writableElement(i, j) *= k;
+            }
+        }
+        return *this;
+    }
+
+    inline void MatrixSlice::fill(float value) {
+        for(unsigned i = 0; i < _lines; i++) {
+            for(unsigned j = 0; j < _columns; j++) {
+                *writableElement(i, j) = value;
+            }
+        }
+    }
+
+    inline void MatrixSlice::storeLine(unsigned i, const float *line) {
+        float *out = writableLine(i);
+        if(isLineContiguous()) {
+            std::copy(line, line + _columns, out);
+        } else {
+            for(unsigned j = 0; j < _columns; j++) {
+                out[size_t(j) * _columnStride] = line[j];
+            }
+        }
+    }
+
+    inline void MatrixSlice::addLine(unsigned i, float scale, const float *line) {
+        float *out = writableLine(i);
+        for(unsigned j = 0; j < _columns; j++) {
+            out[size_t(j) * _columnStride] += scale * line[j];
+        }
+    }
+
+    template <typename E>
+    void MatrixSlice::apply(const E &expression, float scale, bool accumulate) {
+        assert(expression.lines() == _lines && expression.columns() == _columns);
+
+        if(expression.references(_owner)) {
+            // Evaluate first, as writing a line could change elements read by the next ones
+            const Matrix temp(expression);
+            for(unsigned i = 0; i < _lines; i++) {
+                accumulate ? addLine(i, scale, temp.line(i)) : storeLine(i, temp.line(i));
+            }
+            return;
+        }
+
+        if(isLineContiguous()) {
+            for(unsigned i = 0; i < _lines; i++) {
+                accumulate ? expression.accumulateLine(i, scale, writableLine(i))
+                           : expression.evaluateLine(i, writableLine(i));
+            }
+        } else {
+            MatrixLineBuffer buffer;
+            float *line = buffer.get(_columns);
+            for(unsigned i = 0; i < _lines; i++) {
+                expression.evaluateLine(i, line);
+                accumulate ? addLine(i, scale, line) : storeLine(i, line);
+            }
+        }
+    }
+}
+
+#endif // ARMORIAL_MATH_MATRIXSLICE_H
@@ -0,0 +1,145 @@
+#ifndef ARMORIAL_MATH_MATRIXVIEW_H
+#define ARMORIAL_MATH_MATRIXVIEW_H
+
+#include <Armorial/Math/Matrix/Matrix.h>
+
+namespace Math {
+    /*!
+     * \brief The Math::MatrixView class is a read-only view over elements stored elsewhere (usually
+     * in a Math::Matrix), placed at a fixed distance between lines and between columns. Lines,
+     * columns, blocks, transposes and strided subsets of a matrix are all views over its buffer,
+     * so taking them copies no element. Views are matrix expressions, so they can be used in any
+     * arithmetic expression, and can be passed to the decompositions.
+     * \note A view does not own its elements: it should not outlive the Matrix it was taken from,
+     * nor be used after that Matrix is resized.
+     */
+    class MatrixView : public MatrixExpression<MatrixView> {
+    public:
+        static constexpr bool CheapCoefficients = true;
+
+        /*!
+         * \brief Default MatrixView constructor, which creates an empty view.
+         */
+        MatrixView() : _owner(nullptr), _data(nullptr), _lines(0), _columns(0), _lineStride(0), _columnStride(0) {}
+
+        /*!
+         * \brief MatrixView constructor, which views a whole Matrix.
+         */
+        MatrixView(const Matrix &M)
+            : _owner(&M), _data(M.data()), _lines(M.lines()), _columns(M.columns()), _lineStride(M.stride()), _columnStride(1) {}
+
+        /*!
+         * \brief MatrixView constructor, which views elements given by a pointer and strides.
+         * \param data The pointer to the first element.
+         * \param lines, columns The size of the view.
+         * \param lineStride, columnStride The distance (in elements) between consecutive lines and columns.
+         * \param owner The Matrix that stores the elements, if any, which is used to detect aliasing.
+         */
+        MatrixView(const float *data, unsigned lines, unsigned columns, unsigned lineStride, unsigned columnStride = 1,
+                   const Matrix *owner = nullptr)
+            : _owner(owner), _data(data), _lines(lines), _columns(columns), _lineStride(lineStride), _columnStride(columnStride) {}
+
+        /*!
+         * \brief Getters for the view size and layout.
+         */
+        unsigned lines() const { return _lines; }
+        unsigned columns() const { return _columns; }
+        unsigned lineStride() const { return _lineStride; }
+        unsigned columnStride() const { return _columnStride; }
+        const float* data() const { return _data; }
+        const Matrix* owner() const { return _owner; }
+
+        /*!
+         * \return True if the elements of each line are contiguous.
+         */
+        bool isLineContiguous() const { return _columnStride == 1; }
+
+        /*!
+         * \return The element at the given line and column.
+         */
+        float get(unsigned i, unsigned j) const {
+            assert(i < _lines && j < _columns);
+            return _data[size_t(i) * _lineStride + size_t(j) * _columnStride];
+        }
+
+        float operator()(unsigned i, unsigned j) const { return get(i, j); }
+
+        /*!
+         * \return A view of the block with the given size starting at the given line and column.
+         */
+        MatrixView block(unsigned i, unsigned j, unsigned lines, unsigned columns) const {
+            assert(i + lines <= _lines && j + columns <= _columns);
+            return MatrixView(element(i, j), lines, columns, _lineStride, _columnStride, _owner);
+        }
+
+        /*!
+         * \return A view of the i-th line (as a 1 x columns() matrix) or of the j-th column (as a
+         * lines() x 1 matrix).
+         */
+        MatrixView lineBlock(unsigned i) const { return block(i, 0, 1, _columns); }
+        MatrixView columnBlock(unsigned j) const { return block(0, j, _lines, 1); }
+
+        /*!
+         * \return A view of every lineStep-th line and columnStep-th column, starting at the first.
+         */
+        MatrixView strided(unsigned lineStep, unsigned columnStep) const {
+            assert(lineStep > 0 && columnStep > 0);
+            return MatrixView(_data, (_lines + lineStep - 1) / lineStep, (_columns + columnStep - 1) / columnStep,
+                              _lineStride * lineStep, _columnStride * columnStep, _owner);
+        }
+
+        /*!
+         * \return A view of the transpose, which swaps the strides.
+         */
+        MatrixView transposed() const {
+            return MatrixView(_data, _columns, _lines, _columnStride, _lineStride, _owner);
+        }
+
+        /*!
+         * \brief Matrix expression interface.
+         */
+        float coeff(unsigned i, unsigned j) const {
+            return _data[size_t(i) * _lineStride + size_t(j) * _columnStride];
+        }
+
+        void evaluateLine(unsigned i, float *out) const {
+            const float *line = _data + size_t(i) * _lineStride;
+            if(isLineContiguous()) {
+                std::copy(line, line + _columns, out);
+            } else {
+                for(unsigned j = 0; j < _columns; j++) {
+                    out[j] = line[size_t(j) * _columnStride];
+                }
+            }
+        }
+
+        void accumulateLine(unsigned i, float scale, float *out) const {
+            const float *line = _data + size_t(i) * _lineStride;
+            if(isLineContiguous()) {
+                for(unsigned j = 0; j < _columns; j++) {
+                    out[j] += scale * line[j];
+                }
+            } else {
+                for(unsigned j = 0; j < _columns; j++) {
+                    out[j] += scale * line[size_t(j) * _columnStride];
+                }
+            }
+        }
+
+        bool references(const Matrix *M) const { return (_owner != nullptr && _owner == M); }
+
+    protected:
+        const float* element(unsigned i, unsigned j) const {
+            return _data + size_t(i) * _lineStride + size_t(j) * _columnStride;
+        }
+
+        const Matrix *_owner;
+        const float *_data;
+        unsigned _lines;
+        unsigned _columns;
+        unsigned _lineStride;
+        unsigned _columnStride;
+    };
+}
+
+#endif // ARMORIAL_MATH_MATRIXVIEW_H
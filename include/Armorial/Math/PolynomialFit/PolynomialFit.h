@@ -0,0 +1,99 @@
+#ifndef ARMORIAL_MATH_POLYNOMIALFIT_H
+#define ARMORIAL_MATH_POLYNOMIALFIT_H
+
+#include <Armorial/Math/QR/QR.h>
+
+#include <utility>
+
+namespace Math {
+    /*!
+     * \brief The Math::PolynomialFit class fits least squares polynomials of a given degree to series
+     * of samples taken at the same positions (e.g. the x and y coordinates of a ball trajectory, both
+     * sampled at the same timestamps). The least squares problem is factorized once by Math::QR in
+     * the constructor, so each series is fitted in O(samples * degree) time.
+     * \note The positions are centered and scaled to [-1, 1] before building the Vandermonde matrix,
+     * which keeps it well conditioned for large positions (e.g. timestamps in seconds). The fitted
+     * polynomials keep the center, so they are never expanded back into powers of the raw positions.
+     */
+    class PolynomialFit {
+    public:
+        /*!
+         * \brief The Math::PolynomialFit::Polynomial class holds a fitted polynomial in powers of
+         * (x - center), with double coefficients.
+         */
+        class Polynomial {
+        public:
+            /*!
+             * \brief Polynomial constructor.
+             * \param center The position around which the polynomial is expanded.
+             * \param coefficients The coefficients c, where p(x) = c[0] + c[1] * (x - center) + ...
+             */
+            Polynomial(double center, std::vector<double> coefficients)
+                : _center(center), _coefficients(std::move(coefficients)) {}
+
+            /*!
+             * \return The center of the expansion and the coefficients in powers of (x - center()).
+             */
+            double center() const { return _center; }
+            const std::vector<double>& coefficients() const { return _coefficients; }
+
+            /*!
+             * \return The value of the polynomial at x, by Horner's method on (x - center()).
+             */
+            float evaluate(float x) const;
+
+        private:
+            double _center;
+            std::vector<double> _coefficients;
+        };
+
+        /*!
+         * \brief PolynomialFit constructor, which factorizes the problem for the given sample positions.
+         * \param x The positions of the samples.
+         * \param degree The degree of the fitted polynomials.
+         */
+        PolynomialFit(const std::vector<float> &x, unsigned degree);
+
+        /*!
+         * \return The degree of the fitted polynomials and the number of samples.
+         */
+        unsigned degree() const { return _degree; }
+        unsigned samples() const { return _samples; }
+
+        /*!
+         * \return True if the positions determine a unique polynomial (there are more than degree()
+         * distinct positions), false otherwise.
+         */
+        bool isValid() const { return _qr.isFullRank(); }
+
+        /*!
+         * \brief Fits a polynomial to a series of samples.
+         * \param y The sample values, one for each position given in the constructor.
+         * \return A std::optional<Polynomial> of degree(), centered at the middle of the positions, or
+         * std::nullopt if !isValid().
+         */
+        std::optional<Polynomial> fit(const std::vector<float> &y) const;
+
+        /*!
+         * \brief Fits a polynomial to each column of Y in a single pass.
+         * \param Y The sample values, with samples() lines and one column per series.
+         * \return A std::optional<std::vector<Polynomial>> with the polynomial of each column (as in
+         * fit()), or std::nullopt if !isValid().
+         */
+        std::optional<std::vector<Polynomial>> fit(const MatrixView &Y) const;
+
+    private:
+        /*!
+         * \brief PolynomialFit constructor, given the center and half-width used to normalize the positions.
+         */
+        PolynomialFit(const std::vector<float> &x, unsigned degree, std::pair<double, double> normalization);
+
+        unsigned _degree;
+        unsigned _samples;
+        double _center;
+        double _scale;
+        QR _qr;
+    };
+}
+
+#endif // ARMORIAL_MATH_POLYNOMIALFIT_H
@@ -0,0 +1,76 @@
+#ifndef ARMORIAL_MATH_QR_H
+#define ARMORIAL_MATH_QR_H
+
+#include <Armorial/Math/Matrix/Matrix.h>
+#include <Armorial/Math/MatrixView/MatrixView.h>
+
+namespace Math {
+    /*!
+     * \brief The Math::QR class computes the QR decomposition (A = QR) of a matrix with at least as
+     * many lines as columns by Householder reflections. It solves linear least squares problems
+     * (minimizing |A * X - B|) without forming Aᵀ * A, whose condition number is the square of the
+     * condition number of A.
+     * \note The decomposition is computed in double precision, and the results are rounded to float.
+     */
+    class QR {
+    public:
+        /*!
+         * \brief QR constructor, which decomposes the given matrix.
+         * \param matrix The given matrix (or a view of it), with lines() >= columns().
+         */
+        QR(const Matrix &matrix);
+        QR(const MatrixView &matrix);
+
+        /*!
+         * \return The number of lines and columns of the decomposed matrix.
+         */
+        unsigned lines() const { return _lines; }
+        unsigned columns() const { return _columns; }
+
+        /*!
+         * \return True if the columns of the decomposed matrix are linearly independent (up to its
+         * float precision), false otherwise.
+         */
+        bool isFullRank() const { return _fullRank; }
+
+        /*!
+         * \brief Solves the linear least squares problem min |A * X - B|, where A is the decomposed matrix.
+         * \param B The given right-hand side (or a view of it), with lines() lines and any number of columns.
+         * \return A std::optional<Matrix> containing X (with columns() lines), or std::nullopt if the
+         * decomposed matrix is not full rank (see Math::SVD for rank-deficient problems).
+         */
+        std::optional<Matrix> solve(const Matrix &B) const;
+        std::optional<Matrix> solve(const MatrixView &B) const;
+
+        /*!
+         * \return The lines() x columns() factor Q, whose columns are orthonormal.
+         */
+        Matrix Q() const;
+
+        /*!
+         * \return The columns() x columns() upper triangular factor R.
+         */
+        Matrix R() const;
+
+    private:
+        /*!
+         * \brief Replaces b by Qᵀ * b, for a single right-hand side.
+         */
+        void applyTransposedQ(std::vector<double> &b) const;
+
+        /*!
+         * \brief Solves R * x = b in place, using the first columns() elements of b.
+         */
+        void solveR(std::vector<double> &b) const;
+
+        unsigned _lines;
+        unsigned _columns;
+        // Column-major storage: R above the diagonal and the Householder vectors from it downwards
+        std::vector<double> _qr;
+        std::vector<double> _tau;
+        std::vector<double> _diagonal;
+        bool _fullRank;
+    };
+}
+
+#endif // ARMORIAL_MATH_QR_H
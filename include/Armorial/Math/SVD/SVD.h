@@ -0,0 +1,87 @@
+#ifndef ARMORIAL_MATH_SVD_H
+#define ARMORIAL_MATH_SVD_H
+
+#include <Armorial/Math/Matrix/Matrix.h>
+#include <Armorial/Math/MatrixView/MatrixView.h>
+
+namespace Math {
+    /*!
+     * \brief The Math::SVD class computes the thin singular value decomposition (A = U * S * Vᵀ) of
+     * a matrix by one-sided Jacobi rotations, which is accurate even for tiny singular values. It is
+     * meant for small problems (a few columns), such as rank-deficient least squares, pseudo-inverses
+     * and condition numbers.
+     * \note The decomposition is computed in double precision, and the results are rounded to float.
+     */
+    class SVD {
+    public:
+        /*!
+         * \brief SVD constructor, which decomposes the given matrix.
+         * \param matrix The given matrix (or a view of it), of any shape.
+         */
+        SVD(const Matrix &matrix);
+        SVD(const MatrixView &matrix);
+
+        /*!
+         * \return The number of lines and columns of the decomposed matrix.
+         */
+        unsigned lines() const { return _lines; }
+        unsigned columns() const { return _columns; }
+
+        /*!
+         * \return The min(lines(), columns()) singular values, in decreasing order.
+         */
+        std::vector<float> singularValues() const;
+
+        /*!
+         * \return The numerical rank: the amount of singular values above the float rounding error
+         * of the largest one.
+         */
+        unsigned rank() const;
+
+        /*!
+         * \return The ratio between the largest and smallest singular values, which is infinite if
+         * the decomposed matrix is rank-deficient.
+         */
+        float conditionNumber() const;
+
+        /*!
+         * \return The lines() x min(lines(), columns()) factor U, whose columns are the left singular vectors.
+         */
+        Matrix U() const;
+
+        /*!
+         * \return The columns() x min(lines(), columns()) factor V, whose columns are the right singular vectors.
+         */
+        Matrix V() const;
+
+        /*!
+         * \brief Computes the minimum norm solution of the least squares problem min |A * X - B|, where A is
+         * the decomposed matrix, ignoring the singular values below the rank() tolerance.
+         * \param B The given right-hand side (or a view of it), with lines() lines and any number of columns.
+         * \return X, with columns() lines.
+         */
+        Matrix solve(const Matrix &B) const;
+        Matrix solve(const MatrixView &B) const;
+
+        /*!
+         * \return The Moore-Penrose pseudo-inverse of the decomposed matrix, with columns() lines and lines() columns.
+         */
+        Matrix pseudoInverse() const;
+
+    private:
+        /*!
+         * \return The singular values below this tolerance are taken as zero.
+         */
+        double tolerance() const;
+
+        unsigned _lines;
+        unsigned _columns;
+        unsigned _size;
+        // Column-major factors of min(lines, columns) columns, sorted by decreasing singular value
+        std::vector<double> _u;
+        std::vector<double> _v;
+        std::vector<double> _sigma;
+    };
+}
+
+#endif // ARMORIAL_MATH_SVD_H
@@ -0,0 +1,150 @@
+#ifndef ARMORIAL_PLANNING_PATHPLANNER_H
+#define ARMORIAL_PLANNING_PATHPLANNER_H
+
+#include <Armorial/Geometry/CircleSet/CircleSet.h>
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace Common {
+namespace Types {
+    class Field;
+}
+}
+
+namespace Planning {
+    /*!
+     * \brief The parameters of a Planning::PathPlanner. Lengths are in the units of the field
+     * (millimeters in the defaults) and times in seconds.
+     */
+    struct PlannerSettings {
+        // Radius of the planned robot and extra clearance kept from the obstacles
+        float robotRadius = 90.0f;
+        float safetyMargin = 20.0f;
+        // How far outside the field lines the paths may go
+        float fieldMargin = 200.0f;
+        // Wall-clock time a single plan may take
+        std::chrono::microseconds timeBudget = std::chrono::microseconds(200);
+        // Maximum length of a new tree edge, and radius in which new nodes look for better parents
+        float stepSize = 500.0f;
+        float rewireRadius = 750.0f;
+        // Probabilities of sampling the goal and around the previous path instead of the field
+        float goalBias = 0.15f;
+        float reuseBias = 0.25f;
+        // Capacity of the tree, which is only reached if the time budget is not
+        size_t maxNodes = 1024;
+        // Moving obstacles are swept along their velocity during this time
+        float predictionHorizon = 0.3f;
+        unsigned seed = 1;
+    };
+
+    /*!
+     * \brief An obstacle to be avoided, e.g. another robot.
+     * \param position The obstacle center.
+     * \param velocity The obstacle velocity, in units of the field per second.
+     * \param radius The obstacle radius.
+     */
+    struct Obstacle {
+        Geometry::Vector2D position;
+        Geometry::Vector2D velocity;
+        float radius = 90.0f;
+    };
+
+    /*!
+     * \brief A planned path.
+     * \param waypoints The waypoints from the start to the end of the path.
+     * \param length The length of the path.
+     * \param reachesGoal True if the path ends at the goal, and False if the goal could not be reached
+     * within the budget (the path then ends at the reachable point closest to the goal).
+     * \param iterations The amount of sampling iterations it took.
+     */
+    struct Path {
+        std::vector<Geometry::Vector2D> waypoints;
+        float length = 0.0f;
+        bool reachesGoal = false;
+        size_t iterations = 0;
+    };
+
+    /*!
+     * \brief The Planning::PathPlanner class plans collision-free paths for a robot among circular
+     * moving obstacles, inside the field bounds and within a hard time budget.
+     *
+     * It is an anytime RRT*: the tree grows (choosing the cheapest parent among the near nodes and
+     * rewiring them through the new node) until the time budget is spent, trying to connect each new
+     * node straight to the goal and keeping the shortest connection found. The path is then
+     * shortcut. Each planner keeps the path of the previous plan and seeds the next tree with it, so
+     * consecutive frames refine the same route instead of starting over.
+     *
+     * Obstacles are inflated by the robot radius and safety margin and swept along their velocities
+     * during the prediction horizon; obstacles that already contain the start are ignored, so that
+     * the robot can leave them.
+     */
+    class PathPlanner
+    {
+    public:
+        /*!
+         * \brief PathPlanner constructor.
+         * \param field The field whose bounds limit the paths.
+         * \param settings The parameters of the planner.
+         */
+        PathPlanner(const Common::Types::Field &field, const PlannerSettings &settings = PlannerSettings());
+
+        /*!
+         * \brief Plans a path from start to goal.
+         * \param start, goal The endpoints of the path. The goal is moved inside the field bounds.
+         * \param obstacles The obstacles to avoid.
+         * \param ignoredObstacle The index of an obstacle to ignore (e.g. the planned robot itself).
+         * \return The planned path, which stays valid until the next call.
+         */
+        const Path& plan(const Geometry::Vector2D &start, const Geometry::Vector2D &goal,
+                         const std::vector<Obstacle> &obstacles,
+                         size_t ignoredObstacle = std::numeric_limits<size_t>::max());
+
+        /*!
+         * \return The result of the last plan.
+         */
+        [[nodiscard]] const Path& path() const;
+
+        /*!
+         * \brief Forgets the previous path, so that the next plan starts from scratch.
+         */
+        void reset();
+
+        /*!
+         * \return The parameters of the planner.
+         */
+        [[nodiscard]] const PlannerSettings& settings() const;
+
+    private:
+        void buildObstacles(const Geometry::Vector2D &start, const std::vector<Obstacle> &obstacles, size_t ignoredObstacle);
+        [[nodiscard]] bool isFree(const Geometry::Vector2D &from, const Geometry::Vector2D &to) const;
+        [[nodiscard]] Geometry::Vector2D clampToBounds(const Geometry::Vector2D &point) const;
+        [[nodiscard]] Geometry::Vector2D sample(const Geometry::Vector2D &goal);
+        [[nodiscard]] size_t nearest(const Geometry::Vector2D &point) const;
+        size_t addNode(const Geometry::Vector2D &point, size_t parent);
+        void seedWithPreviousPath(const Geometry::Vector2D &goal);
+        void extractPath(size_t last, const Geometry::Vector2D &end, bool reachesGoal);
+        void shortcut();
+
+        PlannerSettings _settings;
+        float _minX, _maxX, _minY, _maxY;
+        std::mt19937 _generator;
+
+        Geometry::CircleSet _obstacles;
+
+        // Tree nodes, the root (index 0) being the start
+        std::vector<Geometry::Vector2D> _nodes;
+        std::vector<size_t> _parents;
+        std::vector<float> _costs;
+        std::vector<size_t> _near;
+
+        Path _path;
+        std::vector<Geometry::Vector2D> _previousWaypoints;
+    };
+}
+
+#endif // ARMORIAL_PLANNING_PATHPLANNER_H
@@ -0,0 +1,7 @@
+#ifndef ARMORIAL_PLANNING_H
+#define ARMORIAL_PLANNING_H
+
+#include "PathPlanner/PathPlanner.h"
+#include "TeamPlanner/TeamPlanner.h"
+
+#endif // ARMORIAL_PLANNING_H
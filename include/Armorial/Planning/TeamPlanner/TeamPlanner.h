@@ -0,0 +1,87 @@
+#ifndef ARMORIAL_PLANNING_TEAMPLANNER_H
+#define ARMORIAL_PLANNING_TEAMPLANNER_H
+
+#include <Armorial/Planning/PathPlanner/PathPlanner.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Planning {
+    /*!
+     * \brief A path to be planned by a Planning::TeamPlanner.
+     * \param start, goal The endpoints of the path.
+     * \param ignoredObstacle The index of an obstacle to ignore (e.g. the planned robot itself).
+     */
+    struct PlanningRequest {
+        Geometry::Vector2D start;
+        Geometry::Vector2D goal;
+        size_t ignoredObstacle = std::numeric_limits<size_t>::max();
+    };
+
+    /*!
+     * \brief The Planning::TeamPlanner class plans the paths of all the robots of a team in parallel,
+     * with one Planning::PathPlanner per robot (so that each one reuses its own previous path) and
+     * a pool of worker threads kept alive between frames. Each path is still limited by the time
+     * budget of the settings, so a frame takes about ceil(robots / threads) budgets.
+     */
+    class TeamPlanner
+    {
+    public:
+        /*!
+         * \brief TeamPlanner constructor.
+         * \param field The field whose bounds limit the paths.
+         * \param robots The amount of robots, i.e. the maximum amount of requests per frame.
+         * \param settings The parameters of the planners.
+         * \param threads The maximum amount of threads used, including the calling one.
+         */
+        TeamPlanner(const Common::Types::Field &field, size_t robots, const PlannerSettings &settings = PlannerSettings(),
+                    unsigned threads = std::thread::hardware_concurrency());
+        ~TeamPlanner();
+
+        TeamPlanner(const TeamPlanner &other) = delete;
+        TeamPlanner& operator=(const TeamPlanner &other) = delete;
+
+        /*!
+         * \brief Plans the paths of a frame, the i-th request being planned by the i-th planner.
+         * \param requests The paths to plan, at most one per robot.
+         * \param obstacles The obstacles shared by all the requests.
+         * \return The planned paths, in the order of the requests. Requests beyond the amount of robots are not planned.
+         */
+        const std::vector<Path>& plan(const std::vector<PlanningRequest> &requests, const std::vector<Obstacle> &obstacles);
+
+        /*!
+         * \return The planner of the given robot.
+         */
+        [[nodiscard]] PathPlanner& planner(size_t robot);
+
+        /*!
+         * \return The amount of robots.
+         */
+        [[nodiscard]] size_t size() const;
+
+    private:
+        void work();
+        void runRequests();
+
+        std::vector<PathPlanner> _planners;
+        std::vector<Path> _paths;
+
+        // Frame being planned
+        const std::vector<PlanningRequest> *_requests = nullptr;
+        const std::vector<Obstacle> *_obstacles = nullptr;
+        std::atomic<size_t> _nextRequest{0};
+
+        // Worker pool
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _startCondition;
+        std::condition_variable _doneCondition;
+        unsigned _generation = 0;
+        unsigned _pending = 0;
+        bool _stopping = false;
+    };
+}
+
+#endif // ARMORIAL_PLANNING_TEAMPLANNER_H
@@ -0,0 +1,121 @@
+#ifndef ARMORIAL_TRACKING_KALMANFILTER_H
+#define ARMORIAL_TRACKING_KALMANFILTER_H
+
+#include <Armorial/Math/FixedMatrix/FixedMatrix.h>
+
+#include <optional>
+
+namespace Tracking {
+    /*!
+     * \brief The Tracking::KalmanFilter class implements a linear Kalman filter with a state of N
+     * elements and measurements of M elements, using fixed-size matrixes (no heap allocation).
+     * The transition and process noise are given on each prediction, so the same filter can be
+     * used with a variable time step.
+     * \note The covariance is corrected in Joseph form, which keeps it symmetric and positive
+     * semi-definite in float precision.
+     */
+    template <unsigned N, unsigned M>
+    class KalmanFilter {
+    public:
+        using State = Math::FixedVector<N>;
+        using Covariance = Math::FixedMatrix<N, N>;
+        using Measurement = Math::FixedVector<M>;
+        using MeasurementCovariance = Math::FixedMatrix<M, M>;
+        using Observation = Math::FixedMatrix<M, N>;
+
+        /*!
+         * \brief Default KalmanFilter constructor, with a zero state, identity covariance, zero
+         * observation matrix and identity measurement noise.
+         */
+        KalmanFilter() : _P(Covariance::identity()), _R(MeasurementCovariance::identity()) {}
+
+        /*!
+         * \brief KalmanFilter constructor.
+         * \param x, P The initial state and its covariance.
+         * \param H The observation matrix, which maps a state to a measurement.
+         * \param R The measurement noise covariance.
+         */
+        KalmanFilter(const State &x, const Covariance &P, const Observation &H, const MeasurementCovariance &R)
+            : _x(x), _P(P), _H(H), _R(R) {}
+
+        /*!
+         * \brief Getters and setters for the filter parameters.
+         */
+        const State& state() const { return _x; }
+        const Covariance& covariance() const { return _P; }
+        const Observation& observation() const { return _H; }
+        const MeasurementCovariance& measurementNoise() const { return _R; }
+        void setState(const State &x) { _x = x; }
+        void setCovariance(const Covariance &P) { _P = P; }
+        void setObservation(const Observation &H) { _H = H; }
+        void setMeasurementNoise(const MeasurementCovariance &R) { _R = R; }
+
+        /*!
+         * \brief Propagates the state and its covariance: x = F * x, P = F * P * Fᵀ + Q.
+         * \param F The state transition matrix.
+         * \param Q The process noise covariance accumulated in the step.
+         */
+        void predict(const Covariance &F, const Covariance &Q) {
+            _x = F * _x;
+            _P = F * _P * F.transposed() + Q;
+        }
+
+        /*!
+         * \return The innovation (measurement residual) of a given measurement: z - H * x.
+         */
+        Measurement innovation(const Measurement &z) const {
+            return z - _H * _x;
+        }
+
+        /*!
+         * \return The covariance of the innovation: H * P * Hᵀ + R.
+         */
+        MeasurementCovariance innovationCovariance() const {
+            return _H * _P * _H.transposed() + _R;
+        }
+
+        /*!
+         * \return The squared Mahalanobis distance of a given innovation, using the inverse of the
+         * innovation covariance (which can be computed once for several measurements).
+         */
+        static float squaredDistance(const Measurement &y, const MeasurementCovariance &inverseS) {
+            return (y.transposed() * inverseS * y).get(0, 0);
+        }
+
+        /*!
+         * \brief Corrects the state with a given measurement.
+         * \return True if the update was applied, false if the innovation covariance is singular.
+         */
+        bool update(const Measurement &z) {
+            return correct(innovation(z));
+        }
+
+        /*!
+         * \brief Corrects the state with a given innovation, for measurements whose residual is not
+         * a plain difference (e.g. angles, which should be wrapped).
+         * \return True if the update was applied, false if the innovation covariance is singular.
+         */
+        bool correct(const Measurement &y) {
+            const std::optional<MeasurementCovariance> inverseS = innovationCovariance().inverse();
+            if(!inverseS.has_value()) {
+                return false;
+            }
+
+            const Math::FixedMatrix<N, M> K = _P * _H.transposed() * inverseS.value();
+            _x += K * y;
+
+            const Covariance IKH = Covariance::identity() - K * _H;
+            _P = IKH * _P * IKH.transposed() + K * _R * K.transposed();
+
+            return true;
+        }
+
+    private:
+        State _x;
+        Covariance _P;
+        Observation _H;
+        MeasurementCovariance _R;
+    };
+}
+
+#endif // ARMORIAL_TRACKING_KALMANFILTER_H
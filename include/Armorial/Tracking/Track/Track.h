@@ -0,0 +1,150 @@
+#ifndef ARMORIAL_TRACKING_TRACK_H
+#define ARMORIAL_TRACKING_TRACK_H
+
+#include <Armorial/Common/Types/Object/Object.h>
+#include <Armorial/Geometry/Angle/Angle.h>
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+#include <Armorial/Tracking/KalmanFilter/KalmanFilter.h>
+
+#include <optional>
+
+namespace Tracking {
+    /*!
+     * \brief The motion models available for the tracks.
+     */
+    enum class MotionModel {
+        CONSTANT_VELOCITY,
+        CONSTANT_ACCELERATION
+    };
+
+    /*!
+     * \brief A measurement of an object in a frame, with an optional orientation (e.g. robots have
+     * one, balls do not).
+     */
+    struct Detection {
+        Geometry::Vector2D position;
+        std::optional<Geometry::Angle> orientation;
+    };
+
+    /*!
+     * \brief Parameters of the tracks and their lifecycle. Lengths are in millimeters, as in
+     * Common::Types::Field and Planning::PlannerSettings, angles in radians and times in seconds.
+     */
+    struct TrackingSettings {
+        // Motion model of the position
+        MotionModel model = MotionModel::CONSTANT_VELOCITY;
+        // Spectral density of the white noise that drives the model, per axis: acceleration noise in
+        // mm²/s³ for the constant velocity model, jerk noise in mm²/s⁵ for the constant acceleration one
+        float processNoise = 1e7f;
+        // Standard deviation of the measured positions, in mm
+        float measurementNoise = 10.0f;
+        // Spectral density of the angular acceleration noise, in rad²/s³, and standard deviation of
+        // the measured orientations, in rad
+        float orientationProcessNoise = 10.0f;
+        float orientationMeasurementNoise = 0.05f;
+        // Initial standard deviation of the velocity (and acceleration) of new tracks, in mm/s (and mm/s²)
+        float initialVelocityDeviation = 5000.0f;
+        // Initial standard deviation of the angular speed of new tracks, in rad/s
+        float initialAngularSpeedDeviation = 5.0f;
+        // Detections whose squared Mahalanobis distance to a track exceeds this gate are never
+        // associated to it (9.21 is the 99% quantile of the chi-square with 2 degrees of freedom)
+        float gate = 9.21f;
+        // Consecutive hits needed to confirm a track
+        unsigned confirmationHits = 3;
+        // Consecutive misses after which a track is removed (tentative tracks are removed on the
+        // first miss)
+        unsigned maxMisses = 10;
+    };
+
+    /*!
+     * \brief The Tracking::Track class holds the Kalman filters of a tracked object and its lifecycle.
+     * The position filter state is [x, y, vx, vy, ax, ay] for both motion models: the constant
+     * velocity model keeps the acceleration (and its covariance) at zero. The orientation filter
+     * state is [θ, ω] and is only used if the detections carry an orientation.
+     */
+    class Track {
+    public:
+        using PositionFilter = KalmanFilter<6, 2>;
+        using OrientationFilter = KalmanFilter<2, 1>;
+
+        /*!
+         * \brief The lifecycle states of a track.
+         */
+        enum class Status {
+            TENTATIVE,
+            CONFIRMED
+        };
+
+        /*!
+         * \brief Track constructor, which starts a tentative track at a given detection.
+         * \param id The identifier of this track.
+         * \param detection The first detection of the tracked object.
+         * \param settings The tracking parameters.
+         */
+        Track(unsigned id, const Detection &detection, const TrackingSettings &settings);
+
+        /*!
+         * \brief Propagates the filters a given time step forward.
+         * \param dt The time step, in seconds.
+         */
+        void predict(float dt);
+
+        /*!
+         * \brief Corrects the filters with a detection associated to this track.
+         */
+        void update(const Detection &detection);
+
+        /*!
+         * \brief Marks that no detection was associated to this track in the current frame.
+         */
+        void miss();
+
+        /*!
+         * \return True if this track should be removed, by having missed too many frames.
+         */
+        [[nodiscard]] bool isLost() const;
+
+        /*!
+         * \brief Getters for the track attributes.
+         */
+        [[nodiscard]] unsigned id() const { return _id; }
+        [[nodiscard]] Status status() const { return _status; }
+        [[nodiscard]] bool isConfirmed() const { return _status == Status::CONFIRMED; }
+        [[nodiscard]] unsigned hits() const { return _hits; }
+        [[nodiscard]] unsigned misses() const { return _misses; }
+        [[nodiscard]] bool hasOrientation() const { return _hasOrientation; }
+        [[nodiscard]] const PositionFilter& positionFilter() const { return _position; }
+        [[nodiscard]] const OrientationFilter& orientationFilter() const { return _orientation; }
+
+        /*!
+         * \brief Getters for the estimated state.
+         */
+        [[nodiscard]] Geometry::Vector2D position() const;
+        [[nodiscard]] Geometry::Vector2D velocity() const;
+        [[nodiscard]] Geometry::Vector2D acceleration() const;
+        [[nodiscard]] Geometry::Angle orientation() const;
+        [[nodiscard]] float angularSpeed() const;
+
+        /*!
+         * \return The estimated state of the tracked object as a Common::Types::Object.
+         */
+        [[nodiscard]] Common::Types::Object object() const;
+
+    private:
+        /*!
+         * \brief Starts the orientation filter at a given orientation.
+         */
+        void initializeOrientation(const Geometry::Angle &orientation);
+
+        TrackingSettings _settings;
+        unsigned _id;
+        Status _status;
+        unsigned _hits;
+        unsigned _misses;
+        bool _hasOrientation;
+        PositionFilter _position;
+        OrientationFilter _orientation;
+    };
+}
+
+#endif // ARMORIAL_TRACKING_TRACK_H
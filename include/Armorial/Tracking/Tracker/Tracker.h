@@ -0,0 +1,75 @@
+#ifndef ARMORIAL_TRACKING_TRACKER_H
+#define ARMORIAL_TRACKING_TRACKER_H
+
+#include <Armorial/Tracking/Track/Track.h>
+
+#include <vector>
+
+namespace Tracking {
+    /*!
+     * \brief The Tracking::Tracker class tracks multiple objects of the same kind (e.g. the robots of
+     * a team, or the balls) from their detections in each frame. On each update the tracks are
+     * predicted to the frame time, the detections are associated to them by the Hungarian method
+     * over their Mahalanobis distances (discarding pairs outside the gate), and the tracks are
+     * corrected, created and removed according to their lifecycle.
+     */
+    class Tracker {
+    public:
+        /*!
+         * \brief Tracker constructor.
+         * \param settings The parameters of the tracks.
+         */
+        Tracker(const TrackingSettings &settings = TrackingSettings());
+
+        /*!
+         * \brief Processes the detections of a frame.
+         * \param detections The detections of the frame.
+         * \param dt The time elapsed since the previous frame, in seconds.
+         */
+        void update(const std::vector<Detection> &detections, float dt);
+
+        /*!
+         * \brief Removes all the tracks.
+         */
+        void clear();
+
+        /*!
+         * \return The parameters of the tracks.
+         */
+        [[nodiscard]] const TrackingSettings& settings() const { return _settings; }
+
+        /*!
+         * \return All the current tracks, including the tentative ones.
+         */
+        [[nodiscard]] const std::vector<Track>& tracks() const { return _tracks; }
+
+        /*!
+         * \return The estimated states of the confirmed tracks, in the order of tracks().
+         */
+        [[nodiscard]] std::vector<Common::Types::Object> objects() const;
+
+        /*!
+         * \return A pointer to the track with the given identifier, or nullptr if there is none.
+         */
+        [[nodiscard]] const Track* track(unsigned id) const;
+
+    private:
+        /*!
+         * \brief Associates the detections to the current tracks, storing in _assignment the index of
+         * the detection associated to each track (or -1).
+         */
+        void associate(const std::vector<Detection> &detections);
+
+        TrackingSettings _settings;
+        std::vector<Track> _tracks;
+        unsigned _nextId;
+
+        // Buffers reused between frames
+        std::vector<double> _costs;
+        std::vector<bool> _feasible;
+        std::vector<int> _assignment;
+        std::vector<bool> _detectionUsed;
+    };
+}
+
+#endif // ARMORIAL_TRACKING_TRACKER_H
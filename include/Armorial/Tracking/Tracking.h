@@ -0,0 +1,8 @@
+#ifndef ARMORIAL_TRACKING_H
+#define ARMORIAL_TRACKING_H
+
+#include "KalmanFilter/KalmanFilter.h"
+#include "Track/Track.h"
+#include "Tracker/Tracker.h"
+
+#endif // ARMORIAL_TRACKING_H
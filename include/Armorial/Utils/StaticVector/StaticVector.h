@@ -0,0 +1,142 @@
+#ifndef ARMORIAL_UTILS_STATICVECTOR_H
+#define ARMORIAL_UTILS_STATICVECTOR_H
+
+#include <array>
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+#include <assert.h>
+
+namespace Utils {
+    /*!
+     * \brief The Utils::StaticVector class provides a sequence container with a fixed capacity known
+     * at compile time, whose elements are stored inline (no heap allocation). It is returned by the
+     * Geometry queries whose result size is bounded, such as the intersections of a circle with a
+     * segment.
+     * \tparam T The type of the elements, which should be default constructible.
+     * \tparam N The capacity.
+     * \note It converts to std::vector<T>, so it can still be assigned to one.
+     */
+    template <typename T, size_t N>
+    class StaticVector {
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        /*!
+         * \brief StaticVector constructor that builds an empty container.
+         */
+        constexpr StaticVector() : _data{}, _size(0) {}
+
+        /*!
+         * \brief StaticVector constructor that copies the given elements, which should be at most N.
+         */
+        constexpr StaticVector(std::initializer_list<T> values) : _data{}, _size(0) {
+            for(const T &value : values) {
+                push_back(value);
+            }
+        }
+
+        /*!
+         * \brief Appends an element, which should fit in the capacity.
+         */
+        constexpr void push_back(const T &value) {
+            assert(_size < N);
+            _data[_size++] = value;
+        }
+
+        /*!
+         * \brief Appends an element built from the given arguments, which should fit in the capacity.
+         */
+        template <typename... Args>
+        constexpr T& emplace_back(Args&&... args) {
+            assert(_size < N);
+            _data[_size] = T(std::forward<Args>(args)...);
+            return _data[_size++];
+        }
+
+        /*!
+         * \brief Removes the last element.
+         */
+        constexpr void pop_back() {
+            assert(_size > 0);
+            _size--;
+        }
+
+        /*!
+         * \brief Removes the elements in [first, last), moving the following ones back.
+         * \return An iterator to the element that followed the removed ones.
+         */
+        iterator erase(const_iterator first, const_iterator last) {
+            iterator target = begin() + (first - begin());
+            const iterator following = std::move(begin() + (last - begin()), end(), target);
+            _size = static_cast<size_t>(following - begin());
+            return target;
+        }
+
+        /*!
+         * \brief Removes all the elements.
+         */
+        constexpr void clear() { _size = 0; }
+
+        /*!
+         * \return The number of elements.
+         */
+        constexpr size_t size() const { return _size; }
+
+        /*!
+         * \return The maximum number of elements.
+         */
+        static constexpr size_t capacity() { return N; }
+
+        /*!
+         * \return True if there are no elements.
+         */
+        constexpr bool empty() const { return _size == 0; }
+
+        /*!
+         * \brief Access operators to the element at the given index.
+         */
+        constexpr T& operator[](size_t i) {
+            assert(i < _size);
+            return _data[i];
+        }
+        constexpr const T& operator[](size_t i) const {
+            assert(i < _size);
+            return _data[i];
+        }
+
+        /*!
+         * \brief Access to the first and last elements, when not empty.
+         */
+        constexpr T& front() { return (*this)[0]; }
+        constexpr const T& front() const { return (*this)[0]; }
+        constexpr T& back() { return (*this)[_size - 1]; }
+        constexpr const T& back() const { return (*this)[_size - 1]; }
+
+        /*!
+         * \brief Iterators and pointers to the elements.
+         */
+        constexpr T* data() { return _data.data(); }
+        constexpr const T* data() const { return _data.data(); }
+        constexpr iterator begin() { return data(); }
+        constexpr const_iterator begin() const { return data(); }
+        constexpr iterator end() { return data() + _size; }
+        constexpr const_iterator end() const { return data() + _size; }
+
+        /*!
+         * \return A std::vector with copies of the elements.
+         */
+        operator std::vector<T>() const {
+            return std::vector<T>(begin(), end());
+        }
+
+    private:
+        std::array<T, N> _data;
+        size_t _size;
+    };
+}
+
+#endif // ARMORIAL_UTILS_STATICVECTOR_H
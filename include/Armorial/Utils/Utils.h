@@ -3,6 +3,7 @@
 
 #include <QNetworkDatagram>
 
+#include <algorithm>
 #include <math.h>
 #include <type_traits>
 
@@ -55,6 +56,49 @@ namespace Utils {
             return (degrees * (Geometry::Angle::PI / 180.0f));
         }
 
+        /*!
+         * \return An approximation of sin(radians), faster than std::sin, for high-volume orientation math.
+         * \note The absolute error is below 1e-6 for |radians| <= 2π. Larger values are wrapped to
+         * [-π, π] first, which adds an error of about 3e-8 * |radians|. Values beyond 2.5e7, where
+         * consecutive floats are more than a turn apart, give 0.
+         */
+        [[nodiscard]] inline float fastSin(float radians) {
+            // Remove the nearest whole turn (rounding by adding and subtracting 1.5 * 2^23), then reflect
+            // the value into [-π/2, π/2], where sin is approximated by a minimax polynomial
+            constexpr float pi = Geometry::Angle::PI, halfPi = pi / 2, round = 12582912.0f;
+            const float turns = radians * (1.0f / (2 * pi));
+            float x = (fabsf(turns) < 4e6f) ? radians - ((turns + round) - round) * (2 * pi) : 0.0f;
+            x = (x > halfPi) ? (pi - x) : x;
+            x = (x < -halfPi) ? (-pi - x) : x;
+
+            const float x2 = x * x;
+            return x * (0.99999661f + x2 * (-0.16664829f + x2 * (0.0083063268f + x2 * -0.00018363689f)));
+        }
+
+        /*!
+         * \return An approximation of cos(radians), with the same error bounds as fastSin().
+         */
+        [[nodiscard]] inline float fastCos(float radians) {
+            return fastSin(radians + Geometry::Angle::PI / 2);
+        }
+
+        /*!
+         * \return An approximation of atan2(y, x) in [-π, π], faster than std::atan2, for high-volume
+         * orientation math.
+         * \note The absolute error is below 2e-6 radians. As std::atan2, it returns 0 for (0, 0).
+         */
+        [[nodiscard]] inline float fastAtan2(float y, float x) {
+            // Approximate atan on [0, 1] by a minimax polynomial, then use the octant symmetries
+            const float ax = fabsf(x), ay = fabsf(y);
+            const float high = std::max(ax, ay), low = std::min(ax, ay);
+            const float t = (high > 0.0f) ? low / high : 0.0f;
+            const float t2 = t * t;
+            float angle = t * (0.99997722f + t2 * (-0.33262285f + t2 * (0.19354044f + t2 * (-0.11642652f
+                               + t2 * (0.052647317f + t2 * -0.011719105f)))));
+            angle = (ay > ax) ? (Geometry::Angle::PI / 2 - angle) : angle;
+            angle = (x < 0.0f) ? (Geometry::Angle::PI - angle) : angle;
+            return (y < 0.0f) ? -angle : angle;
+        }
     }
 
     namespace Algebra {
@@ -78,6 +122,30 @@ namespace Utils {
             return ((a > 0.0) ? std::make_pair(t0, t1) : std::make_pair(t1, t0));
         }
     }
+
+    namespace CPU {
+        /*!
+         * \return True if the running CPU supports the SSE2 instruction set.
+         */
+        [[nodiscard]] inline bool hasSSE2() {
+#if defined(__x86_64__) || defined(__i386__)
+            return __builtin_cpu_supports("sse2");
+#else
+            return false;
+#endif
+        }
+
+        /*!
+         * \return True if the running CPU supports the AVX2 and FMA instruction sets.
+         */
+        [[nodiscard]] inline bool hasAVX2() {
+#if defined(__x86_64__) || defined(__i386__)
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+            return false;
+#endif
+        }
+    }
 }
 
 #endif // ARMORIAL_UTILS_H
@@ -0,0 +1,7 @@
+#!/bin/sh
+
+cd benchmark
+rm -rf build
+mkdir build
+cd build && qmake .. && make -j$(nproc) && cd ..
+cd bin && ./Armorial-Benchmark "$@"
@@ -0,0 +1 @@
+#include <Armorial/Common/Enums/Region/Region.h>
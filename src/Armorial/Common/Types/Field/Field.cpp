@@ -225,6 +225,11 @@ bool Field::isInsideTheirField(Geometry::Vector2D position) {
     return theirField().contains(position);
 }
 
+Field Field::canonical() const {
+    return Field(Common::Enums::Side::SIDE_LEFT, _centerRadius, _fieldLength, _fieldWidth,
+                 _goalDepth, _goalWidth, _penaltyDepth, _penaltyWidth, _penaltyMarkDistanceFromGoal);
+}
+
 Field Field::operator*(const float &scalar) {
     return Field(_playSide, _centerRadius * scalar, _fieldLength * scalar, _fieldWidth * scalar,
                  _goalDepth * scalar, _goalWidth * scalar, _penaltyDepth * scalar,
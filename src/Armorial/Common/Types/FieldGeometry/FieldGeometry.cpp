@@ -0,0 +1,139 @@
+#include <Armorial/Common/Types/FieldGeometry/FieldGeometry.h>
+#include <Armorial/Common/Types/Field/Field.h>
+
+using namespace Common::Types;
+
+FieldGeometry::FieldGeometry(const Field &field) {
+    _playingLeftSide = field.playingLeftSide();
+
+    _field = field.field();
+    _ourField = field.ourField();
+    _theirField = field.theirField();
+    _ourPenaltyArea = field.ourPenaltyArea();
+    _theirPenaltyArea = field.theirPenaltyArea();
+    _topRightQuadrant = field.topRightQuadrant();
+    _topLeftQuadrant = field.topLeftQuadrant();
+    _bottomLeftQuadrant = field.bottomLeftQuadrant();
+    _bottomRightQuadrant = field.bottomRightQuadrant();
+    _centerCircle = field.centerCircle();
+
+    _ourGoalCenter = field.ourGoalCenter();
+    _ourGoalLeftPost = field.ourGoalLeftPost();
+    _ourGoalRightPost = field.ourGoalRightPost();
+    _ourPenaltyMark = field.ourPenaltyMark();
+    _theirGoalCenter = field.theirGoalCenter();
+    _theirGoalLeftPost = field.theirGoalLeftPost();
+    _theirGoalRightPost = field.theirGoalRightPost();
+    _theirPenaltyMark = field.theirPenaltyMark();
+    _topRightCorner = field.topRightCorner();
+    _topLeftCorner = field.topLeftCorner();
+    _bottomLeftCorner = field.bottomLeftCorner();
+    _bottomRightCorner = field.bottomRightCorner();
+
+    _fieldBounds = boundsOf(_field);
+    _ourFieldBounds = boundsOf(_ourField);
+    _theirFieldBounds = boundsOf(_theirField);
+    _ourPenaltyAreaBounds = boundsOf(_ourPenaltyArea);
+    _theirPenaltyAreaBounds = boundsOf(_theirPenaltyArea);
+}
+
+FieldGeometry::Bounds FieldGeometry::boundsOf(const Geometry::Rectangle &rectangle) {
+    Bounds bounds;
+    bounds.minX = rectangle.topLeft().x();
+    bounds.maxX = rectangle.topRight().x();
+    bounds.minY = rectangle.bottomLeft().y();
+    bounds.maxY = rectangle.topLeft().y();
+    return bounds;
+}
+
+bool FieldGeometry::playingLeftSide() const {
+    return _playingLeftSide;
+}
+
+const Geometry::Rectangle& FieldGeometry::field() const {
+    return _field;
+}
+
+const Geometry::Rectangle& FieldGeometry::ourField() const {
+    return _ourField;
+}
+
+const Geometry::Rectangle& FieldGeometry::theirField() const {
+    return _theirField;
+}
+
+const Geometry::Rectangle& FieldGeometry::ourPenaltyArea() const {
+    return _ourPenaltyArea;
+}
+
+const Geometry::Rectangle& FieldGeometry::theirPenaltyArea() const {
+    return _theirPenaltyArea;
+}
+
+const Geometry::Rectangle& FieldGeometry::topRightQuadrant() const {
+    return _topRightQuadrant;
+}
+
+const Geometry::Rectangle& FieldGeometry::topLeftQuadrant() const {
+    return _topLeftQuadrant;
+}
+
+const Geometry::Rectangle& FieldGeometry::bottomLeftQuadrant() const {
+    return _bottomLeftQuadrant;
+}
+
+const Geometry::Rectangle& FieldGeometry::bottomRightQuadrant() const {
+    return _bottomRightQuadrant;
+}
+
+const Geometry::Circle& FieldGeometry::centerCircle() const {
+    return _centerCircle;
+}
+
+const Geometry::Vector2D& FieldGeometry::ourGoalCenter() const {
+    return _ourGoalCenter;
+}
+
+const Geometry::Vector2D& FieldGeometry::ourGoalLeftPost() const {
+    return _ourGoalLeftPost;
+}
+
+const Geometry::Vector2D& FieldGeometry::ourGoalRightPost() const {
+    return _ourGoalRightPost;
+}
+
+const Geometry::Vector2D& FieldGeometry::ourPenaltyMark() const {
+    return _ourPenaltyMark;
+}
+
+const Geometry::Vector2D& FieldGeometry::theirGoalCenter() const {
+    return _theirGoalCenter;
+}
+
+const Geometry::Vector2D& FieldGeometry::theirGoalLeftPost() const {
+    return _theirGoalLeftPost;
+}
+
+const Geometry::Vector2D& FieldGeometry::theirGoalRightPost() const {
+    return _theirGoalRightPost;
+}
+
+const Geometry::Vector2D& FieldGeometry::theirPenaltyMark() const {
+    return _theirPenaltyMark;
+}
+
+const Geometry::Vector2D& FieldGeometry::topRightCorner() const {
+    return _topRightCorner;
+}
+
+const Geometry::Vector2D& FieldGeometry::topLeftCorner() const {
+    return _topLeftCorner;
+}
+
+const Geometry::Vector2D& FieldGeometry::bottomLeftCorner() const {
+    return _bottomLeftCorner;
+}
+
+const Geometry::Vector2D& FieldGeometry::bottomRightCorner() const {
+    return _bottomRightCorner;
+}
@@ -0,0 +1,129 @@
+#include <Armorial/Common/Types/FieldRegionGrid/FieldRegionGrid.h>
+#include <Armorial/Common/Types/Field/Field.h>
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+
+using namespace Common::Types;
+
+namespace {
+    enum class Coverage { Inside, Outside, Partial };
+
+    using Box = FieldGeometry::Bounds;
+
+    Coverage coverage(const Box &region, const Box &cell) {
+        if(cell.minX >= region.minX && cell.maxX <= region.maxX && cell.minY >= region.minY && cell.maxY <= region.maxY) {
+            return Coverage::Inside;
+        }
+        if(cell.maxX < region.minX || cell.minX > region.maxX || cell.maxY < region.minY || cell.minY > region.maxY) {
+            return Coverage::Outside;
+        }
+
+        return Coverage::Partial;
+    }
+
+    Coverage coverage(const Geometry::Vector2D &center, float radius, const Box &cell) {
+        const float nearestX = std::clamp(center.x(), cell.minX, cell.maxX);
+        const float nearestY = std::clamp(center.y(), cell.minY, cell.maxY);
+        if(std::hypot(nearestX - center.x(), nearestY - center.y()) > radius) {
+            return Coverage::Outside;
+        }
+
+        const float farthestX = std::max(std::abs(cell.minX - center.x()), std::abs(cell.maxX - center.x()));
+        const float farthestY = std::max(std::abs(cell.minY - center.y()), std::abs(cell.maxY - center.y()));
+        if(std::hypot(farthestX, farthestY) <= radius) {
+            return Coverage::Inside;
+        }
+
+        return Coverage::Partial;
+    }
+}
+
+FieldRegionGrid::FieldRegionGrid(const Field &field, float resolution, float nearGoalRadius)
+    : _geometry(field), _nearGoalRadius(nearGoalRadius), _resolution(resolution), _inverseResolution(1.0f / resolution) {
+    assert(resolution > 0.0f);
+    _minX = field.minX() - nearGoalRadius;
+    _minY = field.minY() - nearGoalRadius;
+    _columns = static_cast<size_t>(std::ceil((field.maxX() + nearGoalRadius - _minX) * _inverseResolution));
+    _rows = static_cast<size_t>(std::ceil((field.maxY() + nearGoalRadius - _minY) * _inverseResolution));
+    _cells.assign(_columns * _rows, 0);
+
+    const std::pair<Box, Enums::Region> boxes[] = {
+        {FieldGeometry::boundsOf(_geometry.field()), Enums::REGION_FIELD},
+        {FieldGeometry::boundsOf(_geometry.ourField()), Enums::REGION_OUR_FIELD},
+        {FieldGeometry::boundsOf(_geometry.theirField()), Enums::REGION_THEIR_FIELD},
+        {FieldGeometry::boundsOf(_geometry.ourPenaltyArea()), Enums::REGION_OUR_PENALTY_AREA},
+        {FieldGeometry::boundsOf(_geometry.theirPenaltyArea()), Enums::REGION_THEIR_PENALTY_AREA},
+        {FieldGeometry::boundsOf(_geometry.topRightQuadrant()), Enums::REGION_TOP_RIGHT_QUADRANT},
+        {FieldGeometry::boundsOf(_geometry.topLeftQuadrant()), Enums::REGION_TOP_LEFT_QUADRANT},
+        {FieldGeometry::boundsOf(_geometry.bottomLeftQuadrant()), Enums::REGION_BOTTOM_LEFT_QUADRANT},
+        {FieldGeometry::boundsOf(_geometry.bottomRightQuadrant()), Enums::REGION_BOTTOM_RIGHT_QUADRANT}
+    };
+    const std::pair<Geometry::Vector2D, Enums::Region> goals[] = {
+        {_geometry.ourGoalCenter(), Enums::REGION_NEAR_OUR_GOAL},
+        {_geometry.theirGoalCenter(), Enums::REGION_NEAR_THEIR_GOAL}
+    };
+
+    // Cells are tested slightly enlarged, so a point that rounding puts in a neighbour cell is
+    // still covered by the cell decision
+    const float slack = 1e-3f * resolution;
+    for(size_t row = 0; row < _rows; row++) {
+        for(size_t column = 0; column < _columns; column++) {
+            const Box cell{_minX + column * resolution - slack, _minX + (column + 1) * resolution + slack,
+                           _minY + row * resolution - slack, _minY + (row + 1) * resolution + slack};
+
+            Enums::RegionMask mask = 0;
+            for(const auto &[box, region] : boxes) {
+                const Coverage cellCoverage = coverage(box, cell);
+                mask |= (cellCoverage == Coverage::Inside ? region : 0);
+                mask |= (cellCoverage == Coverage::Partial ? BOUNDARY : 0);
+            }
+            for(const auto &[center, region] : goals) {
+                const Coverage cellCoverage = coverage(center, _nearGoalRadius, cell);
+                mask |= (cellCoverage == Coverage::Inside ? region : 0);
+                mask |= (cellCoverage == Coverage::Partial ? BOUNDARY : 0);
+            }
+
+            _cells[row * _columns + column] = mask;
+        }
+    }
+}
+
+void FieldRegionGrid::classify(const Geometry::Vector2D *positions, Enums::RegionMask *out, size_t count) const {
+    for(size_t i = 0; i < count; i++) {
+        out[i] = classify(positions[i]);
+    }
+}
+
+Common::Enums::RegionMask FieldRegionGrid::classifyExact(const Geometry::Vector2D &position) const {
+    Enums::RegionMask mask = 0;
+    mask |= (_geometry.isInsideField(position) ? Enums::REGION_FIELD : 0);
+    mask |= (_geometry.isInsideOurField(position) ? Enums::REGION_OUR_FIELD : 0);
+    mask |= (_geometry.isInsideTheirField(position) ? Enums::REGION_THEIR_FIELD : 0);
+    mask |= (_geometry.isInsideOurPenaltyArea(position) ? Enums::REGION_OUR_PENALTY_AREA : 0);
+    mask |= (_geometry.isInsideTheirPenaltyArea(position) ? Enums::REGION_THEIR_PENALTY_AREA : 0);
+    mask |= (_geometry.topRightQuadrant().contains(position) ? Enums::REGION_TOP_RIGHT_QUADRANT : 0);
+    mask |= (_geometry.topLeftQuadrant().contains(position) ? Enums::REGION_TOP_LEFT_QUADRANT : 0);
+    mask |= (_geometry.bottomLeftQuadrant().contains(position) ? Enums::REGION_BOTTOM_LEFT_QUADRANT : 0);
+    mask |= (_geometry.bottomRightQuadrant().contains(position) ? Enums::REGION_BOTTOM_RIGHT_QUADRANT : 0);
+    mask |= (position.dist(_geometry.ourGoalCenter()) <= _nearGoalRadius ? Enums::REGION_NEAR_OUR_GOAL : 0);
+    mask |= (position.dist(_geometry.theirGoalCenter()) <= _nearGoalRadius ? Enums::REGION_NEAR_THEIR_GOAL : 0);
+    return mask;
+}
+
+const FieldGeometry& FieldRegionGrid::geometry() const {
+    return _geometry;
+}
+
+float FieldRegionGrid::resolution() const {
+    return _resolution;
+}
+
+size_t FieldRegionGrid::columns() const {
+    return _columns;
+}
+
+size_t FieldRegionGrid::rows() const {
+    return _rows;
+}
@@ -0,0 +1,145 @@
+#include <Armorial/Common/Types/WorldSnapshot/WorldSnapshot.h>
+#include <Armorial/Common/Types/Object/Object.h>
+
+#include <Armorial/Geometry/Batch/Batch.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Common::Types;
+
+WorldSnapshot::WorldSnapshot(size_t capacity) {
+    _positions.reserve(capacity);
+    _velocities.reserve(capacity);
+    _accelerations.reserve(capacity);
+    _orientations.reserve(capacity);
+    _fieldOrientations.reserve(capacity);
+    _angularSpeeds.reserve(capacity);
+}
+
+size_t WorldSnapshot::add(const Geometry::Vector2D &position, const Geometry::Vector2D &velocity,
+                          const Geometry::Vector2D &acceleration, const Geometry::Angle &orientation,
+                          float angularSpeed) {
+    _positions.push_back(position);
+    _velocities.push_back(velocity);
+    _accelerations.push_back(acceleration);
+    _orientations.push_back(orientation.value());
+    _fieldOrientations.push_back(orientation.value());
+    _angularSpeeds.push_back(angularSpeed);
+
+    // Objects are given in the field frame, so bring them to the current one
+    if(_mirrored) {
+        _positions.back() = position.scale(-1.0f);
+        _velocities.back() = velocity.scale(-1.0f);
+        _accelerations.back() = acceleration.scale(-1.0f);
+        _orientations.back() -= std::copysign(Geometry::Angle::PI, _orientations.back());
+    }
+
+    return _positions.size() - 1;
+}
+
+size_t WorldSnapshot::add(const Object &object) {
+    return add(object.getPosition(), object.getVelocity(), object.getAcceleration(),
+               object.getOrientation(), object.getAngularSpeed());
+}
+
+void WorldSnapshot::clear() {
+    _positions.clear();
+    _velocities.clear();
+    _accelerations.clear();
+    _orientations.clear();
+    _fieldOrientations.clear();
+    _angularSpeeds.clear();
+    _mirrored = false;
+}
+
+size_t WorldSnapshot::size() const {
+    return _positions.size();
+}
+
+Geometry::Vector2D WorldSnapshot::position(size_t index) const {
+    return _positions[index];
+}
+
+Geometry::Vector2D WorldSnapshot::velocity(size_t index) const {
+    return _velocities[index];
+}
+
+Geometry::Vector2D WorldSnapshot::acceleration(size_t index) const {
+    return _accelerations[index];
+}
+
+Geometry::Angle WorldSnapshot::orientation(size_t index) const {
+    return Geometry::Angle(_orientations[index]);
+}
+
+float WorldSnapshot::angularSpeed(size_t index) const {
+    return _angularSpeeds[index];
+}
+
+const std::vector<Geometry::Vector2D>& WorldSnapshot::positions() const {
+    return _positions;
+}
+
+const std::vector<Geometry::Vector2D>& WorldSnapshot::velocities() const {
+    return _velocities;
+}
+
+const std::vector<Geometry::Vector2D>& WorldSnapshot::accelerations() const {
+    return _accelerations;
+}
+
+const std::vector<float>& WorldSnapshot::orientations() const {
+    return _orientations;
+}
+
+const std::vector<float>& WorldSnapshot::angularSpeeds() const {
+    return _angularSpeeds;
+}
+
+void WorldSnapshot::toCanonical(const Enums::Side playSide) {
+    if(!_mirrored && playSide == Enums::Side::SIDE_RIGHT) {
+        mirror();
+    }
+}
+
+void WorldSnapshot::toField() {
+    if(_mirrored) {
+        mirror();
+    }
+}
+
+bool WorldSnapshot::isMirrored() const {
+    return _mirrored;
+}
+
+Geometry::Transform2D WorldSnapshot::toFieldTransform() const {
+    // fromDirection gives exactly (-1, 0), which cos/sin of PI would not
+    const Geometry::Rotation2D rotation = Geometry::Rotation2D::fromDirection(Geometry::Vector2D(_mirrored ? -1.0f : 1.0f, 0.0f));
+    return Geometry::Transform2D(rotation, Geometry::Vector2D(0.0f, 0.0f));
+}
+
+void WorldSnapshot::mirror() {
+    const size_t count = size();
+
+    // Negating is exact, so mirroring twice restores the original vectors
+    Geometry::Batch::scale(_positions.data(), -1.0f, _positions.data(), count);
+    Geometry::Batch::scale(_velocities.data(), -1.0f, _velocities.data(), count);
+    Geometry::Batch::scale(_accelerations.data(), -1.0f, _accelerations.data(), count);
+
+    // Turning by PI rounds, so the way back copies the field frame orientations instead
+    if(_mirrored) {
+        std::copy(_fieldOrientations.begin(), _fieldOrientations.end(), _orientations.begin());
+    } else {
+        // Angles are kept in [-PI, PI], so turning by PI is subtracting PI from the positive ones and
+        // adding it to the others; written as a select so the loop has no branches
+        const float *fieldOrientations = _fieldOrientations.data();
+        float *orientations = _orientations.data();
+        for(size_t i = 0; i < count; i++) {
+            orientations[i] = fieldOrientations[i] - std::copysign(Geometry::Angle::PI, fieldOrientations[i]);
+        }
+    }
+
+    // A rotation keeps the handedness, so angular speeds stay the same
+    _mirrored = !_mirrored;
+}
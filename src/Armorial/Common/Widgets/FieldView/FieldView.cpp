@@ -42,35 +42,35 @@ void FieldView::setupFieldGeometry(const Common::Types::Field &field) {
 
     // Create field rectangle
     Geometry::Rectangle fieldRect = field.field();
-    std::vector<Geometry::LineSegment> fieldLines = fieldRect.boundary();
+    const auto fieldLines = fieldRect.boundary();
     for(auto &ls : fieldLines) {
         _fieldLineSegments.push_back(ls);
     }
 
     // Create left goal defense area rectangle
     Geometry::Rectangle leftPenaltyArea = field.leftPenaltyArea();
-    std::vector<Geometry::LineSegment> leftPenaltyAreaLines = leftPenaltyArea.boundary();
+    const auto leftPenaltyAreaLines = leftPenaltyArea.boundary();
     for(auto &ls : leftPenaltyAreaLines) {
         _fieldLineSegments.push_back(ls);
     }
 
     // Create right goal defense area rectangle
     Geometry::Rectangle rightPenaltyArea = field.rightPenaltyArea();
-    std::vector<Geometry::LineSegment> rightPenaltyAreaLines = rightPenaltyArea.boundary();
+    const auto rightPenaltyAreaLines = rightPenaltyArea.boundary();
     for(auto &ls : rightPenaltyAreaLines) {
         _fieldLineSegments.push_back(ls);
     }
 
     // Create left goal area
     Geometry::Rectangle leftGoal({-fieldLength/2.0f - goalDepth, goalWidth/2.0f}, {-fieldLength/2.0f, -goalWidth/2.0f});
-    std::vector<Geometry::LineSegment> leftGoalLines = leftGoal.boundary();
+    const auto leftGoalLines = leftGoal.boundary();
     for(auto &ls : leftGoalLines) {
         _fieldLineSegments.push_back(ls);
     }
 
     // Create right goal area
     Geometry::Rectangle rightGoal({fieldLength/2.0f, goalWidth/2.0f}, {fieldLength/2.0f + goalDepth, -goalWidth/2.0f});
-    std::vector<Geometry::LineSegment> rightGoalLines = rightGoal.boundary();
+    const auto rightGoalLines = rightGoal.boundary();
     for(auto &ls : rightGoalLines) {
         _fieldLineSegments.push_back(ls);
     }
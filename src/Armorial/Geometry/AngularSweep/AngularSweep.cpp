@@ -0,0 +1,140 @@
+#include <Armorial/Geometry/AngularSweep/AngularSweep.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Geometry;
+
+namespace {
+    inline float cross(const Vector2D &a, const Vector2D &b) {
+        return a.x() * b.y() - a.y() * b.x();
+    }
+}
+
+const std::vector<AngularSweep::Interval>& AngularSweep::compute(const Vector2D &origin, const LineSegment &target,
+                                                                 const std::vector<Circle> &obstacles) {
+    return compute(origin, target, obstacles.data(), obstacles.size());
+}
+
+const std::vector<AngularSweep::Interval>& AngularSweep::compute(const Vector2D &origin, const LineSegment &target,
+                                                                 const Circle *obstacles, size_t count) {
+    _intervals.clear();
+    _shadows.clear();
+    _origin = origin;
+
+    // Orient the target so its start is at the right of the origin (negative angles)
+    const Vector2D a = target.start() - origin, b = target.end() - origin;
+    const float side = cross(a, b);
+    if(!(std::abs(side) > 0.0f)) {
+        // The origin is on the target line, so the target has no angular width
+        return _intervals;
+    }
+    _targetStart = (side > 0.0f ? target.start() : target.end());
+    _targetEnd = (side > 0.0f ? target.end() : target.start());
+
+    const Vector2D right = _targetStart - origin, left = _targetEnd - origin;
+    _frame = Rotation2D::fromDirection(right.normalize() + left.normalize());
+    const Rotation2D toLocal = _frame.inverse();
+    const Vector2D localRight = toLocal.rotate(right), localLeft = toLocal.rotate(left);
+    const float lowest = std::atan2(localRight.y(), localRight.x());
+    const float highest = std::atan2(localLeft.y(), localLeft.x());
+
+    // Signed distance to the target line, positive at the side of the origin
+    const Vector2D targetDirection = (_targetEnd - _targetStart).normalize();
+    auto distanceToTargetLine = [&](const Vector2D &point) {
+        return cross(targetDirection, point - _targetStart);
+    };
+    const float originSide = distanceToTargetLine(origin);
+
+    for(size_t i = 0; i < count; i++) {
+        const Vector2D center = obstacles[i].center() - origin;
+        const float radius = obstacles[i].radius();
+        const float distance = center.length();
+        if(distance <= radius) {
+            // The origin is inside the obstacle
+            return _intervals;
+        }
+        if(std::copysign(1.0f, originSide) * distanceToTargetLine(obstacles[i].center()) < -radius) {
+            continue;
+        }
+
+        const Vector2D localCenter = toLocal.rotate(center);
+        const float angle = std::atan2(localCenter.y(), localCenter.x());
+        const float halfWidth = std::asin(radius / distance);
+        const float from = std::max(angle - halfWidth, lowest), to = std::min(angle + halfWidth, highest);
+        if(from < to) {
+            _shadows.emplace_back(from, to);
+        }
+    }
+
+    std::sort(_shadows.begin(), _shadows.end());
+
+    // Sweep the shadows in order, opening a free interval at each gap between them
+    float reached = lowest;
+    for(const auto &[from, to] : _shadows) {
+        if(from > reached) {
+            _intervals.push_back(makeInterval(reached, from));
+        }
+        reached = std::max(reached, to);
+    }
+    if(highest > reached) {
+        _intervals.push_back(makeInterval(reached, highest));
+    }
+
+    return _intervals;
+}
+
+AngularSweep::Interval AngularSweep::makeInterval(float from, float to) const {
+    const float bisector = (from + to) / 2.0f;
+
+    Interval interval;
+    interval.from = targetPoint(localDirection(from));
+    interval.to = targetPoint(localDirection(to));
+    interval.direction = localDirection(bisector).toAngle();
+    interval.width = to - from;
+    return interval;
+}
+
+Vector2D AngularSweep::localDirection(float angle) const {
+    return _frame.rotate(Vector2D(std::cos(angle), std::sin(angle)));
+}
+
+Vector2D AngularSweep::targetPoint(const Vector2D &direction) const {
+    // Solve origin + k * direction = start + u * (end - start) for u
+    const Vector2D segment = _targetEnd - _targetStart;
+    const float u = cross(direction, _origin - _targetStart) / cross(direction, segment);
+    return _targetStart + segment * std::clamp(u, 0.0f, 1.0f);
+}
+
+const std::vector<AngularSweep::Interval>& AngularSweep::intervals() const {
+    return _intervals;
+}
+
+std::optional<AngularSweep::Interval> AngularSweep::largest() const {
+    if(_intervals.empty()) {
+        return std::nullopt;
+    }
+
+    return *std::max_element(_intervals.begin(), _intervals.end(), [](const Interval &a, const Interval &b) {
+        return a.width < b.width;
+    });
+}
+
+std::optional<Vector2D> AngularSweep::bestAimPoint() const {
+    const std::optional<Interval> interval = largest();
+    if(!interval.has_value()) {
+        return std::nullopt;
+    }
+
+    const float direction = interval->direction.value();
+    return targetPoint(Vector2D(std::cos(direction), std::sin(direction)));
+}
+
+float AngularSweep::freeWidth() const {
+    float width = 0.0f;
+    for(const Interval &interval : _intervals) {
+        width += interval.width;
+    }
+
+    return width;
+}
@@ -80,12 +80,12 @@ float Arc::arcAngle() const{
     float endAngle = (_endAngle.value() < 0) ? _endAngle.value() + M_PI*2 : _endAngle.value();
     return std::abs(startAngle - endAngle);
 }
-std::vector<Vector2D> Arc::intersectionWithLine(const LineSegment &lineSegment) const {
-    std::vector<Vector2D> intersections;
+Utils::StaticVector<Vector2D, 2> Arc::intersectionWithLine(const LineSegment &lineSegment) const {
+    Utils::StaticVector<Vector2D, 2> intersections;
 
     // Creates a full-circle based on the parameters
     const Circle arcAsCircle = Circle(_center, _radius);
-    const std::vector<Vector2D> intersectionsWithCircle = arcAsCircle.intersects(lineSegment);
+    const Utils::StaticVector<Vector2D, 2> intersectionsWithCircle = arcAsCircle.intersects(lineSegment);
 
     // For each point in the intersection result, check if it is contained in the arc
     // and put it into the vector if True
@@ -0,0 +1,354 @@
+#include <Armorial/Geometry/Batch/Batch.h>
+
+#include <Armorial/Utils/Utils.h>
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ARMORIAL_BATCH_X86
+#endif
+
+using namespace Geometry;
+using namespace Geometry::Batch;
+
+// The kernels read and write the arrays of vectors as arrays of interleaved (x, y) floats
+static_assert(sizeof(Vector2D) == 2 * sizeof(float) && std::is_standard_layout_v<Vector2D>,
+              "Geometry::Vector2D should be laid out as two floats");
+
+namespace {
+    // Vector2D::normalize() keeps vectors at most this long at zero
+    const float ZeroLength = float(std::numeric_limits<double>::epsilon());
+
+    const float* floats(const Vector2D *v) { return reinterpret_cast<const float*>(v); }
+    float* floats(Vector2D *v) { return reinterpret_cast<float*>(v); }
+
+    /*!
+     * \brief The scalar kernels process the vectors from the given index on, so the SIMD kernels
+     * use them for the remaining vectors. All the kernels evaluate the same operations in the same
+     * order (without fused multiply-adds, which -ffp-contract=off keeps the compiler from
+     * introducing), so their results are identical.
+     */
+    void scalarAdd(const float *a, const float *b, float *out, size_t from, size_t count) {
+        for(size_t i = 2 * from; i < 2 * count; i++) {
+            out[i] = a[i] + b[i];
+        }
+    }
+
+    void scalarScale(const float *v, float scalar, float *out, size_t from, size_t count) {
+        for(size_t i = 2 * from; i < 2 * count; i++) {
+            out[i] = v[i] * scalar;
+        }
+    }
+
+    void scalarDot(const float *a, const float *b, float *out, size_t from, size_t count) {
+        for(size_t i = from; i < count; i++) {
+            out[i] = a[2 * i] * b[2 * i] + a[2 * i + 1] * b[2 * i + 1];
+        }
+    }
+
+    void scalarDist(const float *v, float px, float py, float *out, size_t from, size_t count) {
+        for(size_t i = from; i < count; i++) {
+            const float dx = v[2 * i] - px, dy = v[2 * i + 1] - py;
+            out[i] = std::sqrt(dx * dx + dy * dy);
+        }
+    }
+
+    void scalarNormalize(const float *v, float *out, size_t from, size_t count) {
+        for(size_t i = from; i < count; i++) {
+            const float x = v[2 * i], y = v[2 * i + 1];
+            const float length = std::sqrt(x * x + y * y);
+            const float inverse = (length > ZeroLength) ? 1.0f / length : 0.0f;
+            out[2 * i] = x * inverse;
+            out[2 * i + 1] = y * inverse;
+        }
+    }
+
+    void scalarRotate(const float *v, float c, float s, float *out, size_t from, size_t count) {
+        for(size_t i = from; i < count; i++) {
+            const float x = v[2 * i], y = v[2 * i + 1];
+            out[2 * i] = x * c - y * s;
+            out[2 * i + 1] = x * s + y * c;
+        }
+    }
+
+    void scalarTransform(const float *v, float c, float s, float tx, float ty, float *out, size_t from, size_t count) {
+        for(size_t i = from; i < count; i++) {
+            const float x = v[2 * i], y = v[2 * i + 1];
+            out[2 * i] = (x * c - y * s) + tx;
+            out[2 * i + 1] = (x * s + y * c) + ty;
+        }
+    }
+
+#ifdef ARMORIAL_BATCH_X86
+    // Element-wise operations work on the interleaved floats directly, 2 (SSE) or 4 (AVX2) vectors
+    // at a time. Per-vector reductions separate the x and y coordinates of 4 (SSE) or 8 (AVX2)
+    // vectors with shuffles, and operations that need the length of each vector in both of its
+    // coordinates add each float to its swapped neighbour.
+
+    __attribute__((target("sse2")))
+    size_t sseAdd(const float *a, const float *b, float *out, size_t count) {
+        size_t i = 0;
+        for(; i + 2 <= count; i += 2) {
+            _mm_storeu_ps(out + 2 * i, _mm_add_ps(_mm_loadu_ps(a + 2 * i), _mm_loadu_ps(b + 2 * i)));
+        }
+        return i;
+    }
+
+    __attribute__((target("sse2")))
+    size_t sseScale(const float *v, float scalar, float *out, size_t count) {
+        const __m128 k = _mm_set1_ps(scalar);
+        size_t i = 0;
+        for(; i + 2 <= count; i += 2) {
+            _mm_storeu_ps(out + 2 * i, _mm_mul_ps(_mm_loadu_ps(v + 2 * i), k));
+        }
+        return i;
+    }
+
+    __attribute__((target("sse2")))
+    size_t sseDot(const float *a, const float *b, float *out, size_t count) {
+        size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m128 p0 = _mm_mul_ps(_mm_loadu_ps(a + 2 * i), _mm_loadu_ps(b + 2 * i));
+            const __m128 p1 = _mm_mul_ps(_mm_loadu_ps(a + 2 * i + 4), _mm_loadu_ps(b + 2 * i + 4));
+            const __m128 xs = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 ys = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1));
+            _mm_storeu_ps(out + i, _mm_add_ps(xs, ys));
+        }
+        return i;
+    }
+
+    __attribute__((target("sse2")))
+    size_t sseDist(const float *v, float px, float py, float *out, size_t count) {
+        const __m128 point = _mm_setr_ps(px, py, px, py);
+        size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m128 d0 = _mm_sub_ps(_mm_loadu_ps(v + 2 * i), point);
+            const __m128 d1 = _mm_sub_ps(_mm_loadu_ps(v + 2 * i + 4), point);
+            const __m128 p0 = _mm_mul_ps(d0, d0), p1 = _mm_mul_ps(d1, d1);
+            const __m128 xs = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 ys = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1));
+            _mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(xs, ys)));
+        }
+        return i;
+    }
+
+    __attribute__((target("sse2")))
+    size_t sseNormalize(const float *v, float *out, size_t count) {
+        const __m128 one = _mm_set1_ps(1.0f), zero = _mm_set1_ps(ZeroLength);
+        size_t i = 0;
+        for(; i + 2 <= count; i += 2) {
+            const __m128 x = _mm_loadu_ps(v + 2 * i);
+            const __m128 squares = _mm_mul_ps(x, x);
+            const __m128 swapped = _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(2, 3, 0, 1));
+            const __m128 length = _mm_sqrt_ps(_mm_add_ps(squares, swapped));
+            const __m128 inverse = _mm_and_ps(_mm_div_ps(one, length), _mm_cmpgt_ps(length, zero));
+            _mm_storeu_ps(out + 2 * i, _mm_mul_ps(x, inverse));
+        }
+        return i;
+    }
+
+    __attribute__((target("sse2")))
+    size_t sseRotate(const float *v, float c, float s, float *out, size_t count) {
+        const __m128 cosines = _mm_set1_ps(c), sines = _mm_setr_ps(-s, s, -s, s);
+        size_t i = 0;
+        for(; i + 2 <= count; i += 2) {
+            const __m128 x = _mm_loadu_ps(v + 2 * i);
+            const __m128 swapped = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+            _mm_storeu_ps(out + 2 * i, _mm_add_ps(_mm_mul_ps(x, cosines), _mm_mul_ps(swapped, sines)));
+        }
+        return i;
+    }
+
+    __attribute__((target("sse2")))
+    size_t sseTransform(const float *v, float c, float s, float tx, float ty, float *out, size_t count) {
+        const __m128 cosines = _mm_set1_ps(c), sines = _mm_setr_ps(-s, s, -s, s), translation = _mm_setr_ps(tx, ty, tx, ty);
+        size_t i = 0;
+        for(; i + 2 <= count; i += 2) {
+            const __m128 x = _mm_loadu_ps(v + 2 * i);
+            const __m128 swapped = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+            const __m128 rotated = _mm_add_ps(_mm_mul_ps(x, cosines), _mm_mul_ps(swapped, sines));
+            _mm_storeu_ps(out + 2 * i, _mm_add_ps(rotated, translation));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2")))
+    size_t avx2Add(const float *a, const float *b, float *out, size_t count) {
+        size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            _mm256_storeu_ps(out + 2 * i, _mm256_add_ps(_mm256_loadu_ps(a + 2 * i), _mm256_loadu_ps(b + 2 * i)));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2")))
+    size_t avx2Scale(const float *v, float scalar, float *out, size_t count) {
+        const __m256 k = _mm256_set1_ps(scalar);
+        size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            _mm256_storeu_ps(out + 2 * i, _mm256_mul_ps(_mm256_loadu_ps(v + 2 * i), k));
+        }
+        return i;
+    }
+
+    /*!
+     * \brief Adds the x and y terms of the 8 vectors held in p0 and p1, in order.
+     */
+    __attribute__((target("avx2")))
+    __m256 avx2PairSums(__m256 p0, __m256 p1) {
+        // The shuffles work within each 128-bit half, leaving the sums of vectors 0, 1, 4, 5 in
+        // the lower half and 2, 3, 6, 7 in the upper one
+        const __m256 xs = _mm256_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 ys = _mm256_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m256d sums = _mm256_castps_pd(_mm256_add_ps(xs, ys));
+        return _mm256_castpd_ps(_mm256_permute4x64_pd(sums, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+
+    __attribute__((target("avx2")))
+    size_t avx2Dot(const float *a, const float *b, float *out, size_t count) {
+        size_t i = 0;
+        for(; i + 8 <= count; i += 8) {
+            const __m256 p0 = _mm256_mul_ps(_mm256_loadu_ps(a + 2 * i), _mm256_loadu_ps(b + 2 * i));
+            const __m256 p1 = _mm256_mul_ps(_mm256_loadu_ps(a + 2 * i + 8), _mm256_loadu_ps(b + 2 * i + 8));
+            _mm256_storeu_ps(out + i, avx2PairSums(p0, p1));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2")))
+    size_t avx2Dist(const float *v, float px, float py, float *out, size_t count) {
+        const __m256 point = _mm256_setr_ps(px, py, px, py, px, py, px, py);
+        size_t i = 0;
+        for(; i + 8 <= count; i += 8) {
+            const __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(v + 2 * i), point);
+            const __m256 d1 = _mm256_sub_ps(_mm256_loadu_ps(v + 2 * i + 8), point);
+            const __m256 sums = avx2PairSums(_mm256_mul_ps(d0, d0), _mm256_mul_ps(d1, d1));
+            _mm256_storeu_ps(out + i, _mm256_sqrt_ps(sums));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2")))
+    size_t avx2Normalize(const float *v, float *out, size_t count) {
+        const __m256 one = _mm256_set1_ps(1.0f), zero = _mm256_set1_ps(ZeroLength);
+        size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m256 x = _mm256_loadu_ps(v + 2 * i);
+            const __m256 squares = _mm256_mul_ps(x, x);
+            const __m256 swapped = _mm256_permute_ps(squares, _MM_SHUFFLE(2, 3, 0, 1));
+            const __m256 length = _mm256_sqrt_ps(_mm256_add_ps(squares, swapped));
+            const __m256 inverse = _mm256_and_ps(_mm256_div_ps(one, length), _mm256_cmp_ps(length, zero, _CMP_GT_OQ));
+            _mm256_storeu_ps(out + 2 * i, _mm256_mul_ps(x, inverse));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2")))
+    size_t avx2Rotate(const float *v, float c, float s, float *out, size_t count) {
+        const __m256 cosines = _mm256_set1_ps(c), sines = _mm256_setr_ps(-s, s, -s, s, -s, s, -s, s);
+        size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m256 x = _mm256_loadu_ps(v + 2 * i);
+            const __m256 swapped = _mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+            _mm256_storeu_ps(out + 2 * i, _mm256_add_ps(_mm256_mul_ps(x, cosines), _mm256_mul_ps(swapped, sines)));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2")))
+    size_t avx2Transform(const float *v, float c, float s, float tx, float ty, float *out, size_t count) {
+        const __m256 cosines = _mm256_set1_ps(c), sines = _mm256_setr_ps(-s, s, -s, s, -s, s, -s, s);
+        const __m256 translation = _mm256_setr_ps(tx, ty, tx, ty, tx, ty, tx, ty);
+        size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m256 x = _mm256_loadu_ps(v + 2 * i);
+            const __m256 swapped = _mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1));
+            const __m256 rotated = _mm256_add_ps(_mm256_mul_ps(x, cosines), _mm256_mul_ps(swapped, sines));
+            _mm256_storeu_ps(out + 2 * i, _mm256_add_ps(rotated, translation));
+        }
+        return i;
+    }
+#endif
+}
+
+Kernel Geometry::Batch::bestKernel() {
+    static const Kernel best = Utils::CPU::hasAVX2() ? Kernel::AVX2
+                             : Utils::CPU::hasSSE2() ? Kernel::SSE
+                             : Kernel::Scalar;
+    return best;
+}
+
+bool Geometry::Batch::isKernelSupported(Kernel kernel) {
+    switch(kernel) {
+        case Kernel::AVX2:
+            return Utils::CPU::hasAVX2();
+        case Kernel::SSE:
+            return Utils::CPU::hasSSE2();
+        default:
+            return true;
+    }
+}
+
+// Runs the SIMD kernel selected by 'kernel' (which returns how many vectors it processed), then
+// the scalar one on the remaining vectors
+#ifdef ARMORIAL_BATCH_X86
+#define ARMORIAL_BATCH_DISPATCH(name, ...) \
+    size_t done = 0; \
+    switch(kernel) { \
+        case Kernel::AVX2: done = avx2##name(__VA_ARGS__, count); break; \
+        case Kernel::SSE: done = sse##name(__VA_ARGS__, count); break; \
+        default: break; \
+    } \
+    scalar##name(__VA_ARGS__, done, count)
+#else
+#define ARMORIAL_BATCH_DISPATCH(name, ...) \
+    (void) kernel; \
+    scalar##name(__VA_ARGS__, 0, count)
+#endif
+
+void Geometry::Batch::add(const Vector2D *a, const Vector2D *b, Vector2D *out, size_t count, Kernel kernel) {
+    ARMORIAL_BATCH_DISPATCH(Add, floats(a), floats(b), floats(out));
+}
+
+void Geometry::Batch::scale(const Vector2D *v, float scalar, Vector2D *out, size_t count, Kernel kernel) {
+    ARMORIAL_BATCH_DISPATCH(Scale, floats(v), scalar, floats(out));
+}
+
+void Geometry::Batch::dot(const Vector2D *a, const Vector2D *b, float *out, size_t count, Kernel kernel) {
+    ARMORIAL_BATCH_DISPATCH(Dot, floats(a), floats(b), out);
+}
+
+void Geometry::Batch::length(const Vector2D *v, float *out, size_t count, Kernel kernel) {
+    // The length is the distance to the origin
+    ARMORIAL_BATCH_DISPATCH(Dist, floats(v), 0.0f, 0.0f, out);
+}
+
+void Geometry::Batch::dist(const Vector2D *v, const Vector2D &point, float *out, size_t count, Kernel kernel) {
+    ARMORIAL_BATCH_DISPATCH(Dist, floats(v), point.x(), point.y(), out);
+}
+
+void Geometry::Batch::normalize(const Vector2D *v, Vector2D *out, size_t count, Kernel kernel) {
+    ARMORIAL_BATCH_DISPATCH(Normalize, floats(v), floats(out));
+}
+
+void Geometry::Batch::rotate(const Vector2D *v, float radians, Vector2D *out, size_t count, Kernel kernel) {
+    const float c = std::cos(radians), s = std::sin(radians);
+    ARMORIAL_BATCH_DISPATCH(Rotate, floats(v), c, s, floats(out));
+}
+
+void Geometry::Batch::rotate(const Vector2D *v, const Rotation2D &rotation, Vector2D *out, size_t count, Kernel kernel) {
+    ARMORIAL_BATCH_DISPATCH(Rotate, floats(v), rotation.cos(), rotation.sin(), floats(out));
+}
+
+void Geometry::Batch::transform(const Vector2D *v, const Transform2D &transform, Vector2D *out, size_t count,
+                                Kernel kernel) {
+    const Rotation2D &rotation = transform.rotation();
+    const Vector2D &translation = transform.translation();
+    ARMORIAL_BATCH_DISPATCH(Transform, floats(v), rotation.cos(), rotation.sin(), translation.x(), translation.y(),
+                            floats(out));
+}
+
+#undef ARMORIAL_BATCH_DISPATCH
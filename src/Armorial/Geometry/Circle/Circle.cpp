@@ -4,20 +4,7 @@
 
 using namespace Geometry;
 
-Circle::Circle(const Vector2D &center, const float &radius) {
-    _center = center;
-    _radius = radius;
-}
-
-Vector2D Circle::center() const {
-    return _center;
-}
-
-float Circle::radius() const {
-    return _radius;
-}
-
-std::vector<Vector2D> Circle::intersects(const LineSegment &line_segment) const {
+Utils::StaticVector<Vector2D, 2> Circle::intersects(const LineSegment &line_segment) const {
     Vector2D direction_vector = line_segment.direction();
     Vector2D f = line_segment.start() - center();
 
@@ -28,7 +15,7 @@ std::vector<Vector2D> Circle::intersects(const LineSegment &line_segment) const
     std::optional<std::pair<float,float>> values = Utils::Algebra::solveQuadratic(a,b,c);
 
     // Compute intersections
-    std::vector<Vector2D> intersections;
+    Utils::StaticVector<Vector2D, 2> intersections;
 
     if(values.has_value()){
         if(Utils::Compare::isEqual(values->first, std::clamp(values->first, 0.0f, 1.0f))) {
@@ -43,10 +30,6 @@ std::vector<Vector2D> Circle::intersects(const LineSegment &line_segment) const
     return intersections;
 }
 
-bool Circle::contains(const Vector2D &other) const {
-    return (fabs((center() - other).length()) <= radius());
-}
-
 bool Circle::doesIntersect(const LineSegment &other) const {
     return (other.distanceToPoint(center()) <= radius());
 }
@@ -55,10 +38,6 @@ Vector2D Circle::project(const Vector2D &point) const {
     return center() + (point - center()).stretchToLength(radius());
 }
 
-void Circle::move(const Vector2D &amount) {
-    this->_center += amount;
-}
-
 bool Circle::operator==(const Circle &other) const {
     return (center() == other.center()) && (Utils::Compare::isEqual(radius(), other.radius()));
 }
@@ -67,38 +46,6 @@ bool Circle::operator!=(const Circle &other) const {
     return !(*this == other);
 }
 
-Circle Circle::operator+(const Vector2D &other) const {
-    return Circle(center() + other, radius());
-}
-
-Circle Circle::operator-(const Vector2D &other) const {
-    return Circle(center() - other, radius());
-}
-
-Circle Circle::operator+=(const Vector2D &other) {
-    return Circle(_center += other, radius());
-}
-
-Circle Circle::operator-=(const Vector2D &other) {
-    return Circle(_center -= other, radius());
-}
-
-Circle Circle::operator*(const float &scale) const {
-    return Circle(center(), radius() * fabs(scale));
-}
-
-Circle Circle::operator/(const float &scale) const {
-    return Circle(center(), radius() / fabs(scale));
-}
-
-Circle Circle::operator*=(const float &scale) {
-    return Circle(center(), _radius *= fabs(scale));
-}
-
-Circle Circle::operator/=(const float &scale) {
-    return Circle(center(), _radius /= fabs(scale));
-}
-
 QString Circle::toQString() {
     return QString("Center: (%1, %2)\nRadius: %3").arg(_center.x()).arg(_center.y()).arg(_radius);
 }
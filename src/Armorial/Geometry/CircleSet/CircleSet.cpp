@@ -0,0 +1,410 @@
+#include <Armorial/Geometry/CircleSet/CircleSet.h>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ARMORIAL_CIRCLESET_X86
+#endif
+
+using namespace Geometry;
+
+namespace {
+    /*!
+     * \brief The segment terms shared by every circle test.
+     */
+    struct Segment {
+        float ax, ay;
+        float dx, dy;
+        float inverseSquaredLength;
+        float squaredLength;
+        float length;
+    };
+
+    /*!
+     * \brief The per-coordinate arrays of the set.
+     */
+    struct Circles {
+        const float *xs, *ys;
+        const float *radii, *growths, *slopes;
+        size_t count;
+    };
+
+    Segment segmentOf(const LineSegment &segment) {
+        const Vector2D direction = segment.end() - segment.start();
+        const float squaredLength = direction.x() * direction.x() + direction.y() * direction.y();
+
+        // A point segment projects every center onto its start
+        const float inverse = (squaredLength > 0.0f) ? 1.0f / squaredLength : 0.0f;
+        return Segment{segment.start().x(), segment.start().y(), direction.x(), direction.y(), inverse,
+                       squaredLength, std::sqrt(squaredLength)};
+    }
+
+    /*!
+     * \brief Keeps the obstruction with the smallest distance, and the smallest index among equal
+     * distances.
+     */
+    void keepClosest(CircleSet::Obstruction &best, float distance, size_t index) {
+        if(distance < best.distance || (!(best.distance < distance) && index < best.index)) {
+            best = CircleSet::Obstruction{true, index, distance};
+        }
+    }
+
+    /*!
+     * \brief The circle i blocks the segment if dist(s) <= radius + growth * s at some distance s
+     * along it, where dist(s) is the distance from the point at s to the center. dist(s) - growth * s
+     * is convex, and its minimum is at s0 + growth * h / sqrt(1 - growth²), where s0 is the projection
+     * of the center and h its distance to the line (slope is the factor of h, precomputed by
+     * CircleSet::add), clamped to the segment. The test is made at that point, as the parameter t in
+     * [0, 1] along the segment.
+     * \param cx, cy The center of the circle, relative to the segment start.
+     * \param t Set to the parameter of the tested point.
+     */
+    bool scalarBlocks(const Segment &segment, const Circles &circles, size_t i, float cx, float cy, float &t) {
+        const float projection = (cx * segment.dx + cy * segment.dy) * segment.inverseSquaredLength;
+        const float offset = circles.slopes[i] * (std::fabs(cx * segment.dy - cy * segment.dx) * segment.inverseSquaredLength);
+        t = std::min(std::max(projection + offset, 0.0f), 1.0f);
+        const float px = cx - t * segment.dx, py = cy - t * segment.dy;
+        const float squaredDistance = px * px + py * py;
+        const float radius = circles.radii[i] + circles.growths[i] * (t * segment.length);
+
+        return squaredDistance <= radius * radius && radius >= 0.0f;
+    }
+
+    /*!
+     * \brief The distance along the segment at which it enters a circle that blocks it, the smallest
+     * root of |c - t * d|² = (radius + growth * length * t)², which is at most the tested parameter t.
+     * The root is taken as c / (b + sqrt(b² - a * c)), which holds for any growth.
+     */
+    float scalarEntry(const Segment &segment, const Circles &circles, size_t i, float cx, float cy, float t) {
+        const float radius = circles.radii[i], growth = circles.growths[i];
+        const float a = segment.squaredLength * (1.0f - growth * growth);
+        const float b = (cx * segment.dx + cy * segment.dy) + radius * growth * segment.length;
+        const float c = (cx * cx + cy * cy) - radius * radius;
+        const float root = c / (b + std::sqrt(std::max(0.0f, b * b - a * c)));
+        const float entry = (c > 0.0f) ? std::min(std::max(0.0f, root), t) : 0.0f;
+
+        return entry * segment.length;
+    }
+
+    /*!
+     * \brief The scalar kernels test the circles from the given index on, so the SIMD kernels use
+     * them for the remaining circles. All the kernels evaluate the same operations in the same order,
+     * so their results are identical.
+     */
+    void scalarObstruction(const Segment &segment, const Circles &circles, size_t from, CircleSet::Obstruction &best) {
+        for(size_t i = from; i < circles.count; i++) {
+            const float cx = circles.xs[i] - segment.ax, cy = circles.ys[i] - segment.ay;
+            float t;
+            if(scalarBlocks(segment, circles, i, cx, cy, t)) {
+                const float distance = scalarEntry(segment, circles, i, cx, cy, t);
+                if(distance < best.distance) {
+                    best = CircleSet::Obstruction{true, i, distance};
+                }
+            }
+        }
+    }
+
+    bool scalarBlocked(const Segment &segment, const Circles &circles, size_t from) {
+        for(size_t i = from; i < circles.count; i++) {
+            const float cx = circles.xs[i] - segment.ax, cy = circles.ys[i] - segment.ay;
+            float t;
+            if(scalarBlocks(segment, circles, i, cx, cy, t)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+#ifdef ARMORIAL_CIRCLESET_X86
+    // Each lane tests one circle, 4 (SSE) or 8 (AVX2) at a time, with the same operations as
+    // scalarBlocks() and scalarEntry(). The obstruction kernels keep the closest obstruction each
+    // lane found, and the lanes are merged at the end.
+
+    struct SseSegment {
+        __m128 ax, ay, dx, dy, inverse, squaredLength, length;
+    };
+
+    __attribute__((target("sse2")))
+    SseSegment sseSegmentOf(const Segment &segment) {
+        return SseSegment{_mm_set1_ps(segment.ax), _mm_set1_ps(segment.ay), _mm_set1_ps(segment.dx),
+                          _mm_set1_ps(segment.dy), _mm_set1_ps(segment.inverseSquaredLength),
+                          _mm_set1_ps(segment.squaredLength), _mm_set1_ps(segment.length)};
+    }
+
+    __attribute__((target("sse2")))
+    inline __m128 sseBlocks(const SseSegment &segment, const Circles &circles, size_t i, __m128 cx, __m128 cy, __m128 &t) {
+        const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), sign = _mm_set1_ps(-0.0f);
+        const __m128 projection = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(cx, segment.dx), _mm_mul_ps(cy, segment.dy)), segment.inverse);
+        const __m128 cross = _mm_andnot_ps(sign, _mm_sub_ps(_mm_mul_ps(cx, segment.dy), _mm_mul_ps(cy, segment.dx)));
+        const __m128 offset = _mm_mul_ps(_mm_loadu_ps(circles.slopes + i), _mm_mul_ps(cross, segment.inverse));
+        t = _mm_min_ps(_mm_max_ps(_mm_add_ps(projection, offset), zero), one);
+        const __m128 px = _mm_sub_ps(cx, _mm_mul_ps(t, segment.dx)), py = _mm_sub_ps(cy, _mm_mul_ps(t, segment.dy));
+        const __m128 squaredDistance = _mm_add_ps(_mm_mul_ps(px, px), _mm_mul_ps(py, py));
+        const __m128 radius = _mm_add_ps(_mm_loadu_ps(circles.radii + i),
+                                         _mm_mul_ps(_mm_loadu_ps(circles.growths + i), _mm_mul_ps(t, segment.length)));
+
+        return _mm_and_ps(_mm_cmple_ps(squaredDistance, _mm_mul_ps(radius, radius)), _mm_cmpge_ps(radius, zero));
+    }
+
+    __attribute__((target("sse2")))
+    inline __m128 sseEntry(const SseSegment &segment, const Circles &circles, size_t i, __m128 cx, __m128 cy, __m128 t) {
+        const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+        const __m128 radius = _mm_loadu_ps(circles.radii + i), growth = _mm_loadu_ps(circles.growths + i);
+        const __m128 a = _mm_mul_ps(segment.squaredLength, _mm_sub_ps(one, _mm_mul_ps(growth, growth)));
+        const __m128 b = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, segment.dx), _mm_mul_ps(cy, segment.dy)),
+                                    _mm_mul_ps(_mm_mul_ps(radius, growth), segment.length));
+        const __m128 c = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(cx, cx), _mm_mul_ps(cy, cy)), _mm_mul_ps(radius, radius));
+        const __m128 discriminant = _mm_max_ps(_mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(a, c)), zero);
+        const __m128 root = _mm_div_ps(c, _mm_add_ps(b, _mm_sqrt_ps(discriminant)));
+        const __m128 entry = _mm_and_ps(_mm_cmpgt_ps(c, zero), _mm_min_ps(_mm_max_ps(root, zero), t));
+
+        return _mm_mul_ps(entry, segment.length);
+    }
+
+    __attribute__((target("sse2")))
+    size_t sseObstruction(const Segment &terms, const Circles &circles, CircleSet::Obstruction &best) {
+        const SseSegment segment = sseSegmentOf(terms);
+        __m128 bestDistances = _mm_set1_ps(std::numeric_limits<float>::infinity());
+        __m128i bestIndices = _mm_setzero_si128(), indices = _mm_setr_epi32(0, 1, 2, 3);
+        const __m128i step = _mm_set1_epi32(4);
+
+        size_t i = 0;
+        for(; i + 4 <= circles.count; i += 4) {
+            const __m128 cx = _mm_sub_ps(_mm_loadu_ps(circles.xs + i), segment.ax);
+            const __m128 cy = _mm_sub_ps(_mm_loadu_ps(circles.ys + i), segment.ay);
+            __m128 t;
+            const __m128 blocked = sseBlocks(segment, circles, i, cx, cy, t);
+            if(_mm_movemask_ps(blocked) != 0) {
+                const __m128 distance = sseEntry(segment, circles, i, cx, cy, t);
+                const __m128 closer = _mm_and_ps(blocked, _mm_cmplt_ps(distance, bestDistances));
+                bestDistances = _mm_or_ps(_mm_and_ps(closer, distance), _mm_andnot_ps(closer, bestDistances));
+                const __m128i closerIndices = _mm_castps_si128(closer);
+                bestIndices = _mm_or_si128(_mm_and_si128(closerIndices, indices), _mm_andnot_si128(closerIndices, bestIndices));
+            }
+            indices = _mm_add_epi32(indices, step);
+        }
+
+        alignas(16) float distances[4];
+        alignas(16) int lanes[4];
+        _mm_store_ps(distances, bestDistances);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), bestIndices);
+        for(int lane = 0; lane < 4; lane++) {
+            if(distances[lane] < std::numeric_limits<float>::infinity()) {
+                keepClosest(best, distances[lane], size_t(lanes[lane]));
+            }
+        }
+
+        return i;
+    }
+
+    __attribute__((target("sse2")))
+    bool sseBlocked(const Segment &terms, const Circles &circles, size_t &done) {
+        const SseSegment segment = sseSegmentOf(terms);
+        for(done = 0; done + 4 <= circles.count; done += 4) {
+            const __m128 cx = _mm_sub_ps(_mm_loadu_ps(circles.xs + done), segment.ax);
+            const __m128 cy = _mm_sub_ps(_mm_loadu_ps(circles.ys + done), segment.ay);
+            __m128 t;
+            if(_mm_movemask_ps(sseBlocks(segment, circles, done, cx, cy, t)) != 0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    struct Avx2Segment {
+        __m256 ax, ay, dx, dy, inverse, squaredLength, length;
+    };
+
+    __attribute__((target("avx2")))
+    Avx2Segment avx2SegmentOf(const Segment &segment) {
+        return Avx2Segment{_mm256_set1_ps(segment.ax), _mm256_set1_ps(segment.ay), _mm256_set1_ps(segment.dx),
+                           _mm256_set1_ps(segment.dy), _mm256_set1_ps(segment.inverseSquaredLength),
+                           _mm256_set1_ps(segment.squaredLength), _mm256_set1_ps(segment.length)};
+    }
+
+    __attribute__((target("avx2")))
+    inline __m256 avx2Blocks(const Avx2Segment &segment, const Circles &circles, size_t i, __m256 cx, __m256 cy, __m256 &t) {
+        const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f), sign = _mm256_set1_ps(-0.0f);
+        const __m256 projection = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(cx, segment.dx), _mm256_mul_ps(cy, segment.dy)),
+                                                segment.inverse);
+        const __m256 cross = _mm256_andnot_ps(sign, _mm256_sub_ps(_mm256_mul_ps(cx, segment.dy), _mm256_mul_ps(cy, segment.dx)));
+        const __m256 offset = _mm256_mul_ps(_mm256_loadu_ps(circles.slopes + i), _mm256_mul_ps(cross, segment.inverse));
+        t = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(projection, offset), zero), one);
+        const __m256 px = _mm256_sub_ps(cx, _mm256_mul_ps(t, segment.dx)), py = _mm256_sub_ps(cy, _mm256_mul_ps(t, segment.dy));
+        const __m256 squaredDistance = _mm256_add_ps(_mm256_mul_ps(px, px), _mm256_mul_ps(py, py));
+        const __m256 radius = _mm256_add_ps(_mm256_loadu_ps(circles.radii + i),
+                                            _mm256_mul_ps(_mm256_loadu_ps(circles.growths + i), _mm256_mul_ps(t, segment.length)));
+
+        return _mm256_and_ps(_mm256_cmp_ps(squaredDistance, _mm256_mul_ps(radius, radius), _CMP_LE_OQ),
+                             _mm256_cmp_ps(radius, zero, _CMP_GE_OQ));
+    }
+
+    __attribute__((target("avx2")))
+    inline __m256 avx2Entry(const Avx2Segment &segment, const Circles &circles, size_t i, __m256 cx, __m256 cy, __m256 t) {
+        const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+        const __m256 radius = _mm256_loadu_ps(circles.radii + i), growth = _mm256_loadu_ps(circles.growths + i);
+        const __m256 a = _mm256_mul_ps(segment.squaredLength, _mm256_sub_ps(one, _mm256_mul_ps(growth, growth)));
+        const __m256 b = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(cx, segment.dx), _mm256_mul_ps(cy, segment.dy)),
+                                       _mm256_mul_ps(_mm256_mul_ps(radius, growth), segment.length));
+        const __m256 c = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(cx, cx), _mm256_mul_ps(cy, cy)), _mm256_mul_ps(radius, radius));
+        const __m256 discriminant = _mm256_max_ps(_mm256_sub_ps(_mm256_mul_ps(b, b), _mm256_mul_ps(a, c)), zero);
+        const __m256 root = _mm256_div_ps(c, _mm256_add_ps(b, _mm256_sqrt_ps(discriminant)));
+        const __m256 entry = _mm256_and_ps(_mm256_cmp_ps(c, zero, _CMP_GT_OQ), _mm256_min_ps(_mm256_max_ps(root, zero), t));
+
+        return _mm256_mul_ps(entry, segment.length);
+    }
+
+    __attribute__((target("avx2")))
+    size_t avx2Obstruction(const Segment &terms, const Circles &circles, CircleSet::Obstruction &best) {
+        const Avx2Segment segment = avx2SegmentOf(terms);
+        __m256 bestDistances = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+        __m256i bestIndices = _mm256_setzero_si256(), indices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i step = _mm256_set1_epi32(8);
+
+        size_t i = 0;
+        for(; i + 8 <= circles.count; i += 8) {
+            const __m256 cx = _mm256_sub_ps(_mm256_loadu_ps(circles.xs + i), segment.ax);
+            const __m256 cy = _mm256_sub_ps(_mm256_loadu_ps(circles.ys + i), segment.ay);
+            __m256 t;
+            const __m256 blocked = avx2Blocks(segment, circles, i, cx, cy, t);
+            if(_mm256_movemask_ps(blocked) != 0) {
+                const __m256 distance = avx2Entry(segment, circles, i, cx, cy, t);
+                const __m256 closer = _mm256_and_ps(blocked, _mm256_cmp_ps(distance, bestDistances, _CMP_LT_OQ));
+                bestDistances = _mm256_blendv_ps(bestDistances, distance, closer);
+                bestIndices = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(bestIndices),
+                                                                   _mm256_castsi256_ps(indices), closer));
+            }
+            indices = _mm256_add_epi32(indices, step);
+        }
+
+        alignas(32) float distances[8];
+        alignas(32) int lanes[8];
+        _mm256_store_ps(distances, bestDistances);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), bestIndices);
+        for(int lane = 0; lane < 8; lane++) {
+            if(distances[lane] < std::numeric_limits<float>::infinity()) {
+                keepClosest(best, distances[lane], size_t(lanes[lane]));
+            }
+        }
+
+        return i;
+    }
+
+    __attribute__((target("avx2")))
+    bool avx2Blocked(const Segment &terms, const Circles &circles, size_t &done) {
+        const Avx2Segment segment = avx2SegmentOf(terms);
+        for(done = 0; done + 8 <= circles.count; done += 8) {
+            const __m256 cx = _mm256_sub_ps(_mm256_loadu_ps(circles.xs + done), segment.ax);
+            const __m256 cy = _mm256_sub_ps(_mm256_loadu_ps(circles.ys + done), segment.ay);
+            __m256 t;
+            if(_mm256_movemask_ps(avx2Blocks(segment, circles, done, cx, cy, t)) != 0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+#endif
+}
+
+CircleSet::CircleSet(const std::vector<Circle> &circles) {
+    for(const Circle &circle : circles) {
+        add(circle);
+    }
+}
+
+size_t CircleSet::add(const Circle &circle, float radiusGrowth) {
+    _xs.push_back(circle.center().x());
+    _ys.push_back(circle.center().y());
+    _radii.push_back(circle.radius());
+    _radiusGrowths.push_back(radiusGrowth);
+
+    // radiusGrowth / sqrt(1 - radiusGrowth²) (see scalarBlocks). A growth of 1 or more makes the
+    // closest point the segment end (or its start, for -1 or less), which the largest slope reaches
+    const float slope = (std::fabs(radiusGrowth) < 1.0f) ? radiusGrowth / std::sqrt(1.0f - radiusGrowth * radiusGrowth)
+                                                         : std::copysign(std::numeric_limits<float>::max(), radiusGrowth);
+    _growthSlopes.push_back(slope);
+
+    return _xs.size() - 1;
+}
+
+void CircleSet::clear() {
+    _xs.clear();
+    _ys.clear();
+    _radii.clear();
+    _radiusGrowths.clear();
+    _growthSlopes.clear();
+}
+
+size_t CircleSet::size() const {
+    return _xs.size();
+}
+
+Circle CircleSet::circle(size_t index) const {
+    return Circle(Vector2D(_xs[index], _ys[index]), _radii[index]);
+}
+
+bool CircleSet::isBlocked(const LineSegment &segment, Batch::Kernel kernel) const {
+    const Segment terms = segmentOf(segment);
+    const Circles circles{_xs.data(), _ys.data(), _radii.data(), _radiusGrowths.data(), _growthSlopes.data(), size()};
+
+    // Stops at the first group of circles with a blocking one
+    size_t done = 0;
+#ifdef ARMORIAL_CIRCLESET_X86
+    switch(kernel) {
+        case Batch::Kernel::AVX2:
+            if(avx2Blocked(terms, circles, done)) {
+                return true;
+            }
+            break;
+        case Batch::Kernel::SSE:
+            if(sseBlocked(terms, circles, done)) {
+                return true;
+            }
+            break;
+        default:
+            break;
+    }
+#else
+    (void) kernel;
+#endif
+
+    return scalarBlocked(terms, circles, done);
+}
+
+CircleSet::Obstruction CircleSet::obstruction(const LineSegment &segment, Batch::Kernel kernel) const {
+    const Segment terms = segmentOf(segment);
+    const Circles circles{_xs.data(), _ys.data(), _radii.data(), _radiusGrowths.data(), _growthSlopes.data(), size()};
+    Obstruction best;
+
+    // Runs the selected SIMD kernel (which returns how many circles it tested), then the scalar
+    // one on the remaining circles
+    size_t done = 0;
+#ifdef ARMORIAL_CIRCLESET_X86
+    switch(kernel) {
+        case Batch::Kernel::AVX2:
+            done = avx2Obstruction(terms, circles, best);
+            break;
+        case Batch::Kernel::SSE:
+            done = sseObstruction(terms, circles, best);
+            break;
+        default:
+            break;
+    }
+#else
+    (void) kernel;
+#endif
+    scalarObstruction(terms, circles, done, best);
+
+    return best;
+}
+
+void CircleSet::obstructions(const LineSegment *segments, Obstruction *out, size_t count, Batch::Kernel kernel) const {
+    for(size_t i = 0; i < count; i++) {
+        out[i] = obstruction(segments[i], kernel);
+    }
+}
@@ -0,0 +1,252 @@
+#include <Armorial/Geometry/KDTree/KDTree.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace Geometry;
+
+namespace {
+    inline float coordinate(const Vector2D &point, unsigned char axis) {
+        return (axis == 0 ? point.x() : point.y());
+    }
+
+    inline float squaredDistance(const Vector2D &a, const Vector2D &b) {
+        const float dx = a.x() - b.x();
+        const float dy = a.y() - b.y();
+        return dx * dx + dy * dy;
+    }
+}
+
+KDTree::KDTree(const std::vector<Vector2D> &points) {
+    build(points);
+}
+
+void KDTree::build(const std::vector<Vector2D> &points) {
+    build(points.data(), points.size());
+}
+
+void KDTree::build(const Vector2D *points, size_t count) {
+    _entries.resize(count);
+    _axes.resize(count);
+    for(size_t i = 0; i < count; i++) {
+        _entries[i] = Entry{points[i], i};
+    }
+
+    buildRange(0, count);
+}
+
+void KDTree::buildRange(size_t begin, size_t end) {
+    if(end - begin <= LeafSize) {
+        return;
+    }
+
+    float minX = std::numeric_limits<float>::max(), maxX = std::numeric_limits<float>::lowest();
+    float minY = minX, maxY = maxX;
+    for(size_t i = begin; i < end; i++) {
+        minX = std::min(minX, _entries[i].point.x());
+        maxX = std::max(maxX, _entries[i].point.x());
+        minY = std::min(minY, _entries[i].point.y());
+        maxY = std::max(maxY, _entries[i].point.y());
+    }
+
+    // After the partition, points at the left of the median are not greater than it in the split
+    // axis, and points at its right are not smaller
+    const unsigned char axis = (maxX - minX >= maxY - minY ? 0 : 1);
+    const size_t mid = begin + (end - begin) / 2;
+    std::nth_element(_entries.begin() + begin, _entries.begin() + mid, _entries.begin() + end,
+                     [axis](const Entry &a, const Entry &b) {
+                         return coordinate(a.point, axis) < coordinate(b.point, axis);
+                     });
+    _axes[mid] = axis;
+
+    buildRange(begin, mid);
+    buildRange(mid + 1, end);
+}
+
+size_t KDTree::size() const {
+    return _entries.size();
+}
+
+bool KDTree::empty() const {
+    return _entries.empty();
+}
+
+std::optional<size_t> KDTree::nearest(const Vector2D &query) const {
+    if(empty()) {
+        return std::nullopt;
+    }
+
+    float bestDistance = std::numeric_limits<float>::infinity();
+    size_t best = 0;
+    searchNearest(0, size(), query, bestDistance, best);
+
+    return _entries[best].index;
+}
+
+std::vector<size_t> KDTree::kNearest(const Vector2D &query, size_t k) const {
+    // Max-heap on the distance, holding the best k candidates found so far
+    std::vector<std::pair<float, size_t>> heap;
+    heap.reserve(std::min(k, size()) + 1);
+    if(k > 0) {
+        searchNearest(0, size(), query, k, heap);
+    }
+
+    std::sort_heap(heap.begin(), heap.end());
+    std::vector<size_t> indices(heap.size());
+    for(size_t i = 0; i < heap.size(); i++) {
+        indices[i] = _entries[heap[i].second].index;
+    }
+
+    return indices;
+}
+
+void KDTree::searchNearest(size_t begin, size_t end, const Vector2D &query, float &bestDistance, size_t &best) const {
+    auto consider = [&](size_t i) {
+        const float distance = squaredDistance(_entries[i].point, query);
+        if(distance < bestDistance) {
+            bestDistance = distance;
+            best = i;
+        }
+    };
+
+    if(end - begin <= LeafSize) {
+        for(size_t i = begin; i < end; i++) {
+            consider(i);
+        }
+        return;
+    }
+
+    const size_t mid = begin + (end - begin) / 2;
+    const float offset = coordinate(query, _axes[mid]) - coordinate(_entries[mid].point, _axes[mid]);
+    consider(mid);
+
+    // Search the side of the query first, and the other one only if it can hold a closer point
+    if(offset < 0.0f) {
+        searchNearest(begin, mid, query, bestDistance, best);
+        if(offset * offset < bestDistance) {
+            searchNearest(mid + 1, end, query, bestDistance, best);
+        }
+    }
+    else {
+        searchNearest(mid + 1, end, query, bestDistance, best);
+        if(offset * offset < bestDistance) {
+            searchNearest(begin, mid, query, bestDistance, best);
+        }
+    }
+}
+
+void KDTree::searchNearest(size_t begin, size_t end, const Vector2D &query, size_t k,
+                           std::vector<std::pair<float, size_t>> &heap) const {
+    auto consider = [&](size_t i) {
+        const float distance = squaredDistance(_entries[i].point, query);
+        if(heap.size() < k) {
+            heap.emplace_back(distance, i);
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if(distance < heap.front().first) {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = {distance, i};
+            std::push_heap(heap.begin(), heap.end());
+        }
+    };
+
+    if(end - begin <= LeafSize) {
+        for(size_t i = begin; i < end; i++) {
+            consider(i);
+        }
+        return;
+    }
+
+    const size_t mid = begin + (end - begin) / 2;
+    const float offset = coordinate(query, _axes[mid]) - coordinate(_entries[mid].point, _axes[mid]);
+    consider(mid);
+
+    // Search the side of the query first, and the other one only if it can hold a closer point
+    if(offset < 0.0f) {
+        searchNearest(begin, mid, query, k, heap);
+        if(heap.size() < k || offset * offset < heap.front().first) {
+            searchNearest(mid + 1, end, query, k, heap);
+        }
+    }
+    else {
+        searchNearest(mid + 1, end, query, k, heap);
+        if(heap.size() < k || offset * offset < heap.front().first) {
+            searchNearest(begin, mid, query, k, heap);
+        }
+    }
+}
+
+template<typename Visitor>
+void KDTree::visitBox(size_t begin, size_t end, float minX, float maxX, float minY, float maxY, Visitor &visitor) const {
+    if(end - begin <= LeafSize) {
+        for(size_t i = begin; i < end; i++) {
+            visitor(_entries[i]);
+        }
+        return;
+    }
+
+    const size_t mid = begin + (end - begin) / 2;
+    const unsigned char axis = _axes[mid];
+    const float split = coordinate(_entries[mid].point, axis);
+    visitor(_entries[mid]);
+
+    if((axis == 0 ? minX : minY) <= split) {
+        visitBox(begin, mid, minX, maxX, minY, maxY, visitor);
+    }
+    if((axis == 0 ? maxX : maxY) >= split) {
+        visitBox(mid + 1, end, minX, maxX, minY, maxY, visitor);
+    }
+}
+
+std::vector<size_t> KDTree::withinRadius(const Vector2D &center, float radius) const {
+    std::vector<size_t> indices;
+    const float squaredRadius = radius * radius;
+    auto visitor = [&](const Entry &entry) {
+        if(squaredDistance(entry.point, center) <= squaredRadius) {
+            indices.push_back(entry.index);
+        }
+    };
+    visitBox(0, size(), center.x() - radius, center.x() + radius, center.y() - radius, center.y() + radius, visitor);
+
+    return indices;
+}
+
+std::vector<size_t> KDTree::inRectangle(const Rectangle &rectangle) const {
+    std::vector<size_t> indices;
+    auto visitor = [&](const Entry &entry) {
+        if(rectangle.contains(entry.point)) {
+            indices.push_back(entry.index);
+        }
+    };
+    visitBox(0, size(), rectangle.topLeft().x(), rectangle.topRight().x(),
+             rectangle.bottomLeft().y(), rectangle.topLeft().y(), visitor);
+
+    return indices;
+}
+
+std::vector<size_t> KDTree::inPolygon(const Polygon &polygon) const {
+    std::vector<size_t> indices;
+    if(polygon.amountOfVertices() == 0) {
+        return indices;
+    }
+
+    // Only the points inside the polygon bounding box need the exact test
+    float minX = std::numeric_limits<float>::max(), maxX = std::numeric_limits<float>::lowest();
+    float minY = minX, maxY = maxX;
+    for(size_t i = 0; i < polygon.amountOfVertices(); i++) {
+        const Vector2D vertex = polygon[i];
+        minX = std::min(minX, vertex.x());
+        maxX = std::max(maxX, vertex.x());
+        minY = std::min(minY, vertex.y());
+        maxY = std::max(maxY, vertex.y());
+    }
+
+    auto visitor = [&](const Entry &entry) {
+        if(polygon.contains(entry.point)) {
+            indices.push_back(entry.index);
+        }
+    };
+    visitBox(0, size(), minX, maxX, minY, maxY, visitor);
+
+    return indices;
+}
@@ -23,17 +23,6 @@ Line::Line(const LineSegment &other) {
     }
 }
 
-float Line::distanceToLine(const Vector2D &point) const {
-    return (project(point) - point).length();
-}
-
-Vector2D Line::project(const Vector2D &point) const {
-    Vector2D ab = _p2 - _p1;
-    Vector2D ap = point - _p1;
-
-    return _p1 + ab * (ap.dotProduct(ab) / pow(ab.length(), 2));
-}
-
 std::optional<Vector2D> Line::intersect(const Line &other) const {
     Vector2D line_a = _p1 - _p2;
     Vector2D line_b = other._p1 - other._p2;
@@ -1,5 +1,6 @@
 #include <Armorial/Geometry/LineSegment/LineSegment.h>
 #include <Armorial/Geometry/Line/Line.h>
+#include <Armorial/Geometry/Rotation2D/Rotation2D.h>
 
 #include <Armorial/Utils/Utils.h>
 
@@ -9,31 +10,6 @@
 
 using namespace Geometry;
 
-LineSegment::LineSegment(const Vector2D &start, const Vector2D &end) {
-    _start = start;
-    _end = end;
-}
-
-Vector2D LineSegment::start() const {
-    return _start;
-}
-
-Vector2D LineSegment::end() const {
-    return _end;
-}
-
-float LineSegment::length() const {
-    return (end() - start()).length();
-}
-
-float LineSegment::length2() const {
-    return (end() - start()).length2();
-}
-
-bool LineSegment::isPoint() const {
-    return (start() == end());
-}
-
 float LineSegment::distanceToLine(const Vector2D& point) const {
     return (project(point) - point).length();
 }
@@ -119,29 +95,10 @@ bool LineSegment::doesIntersect(const LineSegment &other) const {
     return intersects(other).has_value();
 }
 
-Vector2D LineSegment::direction() const {
-    return (end() - start());
-}
-
-void LineSegment::move(const Vector2D &amount) {
-    _start += amount;
-    _end += amount;
-}
-
 void LineSegment::rotate(const Angle &angle, const Vector2D &pivot) {
-    Vector2D midpoint = pivot;
-
-    Vector2D startNewMidpoint = Vector2D(start().x() - midpoint.x(), start().y() - midpoint.y());
-    Vector2D endNewMidpoint = Vector2D(end().x() - midpoint.x(), end().y() - midpoint.y());
-
-    Vector2D startRotated = Vector2D((cos(angle.value()) * startNewMidpoint.x() - sin(angle.value()) * startNewMidpoint.y()), (sin(angle.value()) * startNewMidpoint.x() + cos(angle.value()) * startNewMidpoint.y()));
-    Vector2D endRotated = Vector2D((cos(angle.value()) * endNewMidpoint.x() - sin(angle.value()) * endNewMidpoint.y()), (sin(angle.value()) * endNewMidpoint.x() + cos(angle.value()) * endNewMidpoint.y()));
-
-    startRotated += midpoint;
-    endRotated += midpoint;
-
-    _start = startRotated;
-    _end = endRotated;
+    const Rotation2D rotation(angle);
+    _start = rotation.rotateAround(_start, pivot);
+    _end = rotation.rotateAround(_end, pivot);
 }
 
 std::optional<float> LineSegment::relativePosition(const Vector2D &pointOnLine) const {
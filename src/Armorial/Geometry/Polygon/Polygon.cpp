@@ -6,9 +6,67 @@
 #include <iostream>
 #include <algorithm>
 #include <math.h>
+#include <cmath>
 
 using namespace Geometry;
 
+namespace {
+    // Vertices without consecutive repetitions, in counter-clockwise order
+    std::vector<Vector2D> counterClockwise(const std::vector<Vector2D> &vertices) {
+        std::vector<Vector2D> result;
+        result.reserve(vertices.size());
+        for(const Vector2D &vertex : vertices) {
+            if(result.empty() || !(result.back() == vertex)) {
+                result.push_back(vertex);
+            }
+        }
+        while(result.size() > 1 && result.back() == result.front()) {
+            result.pop_back();
+        }
+
+        float signedArea = 0.0f;
+        for(size_t i = 1; i + 1 < result.size(); i++) {
+            signedArea += Polygon::orientation(result[0], result[i], result[i + 1]);
+        }
+        if(signedArea < 0.0f) {
+            std::reverse(result.begin(), result.end());
+        }
+
+        return result;
+    }
+
+    // Keeps the part of the polygon at the left of the directed line from a to b
+    std::vector<Vector2D> clipByHalfPlane(const std::vector<Vector2D> &vertices, const Vector2D &a, const Vector2D &b) {
+        std::vector<Vector2D> result;
+        const size_t count = vertices.size();
+        result.reserve(count + 1);
+        for(size_t i = 0; i < count; i++) {
+            const Vector2D &current = vertices[i];
+            const Vector2D &next = vertices[(i + 1) % count];
+            const float currentSide = Polygon::orientation(a, b, current);
+            const float nextSide = Polygon::orientation(a, b, next);
+
+            if(currentSide >= 0.0f) {
+                result.push_back(current);
+            }
+            if((currentSide < 0.0f && nextSide > 0.0f) || (currentSide > 0.0f && nextSide < 0.0f)) {
+                result.push_back(current + (next - current) * (currentSide / (currentSide - nextSide)));
+            }
+        }
+
+        return result;
+    }
+
+    Polygon fromVertices(const std::vector<Vector2D> &vertices) {
+        Polygon polygon;
+        for(const Vector2D &vertex : vertices) {
+            polygon.insertVertice(vertex);
+        }
+
+        return polygon;
+    }
+}
+
 Polygon::Polygon(const std::vector<Vector2D> &vertices) {
     _vertices = vertices;
     if (_vertices.size() < 3) {
@@ -52,11 +110,17 @@ size_t Polygon::amountOfVertices() const {
     return _vertices.size();
 }
 
+LineSegment Polygon::edge(const size_t &id) const {
+    const size_t next = (id + 1 < amountOfVertices()) ? id + 1 : 0;
+    return LineSegment(_vertices[id], _vertices[next]);
+}
+
 std::vector<LineSegment> Polygon::boundary() const {
     std::vector<LineSegment> boundary;
     size_t sz_vertices = amountOfVertices();
+    boundary.reserve(sz_vertices);
     for (size_t i = 0; i < sz_vertices; i++) {
-        boundary.push_back({_vertices[i], _vertices[(i + 1) % sz_vertices]});
+        boundary.push_back(edge(i));
     }
 
     return boundary;
@@ -64,10 +128,8 @@ std::vector<LineSegment> Polygon::boundary() const {
 
 float Polygon::perimeterLength() const {
     float length = 0;
-    std::vector<LineSegment> polygonBoundary = boundary();
-
-    for (auto &ls : polygonBoundary) {
-        length += ls.length();
+    for (size_t i = 0; i < amountOfVertices(); i++) {
+        length += edge(i).length();
     }
 
     return length;
@@ -100,6 +162,27 @@ bool Polygon::isConvex() const {
     return true;
 }
 
+bool Polygon::isConvexFan(const std::vector<Vector2D> &fan) {
+    // Strictly ordered wedges around the pivot and a single turn around the boundary
+    const size_t count = fan.size();
+    for(size_t i = 1; i + 1 < count; i++) {
+        if(!(orientation(fan[0], fan[i], fan[i + 1]) > 0.0f)) {
+            return false;
+        }
+    }
+
+    double turning = 0.0;
+    for(size_t i = 0; i < count; i++) {
+        const Vector2D &a = fan[i], &b = fan[(i + 1) % count], &c = fan[(i + 2) % count];
+        const double ux = b.x() - a.x(), uy = b.y() - a.y();
+        const double vx = c.x() - b.x(), vy = c.y() - b.y();
+        turning += std::atan2(ux * vy - uy * vx, ux * vx + uy * vy);
+    }
+
+    // The total turning of a closed polygon is a multiple of 2 * PI
+    return std::abs(turning - 2.0 * Angle::PI) < Angle::PI;
+}
+
 bool Polygon::contains(const Vector2D &point) const {
     int c = 0;
     int sz_vertices = amountOfVertices();
@@ -113,10 +196,8 @@ bool Polygon::contains(const Vector2D &point) const {
 }
 
 bool Polygon::isOnBoundary(const Vector2D &point) const {
-    std::vector<LineSegment> polygonBoundary = boundary();
-
-    for(auto &ls : polygonBoundary) {
-        if(ls.isOnLine(point)) {
+    for(size_t i = 0; i < amountOfVertices(); i++) {
+        if(edge(i).isOnLine(point)) {
             return true;
         }
     }
@@ -125,10 +206,8 @@ bool Polygon::isOnBoundary(const Vector2D &point) const {
 }
 
 bool Polygon::doesIntersect(const LineSegment &lineSegment) const {
-    std::vector<LineSegment> polygonBoundary = boundary();
-
-    for(auto &ls : polygonBoundary) {
-        if(lineSegment.doesIntersect(ls)) {
+    for(size_t i = 0; i < amountOfVertices(); i++) {
+        if(lineSegment.doesIntersect(edge(i))) {
             return true;
         }
     }
@@ -138,10 +217,9 @@ bool Polygon::doesIntersect(const LineSegment &lineSegment) const {
 
 std::vector<Vector2D> Polygon::getIntersections(const LineSegment &lineSegment) const {
     std::vector<Vector2D> intersections;
-    std::vector<LineSegment> polygonBoundary = boundary();
 
-    for (auto &ls : polygonBoundary) {
-        std::optional<Vector2D> segmentIntersection = lineSegment.intersects(ls);
+    for (size_t i = 0; i < amountOfVertices(); i++) {
+        std::optional<Vector2D> segmentIntersection = lineSegment.intersects(edge(i));
         if (segmentIntersection.has_value()) {
             intersections.push_back(segmentIntersection.value());
         }
@@ -180,6 +258,108 @@ bool Polygon::isSimple() const {
     return intersections.size() == amountOfVertices();
 }
 
+Polygon Polygon::convexHull(std::vector<Vector2D> points) {
+    // Vector2D::operator< compares lengths, the chain needs the points sorted by x and then by y
+    std::sort(points.begin(), points.end(), [](const Vector2D &a, const Vector2D &b) {
+        return (a.x() < b.x()) || (!(b.x() < a.x()) && a.y() < b.y());
+    });
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    if(points.size() < 3) {
+        return fromVertices(points);
+    }
+
+    // Lower hull from left to right, then upper hull from right to left
+    std::vector<Vector2D> hull(2 * points.size());
+    size_t size = 0;
+    for(const Vector2D &point : points) {
+        while(size >= 2 && Polygon::orientation(hull[size - 2], hull[size - 1], point) <= 0.0f) {
+            size--;
+        }
+        hull[size++] = point;
+    }
+    for(size_t i = points.size() - 1, lowerSize = size + 1; i-- > 0;) {
+        while(size >= lowerSize && Polygon::orientation(hull[size - 2], hull[size - 1], points[i]) <= 0.0f) {
+            size--;
+        }
+        hull[size++] = points[i];
+    }
+
+    // The last point is the first one again
+    hull.resize(size - 1);
+    return fromVertices(hull);
+}
+
+Polygon Polygon::offset(const float &distance, const size_t &arcSegments) const {
+    const std::vector<Vector2D> vertices = counterClockwise(_vertices);
+    const size_t count = vertices.size();
+    if(count < 3 || Utils::Compare::isEqual(distance, 0.0f)) {
+        return fromVertices(vertices);
+    }
+
+    // Shrinking a convex polygon is the intersection of its edges' half-planes moved inwards
+    if(distance < 0.0f && isConvex() && isConvexFan(vertices)) {
+        std::vector<Vector2D> result = vertices;
+        for(size_t i = 0; i < count && !result.empty(); i++) {
+            const Vector2D &a = vertices[i], &b = vertices[(i + 1) % count];
+            const Vector2D shift = Vector2D(a.y() - b.y(), b.x() - a.x()).stretchToLength(-distance);
+            result = clipByHalfPlane(result, a + shift, b + shift);
+        }
+
+        return (result.size() < 3) ? Polygon() : fromVertices(result);
+    }
+
+    const float maxStep = 2.0f * Geometry::Angle::PI / std::max<size_t>(arcSegments, 3);
+    std::vector<Vector2D> result;
+    result.reserve(count * 2);
+    for(size_t i = 0; i < count; i++) {
+        const Vector2D &previous = vertices[(i + count - 1) % count];
+        const Vector2D &current = vertices[i];
+        const Vector2D &next = vertices[(i + 1) % count];
+
+        // Outward normals of the incoming and outgoing edges, and the angle between them
+        const Vector2D in = current - previous, out = next - current;
+        const float normalAngle = atan2f(-in.x(), in.y());
+        const float turn = atan2f(in.x() * out.y() - in.y() * out.x(), in.x() * out.x() + in.y() * out.y());
+
+        // Very sharp corners that shrink would be mitered far away, so they are cut instead
+        if(turn * distance < 0.0f && fabsf(turn) > 0.9f * Geometry::Angle::PI) {
+            result.push_back(current + Vector2D(cosf(normalAngle), sinf(normalAngle)) * distance);
+            result.push_back(current + Vector2D(cosf(normalAngle + turn), sinf(normalAngle + turn)) * distance);
+            continue;
+        }
+
+        // Arc vertices on the tangents of the circle, so that the arc is circumscribed (a miter when steps = 1)
+        const size_t steps = (turn * distance > 0.0f) ? std::max<size_t>(1, static_cast<size_t>(ceilf(fabsf(turn) / maxStep))) : 1;
+        const float step = turn / steps;
+        const float radius = distance / cosf(step / 2.0f);
+        for(size_t k = 0; k < steps; k++) {
+            const float angle = normalAngle + (k + 0.5f) * step;
+            result.push_back(current + Vector2D(cosf(angle), sinf(angle)) * radius);
+        }
+    }
+
+    return fromVertices(result);
+}
+
+Polygon Polygon::minkowskiSum(const Circle &disk, const size_t &arcSegments) const {
+    std::vector<Vector2D> vertices = offset(disk.radius(), arcSegments).vertices();
+    for(Vector2D &vertex : vertices) {
+        vertex += disk.center();
+    }
+
+    return fromVertices(vertices);
+}
+
+Polygon Polygon::clip(const Polygon &convexClipper) const {
+    const std::vector<Vector2D> clipper = counterClockwise(convexClipper._vertices);
+    std::vector<Vector2D> result = _vertices;
+    for(size_t i = 0; i < clipper.size() && !result.empty(); i++) {
+        result = clipByHalfPlane(result, clipper[i], clipper[(i + 1) % clipper.size()]);
+    }
+
+    return (result.size() < 3) ? Polygon() : fromVertices(result);
+}
+
 QString Polygon::toQString() {
     QString polygonStr = "";
     for (size_t i = 0; i < _vertices.size(); i++) {
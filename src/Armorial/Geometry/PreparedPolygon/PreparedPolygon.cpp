@@ -0,0 +1,160 @@
+#include <Armorial/Geometry/PreparedPolygon/PreparedPolygon.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Geometry;
+
+PreparedPolygon::PreparedPolygon(const Polygon &polygon) : _polygon(polygon) {
+    const std::vector<Vector2D> vertices = polygon.vertices();
+    const size_t count = vertices.size();
+    if(count == 0) {
+        return;
+    }
+
+    _minX = _maxX = vertices[0].x();
+    _minY = _maxY = vertices[0].y();
+    for(const Vector2D &vertex : vertices) {
+        _minX = std::min(_minX, vertex.x());
+        _maxX = std::max(_maxX, vertex.x());
+        _minY = std::min(_minY, vertex.y());
+        _maxY = std::max(_maxY, vertex.y());
+    }
+    _boundingBox = Rectangle(Vector2D(_minX, _maxY), Vector2D(_maxX, _minY));
+
+    _boundary = polygon.boundary();
+    _perimeterLength = polygon.perimeterLength();
+    _area = polygon.area();
+    _centroid = (count >= 3) ? polygon.centroid() : Vector2D();
+
+    // Same pairs of vertices (each one with the previous) as Polygon::contains
+    _edges.reserve(count);
+    for(size_t i = 0, j = count - 1; i < count; j = i++) {
+        const float dy = vertices[j].y() - vertices[i].y();
+        const float slope = (dy > 0.0f || dy < 0.0f) ? (vertices[j].x() - vertices[i].x()) / dy : 0.0f;
+        _edges.push_back(Edge{vertices[i].x(), vertices[i].y(), vertices[j].y(), slope});
+    }
+
+    // The wedge test needs a counter-clockwise convex polygon with a non-zero area
+    float signedArea = 0.0f;
+    for(size_t i = 1; i + 1 < count; i++) {
+        signedArea += Polygon::orientation(vertices[0], vertices[i], vertices[i + 1]);
+    }
+    if((count >= 3) && polygon.isConvex() && (signedArea > 0.0f || signedArea < 0.0f)) {
+        _fan = vertices;
+        if(signedArea < 0.0f) {
+            std::reverse(_fan.begin(), _fan.end());
+        }
+        _convex = Polygon::isConvexFan(_fan);
+        if(!_convex) {
+            _fan.clear();
+        }
+    }
+}
+
+const Polygon& PreparedPolygon::polygon() const {
+    return _polygon;
+}
+
+const Rectangle& PreparedPolygon::boundingBox() const {
+    return _boundingBox;
+}
+
+float PreparedPolygon::area() const {
+    return _area;
+}
+
+float PreparedPolygon::perimeterLength() const {
+    return _perimeterLength;
+}
+
+const Vector2D& PreparedPolygon::centroid() const {
+    return _centroid;
+}
+
+bool PreparedPolygon::isConvex() const {
+    return _convex;
+}
+
+bool PreparedPolygon::insideBoundingBox(const Vector2D &point) const {
+    return (point.x() >= _minX) & (point.x() <= _maxX) & (point.y() >= _minY) & (point.y() <= _maxY);
+}
+
+bool PreparedPolygon::crossingTest(const Vector2D &point) const {
+    bool inside = false;
+    for(const Edge &edge : _edges) {
+        if(((edge.y1 > point.y()) != (edge.y2 > point.y())) && (point.x() < edge.slope * (point.y() - edge.y1) + edge.x)) {
+            inside = !inside;
+        }
+    }
+
+    return inside;
+}
+
+bool PreparedPolygon::wedgeTest(const Vector2D &point) const {
+    const size_t count = _fan.size();
+    const Vector2D &pivot = _fan[0];
+
+    // Outside the angle the polygon spans around its first vertex
+    if(Polygon::orientation(pivot, _fan[1], point) < 0.0f || Polygon::orientation(pivot, _fan[count - 1], point) > 0.0f) {
+        return false;
+    }
+
+    // Find the wedge (pivot, fan[low], fan[low + 1]) that holds the point
+    size_t low = 1, high = count - 1;
+    while(high - low > 1) {
+        const size_t mid = (low + high) / 2;
+        if(Polygon::orientation(pivot, _fan[mid], point) >= 0.0f) {
+            low = mid;
+        }
+        else {
+            high = mid;
+        }
+    }
+
+    return Polygon::orientation(_fan[low], _fan[low + 1], point) >= 0.0f;
+}
+
+bool PreparedPolygon::contains(const Vector2D &point) const {
+    if(!insideBoundingBox(point)) {
+        return false;
+    }
+
+    return _convex ? wedgeTest(point) : crossingTest(point);
+}
+
+void PreparedPolygon::contains(const Vector2D *points, bool *out, size_t count) const {
+    for(size_t i = 0; i < count; i++) {
+        out[i] = contains(points[i]);
+    }
+}
+
+bool PreparedPolygon::isOnBoundary(const Vector2D &point) const {
+    if(!_boundingBox.contains(point, 1e-4f)) {
+        return false;
+    }
+
+    for(const LineSegment &edge : _boundary) {
+        if(edge.isOnLine(point)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool PreparedPolygon::doesIntersect(const LineSegment &lineSegment) const {
+    const Vector2D &a = lineSegment.start(), &b = lineSegment.end();
+    if(std::max(a.x(), b.x()) < _minX || std::min(a.x(), b.x()) > _maxX
+       || std::max(a.y(), b.y()) < _minY || std::min(a.y(), b.y()) > _maxY) {
+        return false;
+    }
+
+    for(const LineSegment &edge : _boundary) {
+        if(lineSegment.doesIntersect(edge)) {
+            return true;
+        }
+    }
+
+    return false;
+}
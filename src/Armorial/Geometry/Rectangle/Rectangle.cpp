@@ -59,7 +59,7 @@ LineSegment Rectangle::rightLine() const {
     return LineSegment(_topRight, _bottomRight);
 }
 
-std::vector<LineSegment> Rectangle::boundary() const {
+Utils::StaticVector<LineSegment, 4> Rectangle::boundary() const {
     return {leftLine(), topLine(), rightLine(), bottomLine()};
 }
 
@@ -0,0 +1,27 @@
+#include <Armorial/Geometry/Rotation2D/Rotation2D.h>
+#include <Armorial/Geometry/Batch/Batch.h>
+
+#include <limits>
+
+using namespace Geometry;
+
+Rotation2D Rotation2D::fromDirection(const Vector2D &direction) {
+    const float length = direction.length();
+    if(length <= std::numeric_limits<float>::min()) {
+        return Rotation2D();
+    }
+
+    return Rotation2D(direction.x() / length, direction.y() / length);
+}
+
+Angle Rotation2D::angle() const {
+    return Angle(std::atan2(_sin, _cos));
+}
+
+Rotation2D Rotation2D::normalized() const {
+    return fromDirection(Vector2D(_cos, _sin));
+}
+
+void Rotation2D::rotate(const Vector2D *vectors, Vector2D *out, size_t count) const {
+    Batch::rotate(vectors, *this, out, count);
+}
@@ -0,0 +1,68 @@
+#include <Armorial/Geometry/SweepAndPrune/SweepAndPrune.h>
+
+#include <algorithm>
+#include <numeric>
+
+using namespace Geometry;
+
+const std::vector<SweepAndPrune::Collision>& SweepAndPrune::update(const std::vector<SweptCircle> &circles, const float &horizon) {
+    const size_t count = circles.size();
+    _collisions.clear();
+    _candidates = 0;
+
+    // Boxes that bound each circle between times 0 and horizon
+    _bounds.resize(count);
+    for(size_t i = 0; i < count; i++) {
+        const Vector2D start = circles[i].circle().center();
+        const Vector2D end = circles[i].at(horizon).center();
+        const float radius = circles[i].circle().radius();
+        _bounds[i] = Bounds{std::min(start.x(), end.x()) - radius, std::max(start.x(), end.x()) + radius,
+                            std::min(start.y(), end.y()) - radius, std::max(start.y(), end.y()) + radius};
+    }
+
+    _order.resize(count);
+    std::iota(_order.begin(), _order.end(), 0);
+    std::sort(_order.begin(), _order.end(), [this](size_t a, size_t b) {
+        return _bounds[a].minX < _bounds[b].minX;
+    });
+
+    // Each box is only tested against the following ones that start before it ends in x
+    for(size_t i = 0; i < count; i++) {
+        const Bounds &current = _bounds[_order[i]];
+        for(size_t j = i + 1; j < count && !(current.maxX < _bounds[_order[j]].minX); j++) {
+            const Bounds &other = _bounds[_order[j]];
+            if(current.maxY < other.minY || other.maxY < current.minY) {
+                continue;
+            }
+
+            _candidates++;
+            const size_t first = std::min(_order[i], _order[j]), second = std::max(_order[i], _order[j]);
+            const std::optional<float> time = circles[first].collisionTime(circles[second], horizon);
+            if(time.has_value()) {
+                _collisions.push_back(Collision{first, second, time.value()});
+            }
+        }
+    }
+
+    std::sort(_collisions.begin(), _collisions.end(), [](const Collision &a, const Collision &b) {
+        return (a.time < b.time) || (!(b.time < a.time) && std::make_pair(a.first, a.second) < std::make_pair(b.first, b.second));
+    });
+
+    return _collisions;
+}
+
+const std::vector<SweepAndPrune::Collision>& SweepAndPrune::collisions() const {
+    return _collisions;
+}
+
+std::optional<SweepAndPrune::Collision> SweepAndPrune::earliest() const {
+    if(_collisions.empty()) {
+        return std::nullopt;
+    }
+
+    return _collisions.front();
+}
+
+size_t SweepAndPrune::candidates() const {
+    return _candidates;
+}
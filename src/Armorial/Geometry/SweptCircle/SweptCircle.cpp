@@ -0,0 +1,49 @@
+#include <Armorial/Geometry/SweptCircle/SweptCircle.h>
+
+#include <Armorial/Utils/Utils.h>
+
+using namespace Geometry;
+
+float SweptCircle::timeOfClosestApproach(const SweptCircle &other) const {
+    const Vector2D relativePosition = other._circle.center() - _circle.center();
+    const Vector2D relativeVelocity = other._velocity - _velocity;
+    const float speed2 = relativeVelocity.dotProduct(relativeVelocity);
+    if(!(speed2 > 0.0f)) {
+        return 0.0f;
+    }
+
+    return -relativePosition.dotProduct(relativeVelocity) / speed2;
+}
+
+float SweptCircle::distanceAt(const SweptCircle &other, const float &time) const {
+    return (other.at(time).center() - at(time).center()).length();
+}
+
+std::optional<float> SweptCircle::collisionTime(const SweptCircle &other, const float &horizon) const {
+    // |p + v t| = r, with p and v the relative position and velocity and r the sum of the radii
+    const Vector2D relativePosition = other._circle.center() - _circle.center();
+    const Vector2D relativeVelocity = other._velocity - _velocity;
+    const float radius = _circle.radius() + other._circle.radius();
+
+    const float a = relativeVelocity.dotProduct(relativeVelocity);
+    const float b = 2.0f * relativePosition.dotProduct(relativeVelocity);
+    const float c = relativePosition.dotProduct(relativePosition) - radius * radius;
+    if(c <= 0.0f) {
+        return 0.0f;
+    }
+    // Not approaching (which includes moving together)
+    if(!(b < 0.0f) || !(a > 0.0f)) {
+        return std::nullopt;
+    }
+
+    const std::optional<std::pair<float, float>> roots = Utils::Algebra::solveQuadratic(a, b, c);
+    if(!roots.has_value() || roots->first > horizon) {
+        return std::nullopt;
+    }
+
+    return roots->first;
+}
+
+std::optional<float> SweptCircle::collisionTime(const Circle &other, const float &horizon) const {
+    return collisionTime(SweptCircle(other, Vector2D(0.0f, 0.0f)), horizon);
+}
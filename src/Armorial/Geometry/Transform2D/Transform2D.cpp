@@ -0,0 +1,8 @@
+#include <Armorial/Geometry/Transform2D/Transform2D.h>
+#include <Armorial/Geometry/Batch/Batch.h>
+
+using namespace Geometry;
+
+void Transform2D::apply(const Vector2D *points, Vector2D *out, size_t count) const {
+    Batch::transform(points, *this, out, count);
+}
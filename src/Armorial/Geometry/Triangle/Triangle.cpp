@@ -12,7 +12,7 @@ Triangle::Triangle(const Vector2D &p1, const Vector2D &p2, const Vector2D &p3) {
     _p3 = p3;
 }
 
-std::vector<Vector2D> Triangle::corners() const {
+Utils::StaticVector<Vector2D, 3> Triangle::corners() const {
     return { _p1, _p2, _p3 };
 }
 
@@ -39,12 +39,12 @@ float Triangle::area() const {
     return (cross_prod / 2.0f);
 }
 
-std::vector<LineSegment> Triangle::boundary() const {
+Utils::StaticVector<LineSegment, 3> Triangle::boundary() const {
     return { LineSegment(_p1, _p2), LineSegment(_p2, _p3), LineSegment(_p3, _p1) };
 }
 
 bool Triangle::doesIntersect(const LineSegment &lineSegment) const {
-    std::vector<LineSegment> triangleBoundary = boundary();
+    const Utils::StaticVector<LineSegment, 3> triangleBoundary = boundary();
     bool intersect = false;
     for(auto &ls : triangleBoundary) {
         intersect |= lineSegment.doesIntersect(ls);
@@ -53,9 +53,9 @@ bool Triangle::doesIntersect(const LineSegment &lineSegment) const {
     return intersect;
 }
 
-std::vector<Vector2D> Triangle::intersect(const LineSegment &lineSegment) const {
-    std::vector<Vector2D> intersections;
-    std::vector<LineSegment> triangleBoundary = boundary();
+Utils::StaticVector<Vector2D, 3> Triangle::intersect(const LineSegment &lineSegment) const {
+    Utils::StaticVector<Vector2D, 3> intersections;
+    const Utils::StaticVector<LineSegment, 3> triangleBoundary = boundary();
     for (const auto &triangleLine : triangleBoundary) {
         std::optional<Vector2D> intersection = lineSegment.intersects(triangleLine);
         if (intersection.has_value()) {
@@ -63,7 +63,12 @@ std::vector<Vector2D> Triangle::intersect(const LineSegment &lineSegment) const
         }
     }
 
-    std::sort(intersections.begin(), intersections.end());
+    // Insertion sort, as there are at most three points
+    for(size_t i = 1; i < intersections.size(); i++) {
+        for(size_t j = i; j > 0 && intersections[j] < intersections[j - 1]; j--) {
+            std::swap(intersections[j], intersections[j - 1]);
+        }
+    }
     intersections.erase(std::unique(intersections.begin(), intersections.end()), intersections.end());
 
     return intersections;
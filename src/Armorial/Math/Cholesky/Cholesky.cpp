@@ -0,0 +1,119 @@
+#include <Armorial/Math/Cholesky/Cholesky.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <assert.h>
+
+using namespace Math;
+
+Cholesky::Cholesky(const Matrix &matrix) : Cholesky(MatrixView(matrix)) {
+}
+
+Cholesky::Cholesky(const MatrixView &matrix) {
+    assert(matrix.lines() == matrix.columns());
+    _size = matrix.lines();
+    _positiveDefinite = true;
+
+    _l.assign(size_t(_size) * _size, 0.0);
+
+    // The input has float precision, so pivots below its rounding error are taken as zero. That error
+    // is measured against the original diagonal element, so scaling a variable (e.g. a covariance
+    // mixing millimetres and radians) does not make the matrix indefinite
+    const double epsilon = _size * std::numeric_limits<float>::epsilon();
+
+    for(unsigned j = 0; j < _size && _positiveDefinite; j++) {
+        double *lineJ = &_l[j * _size];
+        double diagonal = matrix.get(j, j);
+        for(unsigned k = 0; k < j; k++) {
+            diagonal -= lineJ[k] * lineJ[k];
+        }
+
+        if(diagonal <= epsilon * std::fabs(double(matrix.get(j, j)))) {
+            _positiveDefinite = false;
+            break;
+        }
+        lineJ[j] = std::sqrt(diagonal);
+
+        for(unsigned i = j + 1; i < _size; i++) {
+            double *lineI = &_l[i * _size];
+            double value = matrix.get(i, j);
+            for(unsigned k = 0; k < j; k++) {
+                value -= lineI[k] * lineJ[k];
+            }
+            lineI[j] = value / lineJ[j];
+        }
+    }
+}
+
+float Cholesky::determinant() const {
+    if(!isPositiveDefinite()) {
+        return 0.0f;
+    }
+
+    double det = 1.0;
+    for(unsigned k = 0; k < _size; k++) {
+        det *= _l[k * _size + k];
+    }
+
+    return float(det * det);
+}
+
+void Cholesky::solveInPlace(std::vector<double> &b) const {
+    // Forward substitution with L
+    for(unsigned i = 0; i < _size; i++) {
+        const double *line = &_l[i * _size];
+        for(unsigned j = 0; j < i; j++) {
+            b[i] -= line[j] * b[j];
+        }
+        b[i] /= line[i];
+    }
+
+    // Back substitution with Lᵀ
+    for(unsigned i = _size; i-- > 0;) {
+        for(unsigned j = i + 1; j < _size; j++) {
+            b[i] -= _l[j * _size + i] * b[j];
+        }
+        b[i] /= _l[i * _size + i];
+    }
+}
+
+std::optional<Matrix> Cholesky::solve(const Matrix &B) const {
+    return solve(MatrixView(B));
+}
+
+std::optional<Matrix> Cholesky::solve(const MatrixView &B) const {
+    assert(B.lines() == _size);
+    if(!isPositiveDefinite()) {
+        return std::nullopt;
+    }
+
+    Matrix X(_size, B.columns());
+    std::vector<double> column(_size);
+    for(unsigned j = 0; j < B.columns(); j++) {
+        for(unsigned i = 0; i < _size; i++) {
+            column[i] = B.get(i, j);
+        }
+        solveInPlace(column);
+        for(unsigned i = 0; i < _size; i++) {
+            X.set(i, j, float(column[i]));
+        }
+    }
+
+    return X;
+}
+
+std::optional<Matrix> Cholesky::inverse() const {
+    return solve(Matrix::identity(_size));
+}
+
+Matrix Cholesky::L() const {
+    Matrix L(_size, _size);
+    for(unsigned i = 0; i < _size; i++) {
+        for(unsigned j = 0; j <= i; j++) {
+            L.set(i, j, float(_l[i * _size + j]));
+        }
+    }
+
+    return L;
+}
@@ -0,0 +1,151 @@
+#include <Armorial/Math/LU/LU.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <assert.h>
+
+using namespace Math;
+
+LU::LU(const Matrix &matrix) : LU(MatrixView(matrix)) {
+}
+
+LU::LU(const MatrixView &matrix) {
+    assert(matrix.lines() == matrix.columns());
+    _size = matrix.lines();
+    _sign = 1;
+    _singular = false;
+
+    _lu.resize(size_t(_size) * _size);
+    std::vector<double> lineMax(_size, 0.0), columnMax(_size, 0.0);
+    for(unsigned i = 0; i < _size; i++) {
+        for(unsigned j = 0; j < _size; j++) {
+            _lu[i * _size + j] = matrix.get(i, j);
+            lineMax[i] = std::max(lineMax[i], std::fabs(_lu[i * _size + j]));
+            columnMax[j] = std::max(columnMax[j], std::fabs(_lu[i * _size + j]));
+        }
+    }
+
+    _permutation.resize(_size);
+    std::iota(_permutation.begin(), _permutation.end(), 0u);
+
+    // The input has float precision, so pivots below its rounding error are taken as zero. That error
+    // is measured against the original line and column of the pivot, so scaling a line or a column
+    // (e.g. diag(1e4, 1e-3)) does not make the matrix singular
+    const double epsilon = _size * std::numeric_limits<float>::epsilon();
+
+    for(unsigned k = 0; k < _size; k++) {
+        // Partial pivoting: take the largest element in the column as pivot
+        unsigned pivot = k;
+        for(unsigned i = k + 1; i < _size; i++) {
+            if(std::fabs(_lu[i * _size + k]) > std::fabs(_lu[pivot * _size + k])) {
+                pivot = i;
+            }
+        }
+
+        if(pivot != k) {
+            std::swap_ranges(_lu.begin() + k * _size, _lu.begin() + (k + 1) * _size, _lu.begin() + pivot * _size);
+            std::swap(_permutation[k], _permutation[pivot]);
+            _sign = -_sign;
+        }
+
+        const double diagonal = _lu[k * _size + k];
+        if(std::fabs(diagonal) <= epsilon * std::min(lineMax[_permutation[k]], columnMax[k])) {
+            _singular = true;
+        }
+        // Keep eliminating past negligible pivots, so the determinant stays the product of the pivots
+        if(!(std::fabs(diagonal) > 0.0)) {
+            continue;
+        }
+
+        for(unsigned i = k + 1; i < _size; i++) {
+            double *line = &_lu[i * _size];
+            const double factor = (line[k] /= diagonal);
+            const double *pivotLine = &_lu[k * _size];
+            for(unsigned j = k + 1; j < _size; j++) {
+                line[j] -= factor * pivotLine[j];
+            }
+        }
+    }
+}
+
+float LU::determinant() const {
+    double det = _sign;
+    for(unsigned k = 0; k < _size; k++) {
+        det *= _lu[k * _size + k];
+    }
+
+    return float(det);
+}
+
+void LU::solveInPlace(std::vector<double> &b) const {
+    // Forward substitution with the unit lower triangular L
+    for(unsigned i = 0; i < _size; i++) {
+        const double *line = &_lu[i * _size];
+        for(unsigned j = 0; j < i; j++) {
+            b[i] -= line[j] * b[j];
+        }
+    }
+
+    // Back substitution with U
+    for(unsigned i = _size; i-- > 0;) {
+        const double *line = &_lu[i * _size];
+        for(unsigned j = i + 1; j < _size; j++) {
+            b[i] -= line[j] * b[j];
+        }
+        b[i] /= line[i];
+    }
+}
+
+std::optional<Matrix> LU::solve(const Matrix &B) const {
+    return solve(MatrixView(B));
+}
+
+std::optional<Matrix> LU::solve(const MatrixView &B) const {
+    assert(B.lines() == _size);
+    if(isSingular()) {
+        return std::nullopt;
+    }
+
+    Matrix X(_size, B.columns());
+    std::vector<double> column(_size);
+    for(unsigned j = 0; j < B.columns(); j++) {
+        for(unsigned i = 0; i < _size; i++) {
+            column[i] = B.get(_permutation[i], j);
+        }
+        solveInPlace(column);
+        for(unsigned i = 0; i < _size; i++) {
+            X.set(i, j, float(column[i]));
+        }
+    }
+
+    return X;
+}
+
+std::optional<Matrix> LU::inverse() const {
+    return solve(Matrix::identity(_size));
+}
+
+Matrix LU::L() const {
+    Matrix L(_size, _size);
+    for(unsigned i = 0; i < _size; i++) {
+        for(unsigned j = 0; j < i; j++) {
+            L.set(i, j, float(_lu[i * _size + j]));
+        }
+        L.set(i, i, 1.0f);
+    }
+
+    return L;
+}
+
+Matrix LU::U() const {
+    Matrix U(_size, _size);
+    for(unsigned i = 0; i < _size; i++) {
+        for(unsigned j = i; j < _size; j++) {
+            U.set(i, j, float(_lu[i * _size + j]));
+        }
+    }
+
+    return U;
+}
@@ -1,18 +1,38 @@
 #include <Armorial/Math/Matrix/Matrix.h>
+#include <Armorial/Math/LU/LU.h>
+#include <Armorial/Math/Matrix/impl/gemm_impl.h>
+#include <Armorial/Math/MatrixSlice/MatrixSlice.h>
 
 #include <Armorial/Utils/Utils.h>
 
+#include <algorithm>
 #include <iostream>
+#include <new>
+#include <utility>
 #include <assert.h>
 
 using namespace Math;
 
+namespace {
+    // Products with at least this amount of multiply-adds use the blocked kernel, below it
+    // packing the operands costs more than it saves
+    constexpr size_t GemmThreshold = 16 * 16 * 16;
+
+    constexpr unsigned alignedStride(unsigned columns) {
+        // Round the line size up to a multiple of the alignment
+        constexpr unsigned floatsPerAlignment = Matrix::Alignment / sizeof(float);
+        return ((columns + floatsPerAlignment - 1) / floatsPerAlignment) * floatsPerAlignment;
+    }
+}
+
 Matrix::Matrix(unsigned lines, unsigned columns) {
     _lines = lines;
     _columns = columns;
 
     // Create matrix
-    _matrix = NULL;
+    _stride = 0;
+    _capacity = 0;
+    _data = nullptr;
     allocate();
     initialize();
 }
@@ -22,7 +42,9 @@ Matrix::Matrix(const std::vector<std::vector<float>>& matrix) {
     _columns = (_lines == 0) ? 0 : matrix[0].size();
 
     // Create matrix
-    _matrix = NULL;
+    _stride = 0;
+    _capacity = 0;
+    _data = nullptr;
     allocate();
 
     assert(matrix.size() == lines());
@@ -31,77 +53,173 @@ Matrix::Matrix(const std::vector<std::vector<float>>& matrix) {
     }
 
     for (unsigned i = 0; i < lines(); i++) {
-        for (unsigned j = 0; j < columns(); j++) {
-            _matrix[i][j] = matrix[i][j];
-        }
+        std::copy(matrix[i].begin(), matrix[i].end(), line(i));
     }
 }
 
 Matrix::Matrix(const Matrix &M) {
     // Create matrix by copy
-    _matrix = NULL;
+    _lines = 0;
+    _columns = 0;
+    _stride = 0;
+    _capacity = 0;
+    _data = nullptr;
     copyFrom(M);
 }
 
+Matrix::Matrix(Matrix &&M) noexcept {
+    // Take the buffer of the given matrix
+    _lines = std::exchange(M._lines, 0);
+    _columns = std::exchange(M._columns, 0);
+    _stride = std::exchange(M._stride, 0);
+    _capacity = std::exchange(M._capacity, 0);
+    _data = std::exchange(M._data, nullptr);
+}
+
 Matrix::~Matrix() {
     deallocate();
 }
 
 void Matrix::allocate() {
-    if(lines() != 0 && columns() != 0) {
-        _matrix = new float*[lines()];
-        for(unsigned i = 0; i < lines(); i++) {
-            _matrix[i] = new float[_columns];
-        }
+    _stride = alignedStride(columns());
+    const size_t size = size_t(lines()) * _stride;
+    if(size <= _capacity) {
+        return;
     }
+
+    deallocate();
+    _data = static_cast<float*>(::operator new[](size * sizeof(float), std::align_val_t(Alignment)));
+    _capacity = size;
 }
 
 void Matrix::deallocate() {
-    if(_matrix != NULL) {
-        for(unsigned i = 0; i < lines(); i++) {
-            delete[] _matrix[i];
-        }
-
-        delete[] _matrix;
-        _matrix = NULL;
+    if(_data != nullptr) {
+        ::operator delete[](_data, std::align_val_t(Alignment));
+        _data = nullptr;
+        _capacity = 0;
     }
 }
 
 void Matrix::initialize() {
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            _matrix[i][j] = 0;
-        }
+    if(_data != nullptr) {
+        std::fill(_data, _data + size_t(lines()) * stride(), 0.0f);
     }
 }
 
-void Matrix::setSize(unsigned lines, unsigned columns) {
-    deallocate();
+void Matrix::reshape(unsigned lines, unsigned columns) {
     _lines = lines;
     _columns = columns;
     allocate();
+}
+
+Matrix& Matrix::scratch() {
+    thread_local Matrix scratch;
+    return scratch;
+}
+
+void Matrix::setSize(unsigned lines, unsigned columns) {
+    reshape(lines, columns);
     initialize();
 }
 
+void Matrix::swap(Matrix &M) noexcept {
+    std::swap(_lines, M._lines);
+    std::swap(_columns, M._columns);
+    std::swap(_stride, M._stride);
+    std::swap(_capacity, M._capacity);
+    std::swap(_data, M._data);
+}
+
 float Matrix::get(unsigned i, unsigned j) const {
     assert(i < lines() && j < columns());
-    return _matrix[i][j];
+    return _data[i * _stride + j];
 }
 
 void Matrix::set(unsigned i, unsigned j, float value) {
     assert(i < lines() && j < columns());
-    _matrix[i][j] = value;
+    _data[i * _stride + j] = value;
 }
 
 void Matrix::copyFrom(const Matrix &M) {
-    deallocate();
+    if(this == &M) {
+        return;
+    }
+
     _lines = M.lines();
     _columns = M.columns();
     allocate();
 
     for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            _matrix[i][j] = M.get(i, j);
+        std::copy(M.line(i), M.line(i) + columns(), line(i));
+    }
+}
+
+void Matrix::add(const Matrix &A, const Matrix &B, Matrix &result) {
+    assert(A.lines() == B.lines() && A.columns() == B.columns());
+    if(&result != &A && &result != &B) {
+        result.reshape(A.lines(), A.columns());
+    }
+
+    for(unsigned i = 0; i < A.lines(); i++) {
+        const float *a = A.line(i), *b = B.line(i);
+        float *r = result.line(i);
+        for(unsigned j = 0; j < A.columns(); j++) {
+            r[j] = a[j] + b[j];
+        }
+    }
+}
+
+void Matrix::subtract(const Matrix &A, const Matrix &B, Matrix &result) {
+    assert(A.lines() == B.lines() && A.columns() == B.columns());
+    if(&result != &A && &result != &B) {
+        result.reshape(A.lines(), A.columns());
+    }
+
+    for(unsigned i = 0; i < A.lines(); i++) {
+        const float *a = A.line(i), *b = B.line(i);
+        float *r = result.line(i);
+        for(unsigned j = 0; j < A.columns(); j++) {
+            r[j] = a[j] - b[j];
+        }
+    }
+}
+
+void Matrix::multiply(const Matrix &A, const Matrix &B, Matrix &result) {
+    multiply(MatrixView(A), MatrixView(B), result);
+}
+
+void Matrix::multiply(const MatrixView &A, const MatrixView &B, Matrix &result) {
+    assert(A.columns() == B.lines());
+    assert(!A.references(&result) && !B.references(&result));
+    result.setSize(A.lines(), B.columns());
+
+    if(A.isLineContiguous() && B.isLineContiguous()
+       && size_t(A.lines()) * A.columns() * B.columns() >= GemmThreshold) {
+        impl::gemm(A.lines(), B.columns(), A.columns(), A.data(), A.lineStride(), B.data(), B.lineStride(),
+                   result.data(), result.stride());
+        return;
+    }
+
+    // Small (or strided) products: accumulate A(i, k) * B(k, :) on the result line, which walks
+    // both B and the result contiguously
+    for(unsigned i = 0; i < A.lines(); i++) {
+        float *r = result.line(i);
+        for(unsigned k = 0; k < A.columns(); k++) {
+            B.accumulateLine(k, A.coeff(i, k), r);
+        }
+    }
+}
+
+void Matrix::multiply(const Matrix &A, float k, Matrix &result) {
+    if(&result != &A) {
+        result.reshape(A.lines(), A.columns());
+    }
+
+    for(unsigned i = 0; i < A.lines(); i++) {
+        const float *a = A.line(i);
+        float *r = result.line(i);
+        for(unsigned j = 0; j < A.columns(); j++) {
+            r[j] = a[j] * k;
         }
     }
 }
@@ -109,7 +227,7 @@ void Matrix::copyFrom(const Matrix &M) {
 void Matrix::print() {
     for(unsigned i = 0; i < lines(); i++) {
         for(unsigned j = 0; j < columns(); j++) {
-            std::cout << _matrix[i][j] << " ";
+            std::cout << get(i, j) << " ";
         }
         std::cout << "\n";
     }
@@ -129,60 +247,55 @@ Matrix Matrix::diag(unsigned size, float diagValue) {
     return M;
 }
 
-Matrix Matrix::transposed() const {
-    Matrix temp(columns(), lines());
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            temp.set(j, i, _matrix[i][j]);
-        }
-    }
-
-    return temp;
-}
-
 Matrix Matrix::cofactor(unsigned p, unsigned q) const {
     Matrix cof(lines() - 1, columns() - 1);
 
-    unsigned i = 0, j = 0;
+    // Copy the four blocks around line p and column q
+    const unsigned below = lines() - p - 1, right = columns() - q - 1;
+    cof.block(0, 0, p, q) = block(0, 0, p, q);
+    cof.block(0, q, p, right) = block(0, q + 1, p, right);
+    cof.block(p, 0, below, q) = block(p + 1, 0, below, q);
+    cof.block(p, q, below, right) = block(p + 1, q + 1, below, right);
 
-    for(unsigned row = 0; row < lines(); row++) {
-        for(unsigned col = 0; col < columns(); col++) {
-            if(row != p && col != q) {
-                cof.set(i, j++, get(row, col));
+    return cof;
+}
 
-                if(j == _columns - 1) {
-                    j = 0;
-                    i++;
-                }
-            }
-        }
-    }
+MatrixView Matrix::block(unsigned i, unsigned j, unsigned lines, unsigned columns) const {
+    return MatrixView(*this).block(i, j, lines, columns);
+}
 
-    return cof;
+MatrixSlice Matrix::block(unsigned i, unsigned j, unsigned lines, unsigned columns) {
+    return MatrixSlice(*this).block(i, j, lines, columns);
 }
 
-float Matrix::determinant(Matrix m, unsigned columns) {
-    assert(m.columns() == m.lines());
+MatrixView Matrix::lineBlock(unsigned i) const {
+    return block(i, 0, 1, columns());
+}
 
-    float D = 0;
-    int sign = 1;
+MatrixSlice Matrix::lineBlock(unsigned i) {
+    return block(i, 0, 1, columns());
+}
 
-    // Base case of recursion
-    if(columns == 1) {
-        return m.get(0, 0);
-    }
+MatrixView Matrix::columnBlock(unsigned j) const {
+    return block(0, j, lines(), 1);
+}
 
-    // Iterate over all elements of first row
-    for(unsigned f = 0; f < columns; f++) {
-        Matrix cof = m.cofactor(0, f);
-        D += sign * m.get(0, f) * determinant(cof, columns - 1);
-        sign = -sign;
-    }
+MatrixSlice Matrix::columnBlock(unsigned j) {
+    return block(0, j, lines(), 1);
+}
+
+float Matrix::determinant(const Matrix &m, unsigned columns) {
+    assert(m.columns() == m.lines());
+    assert(columns == m.columns());
 
-    return D;
+    return LU(m).determinant();
 }
 
-Matrix Matrix::adjoint() {
+float Matrix::determinant() const {
+    return determinant(*this, columns());
+}
+
+Matrix Matrix::adjoint() const {
     // Base case
     if(lines() == 1 && columns() == 1) {
         Matrix adj(1, 1);
@@ -204,177 +317,80 @@ Matrix Matrix::adjoint() {
     return adj;
 }
 
-std::optional<Matrix> Matrix::inverse() {
-    // Get determinant
-    Matrix thisMat = (*this);
-    float det = Matrix::determinant(thisMat, thisMat.columns());
-
-    // Check not possible case (det == 0)
-    if(Utils::Compare::isEqual(det, 0.0f)) {
-        return std::nullopt;
-    }
+std::optional<Matrix> Matrix::inverse() const {
+    assert(columns() == lines());
 
-    // Get adjoint
-    Matrix adj = adjoint();
-    Matrix inv(lines(), columns());
+    return LU(*this).inverse();
+}
 
-    // Find inverse
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            inv.set(i, j, adj.get(i, j) / float(det));
-        }
-    }
+std::optional<Matrix> Matrix::solve(const Matrix &B) const {
+    assert(columns() == lines());
 
-    return inv;
+    return LU(*this).solve(B);
 }
 
-void Matrix::operator=(const Matrix &M) {
-    deallocate();
-    _lines = M._lines;
-    _columns = M._columns;
-    allocate();
+Matrix& Matrix::operator=(const Matrix &M) {
     copyFrom(M);
+    return *this;
 }
 
-Matrix Matrix::operator+(const Matrix &M) const {
-    assert(lines() == M.lines() && columns() == M.columns());
-    Matrix temp(lines(), columns());
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            temp.set(i, j, _matrix[i][j] + M.get(i,j));
-        }
-    }
-
-    return temp;
-}
-
-Matrix Matrix::operator-(const Matrix &M) const {
-    assert(lines() == M.lines() && columns() == M.columns());
-    Matrix temp(lines(), columns());
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            temp.set(i, j, _matrix[i][j] - M.get(i,j));
-        }
+Matrix& Matrix::operator=(Matrix &&M) noexcept {
+    if(this != &M) {
+        deallocate();
+        _lines = std::exchange(M._lines, 0);
+        _columns = std::exchange(M._columns, 0);
+        _stride = std::exchange(M._stride, 0);
+        _capacity = std::exchange(M._capacity, 0);
+        _data = std::exchange(M._data, nullptr);
     }
 
-    return temp;
+    return *this;
 }
 
-Matrix Matrix::operator+(float k) const {
-    Matrix temp(lines(), columns());
+void Matrix::operator+=(float k) {
     for(unsigned i = 0; i < lines(); i++) {
+        float *l = line(i);
         for(unsigned j = 0; j < columns(); j++) {
-            temp.set(i, j, _matrix[i][j] + k);
+            l[j] += k;
         }
     }
-
-    return temp;
 }
 
-Matrix Matrix::operator-(float k) const {
-    return (*this)+(-k);
-}
-
-Matrix Matrix::operator*(const Matrix &M) const {
-    assert(columns()==M.lines());
-    Matrix temp(lines(), M.columns());
-
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < M.columns(); j++) {
-            temp.set(i, j, 0);
-            for(unsigned k = 0; k < M.lines(); k++) {
-                temp.set(i, j, temp.get(i,j) + _matrix[i][k] * M.get(k,j));
-            }
-        }
-    }
-
-    return temp;
+void Matrix::operator-=(float k) {
+    (*this) += (-k);
 }
 
-Matrix Matrix::operator*(float k) const {
-    Matrix temp(lines(), columns());
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            temp.set(i, j, _matrix[i][j] * k);
-        }
-    }
-
-    return temp;
+void Matrix::operator*=(float k) {
+    multiply(*this, k, *this);
 }
 
-Matrix Matrix::operator/(float k) const {
+void Matrix::operator/=(float k) {
     assert(!Utils::Compare::isEqual(k, 0.0f));
 
-    Matrix temp(lines(), columns());
     for(unsigned i = 0; i < lines(); i++) {
+        float *l = line(i);
         for(unsigned j = 0; j < columns(); j++) {
-            temp.set(i, j, _matrix[i][j] / k);
+            l[j] /= k;
         }
     }
-
-    return temp;
 }
 
-void Matrix::operator+=(const Matrix &M) {
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            _matrix[i][j] += M.get(i,j);
-        }
-    }
-}
-
-void Matrix::operator+=(float k) {
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            _matrix[i][j] += k;
-        }
-    }
-}
-
-void Matrix::operator-=(const Matrix &M) {
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            _matrix[i][j] -= M.get(i,j);
-        }
-    }
-}
-
-bool Matrix::operator==(const Matrix &M) {
-    assert(columns() == M.columns());
-    assert(lines() == M.lines());
-
-    bool eq = true;
-    for(unsigned i = 0; i < lines() && eq; i++) {
-        for(unsigned j = 0; j < columns() && eq; j++) {
-            eq = Utils::Compare::isEqual(this->get(i, j), M.get(i, j));
-        }
-    }
-
-    return eq;
+Matrix Math::operator+(Matrix &&M, float k) {
+    M += k;
+    return std::move(M);
 }
 
-void Matrix::operator-=(float k) {
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            _matrix[i][j] -= k;
-        }
-    }
+Matrix Math::operator-(Matrix &&M, float k) {
+    M -= k;
+    return std::move(M);
 }
 
-void Matrix::operator*=(float k) {
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j = 0; j < columns(); j++) {
-            _matrix[i][j] *= k;
-        }
-    }
+Matrix Math::operator*(Matrix &&M, float k) {
+    M *= k;
+    return std::move(M);
 }
 
-void Matrix::operator/=(float k) {
-    assert(!Utils::Compare::isEqual(k, 0.0f));
-
-    for(unsigned i = 0; i < lines(); i++) {
-        for(unsigned j =0; j < columns(); j++) {
-            _matrix[i][j] /= k;
-        }
-    }
+Matrix Math::operator/(Matrix &&M, float k) {
+    M /= k;
+    return std::move(M);
 }
@@ -0,0 +1,258 @@
+#include <Armorial/Math/Matrix/impl/gemm_impl.h>
+
+#include <Armorial/Utils/Utils.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ARMORIAL_GEMM_X86
+#endif
+
+using namespace Math::impl;
+
+namespace {
+    // Cache blocking: a KC x NC block of B is packed to stay in L2/L3, and each MC x KC block
+    // of A is packed to stay in L2 while the micro-kernel sweeps the B block
+    constexpr unsigned KC = 256;
+    constexpr unsigned MC = 96;
+    constexpr unsigned NC = 512;
+
+    // Products with at least this amount of multiply-adds are split across threads
+    constexpr unsigned long long ParallelThreshold = 1ull << 22;
+
+    /*!
+     * \brief The micro-kernels compute C += a * b for a MR x NR tile of C, where a is a packed
+     * MR x kc panel of A (column by column) and b is a packed kc x NR panel of B (line by line).
+     */
+    template <unsigned MR, unsigned NR>
+    void scalarKernel(unsigned kc, const float *a, const float *b, float *c, unsigned ldc) {
+        float acc[MR][NR] = {};
+        for(unsigned p = 0; p < kc; p++, a += MR, b += NR) {
+            for(unsigned r = 0; r < MR; r++) {
+                for(unsigned j = 0; j < NR; j++) {
+                    acc[r][j] += a[r] * b[j];
+                }
+            }
+        }
+        for(unsigned r = 0; r < MR; r++) {
+            for(unsigned j = 0; j < NR; j++) {
+                c[r * ldc + j] += acc[r][j];
+            }
+        }
+    }
+
+#ifdef ARMORIAL_GEMM_X86
+    __attribute__((target("sse2")))
+    void sseKernel(unsigned kc, const float *a, const float *b, float *c, unsigned ldc) {
+        __m128 acc[4][2];
+        for(unsigned r = 0; r < 4; r++) {
+            acc[r][0] = _mm_setzero_ps();
+            acc[r][1] = _mm_setzero_ps();
+        }
+        for(unsigned p = 0; p < kc; p++, a += 4, b += 8) {
+            const __m128 b0 = _mm_loadu_ps(b);
+            const __m128 b1 = _mm_loadu_ps(b + 4);
+            for(unsigned r = 0; r < 4; r++) {
+                const __m128 ar = _mm_set1_ps(a[r]);
+                acc[r][0] = _mm_add_ps(acc[r][0], _mm_mul_ps(ar, b0));
+                acc[r][1] = _mm_add_ps(acc[r][1], _mm_mul_ps(ar, b1));
+            }
+        }
+        for(unsigned r = 0; r < 4; r++) {
+            float *line = c + r * ldc;
+            _mm_storeu_ps(line, _mm_add_ps(_mm_loadu_ps(line), acc[r][0]));
+            _mm_storeu_ps(line + 4, _mm_add_ps(_mm_loadu_ps(line + 4), acc[r][1]));
+        }
+    }
+
+    __attribute__((target("avx2,fma")))
+    void avx2Kernel(unsigned kc, const float *a, const float *b, float *c, unsigned ldc) {
+        __m256 acc[6][2];
+        for(unsigned r = 0; r < 6; r++) {
+            acc[r][0] = _mm256_setzero_ps();
+            acc[r][1] = _mm256_setzero_ps();
+        }
+        for(unsigned p = 0; p < kc; p++, a += 6, b += 16) {
+            const __m256 b0 = _mm256_loadu_ps(b);
+            const __m256 b1 = _mm256_loadu_ps(b + 8);
+            for(unsigned r = 0; r < 6; r++) {
+                const __m256 ar = _mm256_broadcast_ss(a + r);
+                acc[r][0] = _mm256_fmadd_ps(ar, b0, acc[r][0]);
+                acc[r][1] = _mm256_fmadd_ps(ar, b1, acc[r][1]);
+            }
+        }
+        for(unsigned r = 0; r < 6; r++) {
+            float *line = c + r * ldc;
+            _mm256_storeu_ps(line, _mm256_add_ps(_mm256_loadu_ps(line), acc[r][0]));
+            _mm256_storeu_ps(line + 8, _mm256_add_ps(_mm256_loadu_ps(line + 8), acc[r][1]));
+        }
+    }
+#endif
+
+    using Kernel = void (*)(unsigned, const float*, const float*, float*, unsigned);
+
+    /*!
+     * \brief Blocked product for a given micro-kernel of MR x NR elements.
+     */
+    template <unsigned MR, unsigned NR>
+    void blockedGemm(Kernel kernel, unsigned m, unsigned n, unsigned k,
+                     const float *A, unsigned lda, const float *B, unsigned ldb, float *C, unsigned ldc) {
+        static_assert(MC % MR == 0, "MC should be a multiple of MR");
+
+        thread_local std::vector<float> packedA, packedB;
+        packedA.resize(MC * KC);
+        packedB.resize(KC * ((NC + NR - 1) / NR) * NR);
+
+        for(unsigned jc = 0; jc < n; jc += NC) {
+            const unsigned nc = std::min(NC, n - jc);
+            for(unsigned pc = 0; pc < k; pc += KC) {
+                const unsigned kc = std::min(KC, k - pc);
+
+                // Pack B[pc:pc+kc, jc:jc+nc] in panels of NR columns, padded with zeros
+                for(unsigned j0 = 0; j0 < nc; j0 += NR) {
+                    float *panel = packedB.data() + j0 * kc;
+                    const unsigned width = std::min(NR, nc - j0);
+                    for(unsigned p = 0; p < kc; p++) {
+                        const float *line = B + (pc + p) * ldb + jc + j0;
+                        unsigned j = 0;
+                        for(; j < width; j++) {
+                            panel[p * NR + j] = line[j];
+                        }
+                        for(; j < NR; j++) {
+                            panel[p * NR + j] = 0.0f;
+                        }
+                    }
+                }
+
+                for(unsigned ic = 0; ic < m; ic += MC) {
+                    const unsigned mc = std::min(MC, m - ic);
+
+                    // Pack A[ic:ic+mc, pc:pc+kc] in panels of MR lines, padded with zeros
+                    for(unsigned i0 = 0; i0 < mc; i0 += MR) {
+                        float *panel = packedA.data() + i0 * kc;
+                        const unsigned height = std::min(MR, mc - i0);
+                        for(unsigned r = 0; r < MR; r++) {
+                            if(r < height) {
+                                const float *line = A + (ic + i0 + r) * lda + pc;
+                                for(unsigned p = 0; p < kc; p++) {
+                                    panel[p * MR + r] = line[p];
+                                }
+                            } else {
+                                for(unsigned p = 0; p < kc; p++) {
+                                    panel[p * MR + r] = 0.0f;
+                                }
+                            }
+                        }
+                    }
+
+                    // Sweep the tiles of C with the micro-kernel
+                    for(unsigned j0 = 0; j0 < nc; j0 += NR) {
+                        const unsigned width = std::min(NR, nc - j0);
+                        for(unsigned i0 = 0; i0 < mc; i0 += MR) {
+                            const unsigned height = std::min(MR, mc - i0);
+                            float *tile = C + (ic + i0) * ldc + jc + j0;
+                            const float *a = packedA.data() + i0 * kc;
+                            const float *b = packedB.data() + j0 * kc;
+                            if(height == MR && width == NR) {
+                                kernel(kc, a, b, tile, ldc);
+                            } else {
+                                // Partial tile on the border of C
+                                float edge[MR * NR] = {};
+                                kernel(kc, a, b, edge, NR);
+                                for(unsigned r = 0; r < height; r++) {
+                                    for(unsigned j = 0; j < width; j++) {
+                                        tile[r * ldc + j] += edge[r * NR + j];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void singleThreadGemm(GemmKernel kernel, unsigned m, unsigned n, unsigned k,
+                          const float *A, unsigned lda, const float *B, unsigned ldb, float *C, unsigned ldc) {
+        switch(kernel) {
+#ifdef ARMORIAL_GEMM_X86
+            case GemmKernel::AVX2:
+                blockedGemm<6, 16>(avx2Kernel, m, n, k, A, lda, B, ldb, C, ldc);
+                return;
+            case GemmKernel::SSE:
+                blockedGemm<4, 8>(sseKernel, m, n, k, A, lda, B, ldb, C, ldc);
+                return;
+#endif
+            default:
+                blockedGemm<4, 4>(scalarKernel<4, 4>, m, n, k, A, lda, B, ldb, C, ldc);
+                return;
+        }
+    }
+}
+
+GemmKernel Math::impl::bestGemmKernel() {
+    static const GemmKernel best = Utils::CPU::hasAVX2() ? GemmKernel::AVX2
+                                 : Utils::CPU::hasSSE2() ? GemmKernel::SSE
+                                 : GemmKernel::Scalar;
+    return best;
+}
+
+bool Math::impl::isGemmKernelSupported(GemmKernel kernel) {
+    switch(kernel) {
+        case GemmKernel::AVX2:
+            return Utils::CPU::hasAVX2();
+        case GemmKernel::SSE:
+            return Utils::CPU::hasSSE2();
+        default:
+            return true;
+    }
+}
+
+void Math::impl::gemm(unsigned m, unsigned n, unsigned k,
+                      const float *A, unsigned lda,
+                      const float *B, unsigned ldb,
+                      float *C, unsigned ldc,
+                      unsigned threads, GemmKernel kernel) {
+    if(m == 0 || n == 0 || k == 0) {
+        return;
+    }
+
+    if(static_cast<unsigned long long>(m) * n * k < ParallelThreshold) {
+        threads = 1;
+    } else if(threads == 0) {
+        static const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        threads = hardwareThreads;
+    }
+    // Each thread takes whole MC blocks of lines of C
+    threads = std::min(threads, (m + MC - 1) / MC);
+
+    if(threads <= 1) {
+        singleThreadGemm(kernel, m, n, k, A, lda, B, ldb, C, ldc);
+        return;
+    }
+
+    const unsigned blocks = (m + MC - 1) / MC;
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for(unsigned t = 0; t < threads; t++) {
+        const unsigned begin = std::min(m, (blocks * t / threads) * MC);
+        const unsigned end = std::min(m, (blocks * (t + 1) / threads) * MC);
+        if(begin >= end) {
+            continue;
+        }
+        auto work = [=]() {
+            singleThreadGemm(kernel, end - begin, n, k, A + begin * lda, lda, B, ldb, C + begin * ldc, ldc);
+        };
+        if(t + 1 == threads) {
+            work();
+        } else {
+            workers.emplace_back(work);
+        }
+    }
+    for(auto &worker : workers) {
+        worker.join();
+    }
+}
@@ -0,0 +1,92 @@
+#include <Armorial/Math/PolynomialFit/PolynomialFit.h>
+
+#include <algorithm>
+#include <cmath>
+#include <assert.h>
+
+using namespace Math;
+
+namespace {
+    /*!
+     * \return The center and half-width of the range of the given positions.
+     */
+    std::pair<double, double> rangeOf(const std::vector<float> &x) {
+        if(x.empty()) {
+            return {0.0, 1.0};
+        }
+        const auto [low, high] = std::minmax_element(x.begin(), x.end());
+        const double halfWidth = (double(*high) - double(*low)) / 2.0;
+        return {(double(*high) + double(*low)) / 2.0, (halfWidth > 0.0) ? halfWidth : 1.0};
+    }
+
+    /*!
+     * \return The Vandermonde matrix of the normalized positions (x - center) / scale.
+     */
+    Matrix vandermonde(const std::vector<float> &x, unsigned degree, std::pair<double, double> normalization) {
+        Matrix V(x.size(), degree + 1);
+        for(unsigned i = 0; i < x.size(); i++) {
+            const double t = (x[i] - normalization.first) / normalization.second;
+            double power = 1.0;
+            float *line = V.line(i);
+            for(unsigned k = 0; k <= degree; k++) {
+                line[k] = float(power);
+                power *= t;
+            }
+        }
+
+        return V;
+    }
+}
+
+PolynomialFit::PolynomialFit(const std::vector<float> &x, unsigned degree)
+    : PolynomialFit(x, degree, rangeOf(x)) {
+}
+
+PolynomialFit::PolynomialFit(const std::vector<float> &x, unsigned degree, std::pair<double, double> normalization)
+    : _degree(degree), _samples(x.size()), _center(normalization.first), _scale(normalization.second),
+      _qr(vandermonde(x, degree, normalization)) {
+    assert(x.size() > degree);
+}
+
+std::optional<PolynomialFit::Polynomial> PolynomialFit::fit(const std::vector<float> &y) const {
+    assert(y.size() == _samples);
+    std::optional<std::vector<Polynomial>> polynomials = fit(MatrixView(y.data(), _samples, 1, 1));
+    if(!polynomials.has_value()) {
+        return std::nullopt;
+    }
+
+    return std::move(polynomials->front());
+}
+
+std::optional<std::vector<PolynomialFit::Polynomial>> PolynomialFit::fit(const MatrixView &Y) const {
+    assert(Y.lines() == _samples);
+    const std::optional<Matrix> normalized = _qr.solve(Y);
+    if(!normalized.has_value()) {
+        return std::nullopt;
+    }
+
+    // d[k] * ((x - c) / s)^k = (d[k] / s^k) * (x - c)^k, which only rescales the coefficients
+    std::vector<Polynomial> polynomials;
+    polynomials.reserve(Y.columns());
+    for(unsigned j = 0; j < Y.columns(); j++) {
+        std::vector<double> coefficients(_degree + 1);
+        double power = 1.0;
+        for(unsigned k = 0; k <= _degree; k++) {
+            coefficients[k] = normalized->get(k, j) / power;
+            power *= _scale;
+        }
+        polynomials.emplace_back(_center, std::move(coefficients));
+    }
+
+    return polynomials;
+}
+
+float PolynomialFit::Polynomial::evaluate(float x) const {
+    const double t = double(x) - _center;
+    double value = 0.0;
+    for(size_t k = _coefficients.size(); k-- > 0;) {
+        value = value * t + _coefficients[k];
+    }
+
+    return float(value);
+}
@@ -0,0 +1,171 @@
+#include <Armorial/Math/QR/QR.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <assert.h>
+
+using namespace Math;
+
+QR::QR(const Matrix &matrix) : QR(MatrixView(matrix)) {
+}
+
+QR::QR(const MatrixView &matrix) {
+    assert(matrix.lines() >= matrix.columns());
+    _lines = matrix.lines();
+    _columns = matrix.columns();
+    _fullRank = true;
+
+    // Columns are stored contiguously, as every reflection works on whole columns
+    _qr.resize(size_t(_lines) * _columns);
+    for(unsigned i = 0; i < _lines; i++) {
+        for(unsigned j = 0; j < _columns; j++) {
+            _qr[size_t(j) * _lines + i] = matrix.get(i, j);
+        }
+    }
+    _tau.assign(_columns, 0.0);
+    _diagonal.assign(_columns, 0.0);
+
+    // Norms of the input columns, which the rank test below is relative to
+    std::vector<double> columnNorm(_columns, 0.0);
+    for(unsigned j = 0; j < _columns; j++) {
+        const double *column = &_qr[size_t(j) * _lines];
+        for(unsigned i = 0; i < _lines; i++) {
+            columnNorm[j] += column[i] * column[i];
+        }
+        columnNorm[j] = std::sqrt(columnNorm[j]);
+    }
+
+    for(unsigned k = 0; k < _columns; k++) {
+        double *v = &_qr[size_t(k) * _lines];
+
+        double norm = 0.0;
+        for(unsigned i = k; i < _lines; i++) {
+            norm += v[i] * v[i];
+        }
+        norm = std::sqrt(norm);
+        if(norm <= 0.0) {
+            _fullRank = false;
+            continue;
+        }
+
+        // Reflect the column onto -sign(v[k]) * |v| * e_k, which avoids cancellation
+        const double alpha = (v[k] > 0.0) ? -norm : norm;
+        _diagonal[k] = alpha;
+
+        // v = x - alpha * e_k, where |v|² = 2 * |x| * (|x| + |x_k|)
+        const double vv = 2.0 * norm * (norm + std::fabs(v[k]));
+        v[k] -= alpha;
+        _tau[k] = 2.0 / vv;
+
+        for(unsigned j = k + 1; j < _columns; j++) {
+            double *column = &_qr[size_t(j) * _lines];
+            double dot = 0.0;
+            for(unsigned i = k; i < _lines; i++) {
+                dot += v[i] * column[i];
+            }
+            const double s = _tau[k] * dot;
+            for(unsigned i = k; i < _lines; i++) {
+                column[i] -= s * v[i];
+            }
+        }
+    }
+
+    // |R(k, k)| is the distance of the k-th column to the span of the previous ones. The input has
+    // float precision, so a column is taken as dependent when that distance is below its own
+    // rounding error, which grows with the number of columns it is reflected against but not with
+    // the number of lines (the norms already account for them)
+    const double epsilon = _columns * std::numeric_limits<float>::epsilon();
+    for(unsigned k = 0; k < _columns; k++) {
+        if(std::fabs(_diagonal[k]) <= epsilon * columnNorm[k]) {
+            _fullRank = false;
+        }
+    }
+}
+
+void QR::applyTransposedQ(std::vector<double> &b) const {
+    for(unsigned k = 0; k < _columns; k++) {
+        const double *v = &_qr[size_t(k) * _lines];
+        double dot = 0.0;
+        for(unsigned i = k; i < _lines; i++) {
+            dot += v[i] * b[i];
+        }
+        const double s = _tau[k] * dot;
+        for(unsigned i = k; i < _lines; i++) {
+            b[i] -= s * v[i];
+        }
+    }
+}
+
+void QR::solveR(std::vector<double> &b) const {
+    for(unsigned i = _columns; i-- > 0;) {
+        for(unsigned j = i + 1; j < _columns; j++) {
+            b[i] -= _qr[size_t(j) * _lines + i] * b[j];
+        }
+        b[i] /= _diagonal[i];
+    }
+}
+
+std::optional<Matrix> QR::solve(const Matrix &B) const {
+    return solve(MatrixView(B));
+}
+
+std::optional<Matrix> QR::solve(const MatrixView &B) const {
+    assert(B.lines() == _lines);
+    if(!isFullRank()) {
+        return std::nullopt;
+    }
+
+    Matrix X(_columns, B.columns());
+    std::vector<double> column(_lines);
+    for(unsigned j = 0; j < B.columns(); j++) {
+        for(unsigned i = 0; i < _lines; i++) {
+            column[i] = B.get(i, j);
+        }
+        applyTransposedQ(column);
+        solveR(column);
+        for(unsigned i = 0; i < _columns; i++) {
+            X.set(i, j, float(column[i]));
+        }
+    }
+
+    return X;
+}
+
+Matrix QR::Q() const {
+    Matrix Q(_lines, _columns);
+    std::vector<double> column(_lines);
+    for(unsigned j = 0; j < _columns; j++) {
+        // Q * e_j, applying the reflections in reverse order
+        std::fill(column.begin(), column.end(), 0.0);
+        column[j] = 1.0;
+        for(unsigned k = _columns; k-- > 0;) {
+            const double *v = &_qr[size_t(k) * _lines];
+            double dot = 0.0;
+            for(unsigned i = k; i < _lines; i++) {
+                dot += v[i] * column[i];
+            }
+            const double s = _tau[k] * dot;
+            for(unsigned i = k; i < _lines; i++) {
+                column[i] -= s * v[i];
+            }
+        }
+        for(unsigned i = 0; i < _lines; i++) {
+            Q.set(i, j, float(column[i]));
+        }
+    }
+
+    return Q;
+}
+
+Matrix QR::R() const {
+    Matrix R(_columns, _columns);
+    for(unsigned i = 0; i < _columns; i++) {
+        R.set(i, i, float(_diagonal[i]));
+        for(unsigned j = i + 1; j < _columns; j++) {
+            R.set(i, j, float(_qr[size_t(j) * _lines + i]));
+        }
+    }
+
+    return R;
+}
@@ -0,0 +1,201 @@
+#include <Armorial/Math/SVD/SVD.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <assert.h>
+
+using namespace Math;
+
+namespace {
+    // Sweeps over all column pairs until they are orthogonal; a few are enough in practice
+    constexpr unsigned MaxSweeps = 60;
+}
+
+SVD::SVD(const Matrix &matrix) : SVD(MatrixView(matrix)) {
+}
+
+SVD::SVD(const MatrixView &matrix) {
+    _lines = matrix.lines();
+    _columns = matrix.columns();
+
+    // Decompose the transpose of wide matrixes, so that the working matrix W (m x n) has m >= n
+    const bool transposed = (_lines < _columns);
+    const MatrixView A = transposed ? matrix.transposed() : matrix;
+    const unsigned m = A.lines(), n = A.columns();
+    _size = n;
+
+    // One-sided Jacobi: rotate pairs of columns of W = A * V until all of them are orthogonal,
+    // which makes W = U * S
+    std::vector<double> W(size_t(m) * n), V(size_t(n) * n, 0.0);
+    for(unsigned j = 0; j < n; j++) {
+        for(unsigned i = 0; i < m; i++) {
+            W[size_t(j) * m + i] = A.get(i, j);
+        }
+        V[size_t(j) * n + j] = 1.0;
+    }
+
+    const double epsilon = std::numeric_limits<double>::epsilon();
+    for(unsigned sweep = 0; sweep < MaxSweeps; sweep++) {
+        bool rotated = false;
+        for(unsigned p = 0; p + 1 < n; p++) {
+            double *wp = &W[size_t(p) * m];
+            for(unsigned q = p + 1; q < n; q++) {
+                double *wq = &W[size_t(q) * m];
+                double alpha = 0.0, beta = 0.0, gamma = 0.0;
+                for(unsigned i = 0; i < m; i++) {
+                    alpha += wp[i] * wp[i];
+                    beta += wq[i] * wq[i];
+                    gamma += wp[i] * wq[i];
+                }
+                if(std::fabs(gamma) <= epsilon * std::sqrt(alpha * beta)) {
+                    continue;
+                }
+                rotated = true;
+
+                // Rotation which zeroes the (p, q) element of Wᵀ * W
+                const double zeta = (beta - alpha) / (2.0 * gamma);
+                const double t = std::copysign(1.0, zeta) / (std::fabs(zeta) + std::sqrt(1.0 + zeta * zeta));
+                const double c = 1.0 / std::sqrt(1.0 + t * t);
+                const double s = c * t;
+                for(unsigned i = 0; i < m; i++) {
+                    const double x = wp[i], y = wq[i];
+                    wp[i] = c * x - s * y;
+                    wq[i] = s * x + c * y;
+                }
+                double *vp = &V[size_t(p) * n], *vq = &V[size_t(q) * n];
+                for(unsigned i = 0; i < n; i++) {
+                    const double x = vp[i], y = vq[i];
+                    vp[i] = c * x - s * y;
+                    vq[i] = s * x + c * y;
+                }
+            }
+        }
+        if(!rotated) {
+            break;
+        }
+    }
+
+    // The singular values are the norms of the columns of W, and U its normalized columns
+    std::vector<double> sigma(n);
+    for(unsigned j = 0; j < n; j++) {
+        double norm = 0.0;
+        for(unsigned i = 0; i < m; i++) {
+            norm += W[size_t(j) * m + i] * W[size_t(j) * m + i];
+        }
+        sigma[j] = std::sqrt(norm);
+        if(sigma[j] > 0.0) {
+            for(unsigned i = 0; i < m; i++) {
+                W[size_t(j) * m + i] /= sigma[j];
+            }
+        }
+    }
+
+    std::vector<unsigned> order(n);
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&sigma](unsigned a, unsigned b) { return sigma[a] > sigma[b]; });
+
+    // For a transposed decomposition, Aᵀ = U * S * Vᵀ means A = V * S * Uᵀ
+    const unsigned uLines = transposed ? n : m, vLines = transposed ? m : n;
+    const std::vector<double> &left = transposed ? V : W, &right = transposed ? W : V;
+    _u.resize(size_t(uLines) * n);
+    _v.resize(size_t(vLines) * n);
+    _sigma.resize(n);
+    for(unsigned k = 0; k < n; k++) {
+        const unsigned j = order[k];
+        _sigma[k] = sigma[j];
+        std::copy_n(&left[size_t(j) * uLines], uLines, &_u[size_t(k) * uLines]);
+        std::copy_n(&right[size_t(j) * vLines], vLines, &_v[size_t(k) * vLines]);
+    }
+}
+
+std::vector<float> SVD::singularValues() const {
+    return std::vector<float>(_sigma.begin(), _sigma.end());
+}
+
+double SVD::tolerance() const {
+    // The input has float precision, so singular values below its rounding error are taken as zero
+    const double largest = _sigma.empty() ? 0.0 : _sigma[0];
+    return largest * std::max(_lines, _columns) * std::numeric_limits<float>::epsilon();
+}
+
+unsigned SVD::rank() const {
+    const double threshold = tolerance();
+    unsigned rank = 0;
+    while(rank < _size && _sigma[rank] > threshold) {
+        rank++;
+    }
+
+    return rank;
+}
+
+float SVD::conditionNumber() const {
+    if(_size == 0 || rank() < _size) {
+        return std::numeric_limits<float>::infinity();
+    }
+
+    return float(_sigma[0] / _sigma[_size - 1]);
+}
+
+Matrix SVD::U() const {
+    Matrix U(_lines, _size);
+    for(unsigned j = 0; j < _size; j++) {
+        for(unsigned i = 0; i < _lines; i++) {
+            U.set(i, j, float(_u[size_t(j) * _lines + i]));
+        }
+    }
+
+    return U;
+}
+
+Matrix SVD::V() const {
+    Matrix V(_columns, _size);
+    for(unsigned j = 0; j < _size; j++) {
+        for(unsigned i = 0; i < _columns; i++) {
+            V.set(i, j, float(_v[size_t(j) * _columns + i]));
+        }
+    }
+
+    return V;
+}
+
+Matrix SVD::solve(const Matrix &B) const {
+    return solve(MatrixView(B));
+}
+
+Matrix SVD::solve(const MatrixView &B) const {
+    assert(B.lines() == _lines);
+
+    // X = V * S⁺ * Uᵀ * B, over the singular values above the tolerance
+    const unsigned r = rank();
+    Matrix X(_columns, B.columns());
+    std::vector<double> b(_lines), x(_columns);
+    for(unsigned c = 0; c < B.columns(); c++) {
+        for(unsigned i = 0; i < _lines; i++) {
+            b[i] = B.get(i, c);
+        }
+        std::fill(x.begin(), x.end(), 0.0);
+        for(unsigned k = 0; k < r; k++) {
+            const double *u = &_u[size_t(k) * _lines];
+            double dot = 0.0;
+            for(unsigned i = 0; i < _lines; i++) {
+                dot += u[i] * b[i];
+            }
+            const double coefficient = dot / _sigma[k];
+            const double *v = &_v[size_t(k) * _columns];
+            for(unsigned i = 0; i < _columns; i++) {
+                x[i] += coefficient * v[i];
+            }
+        }
+        for(unsigned i = 0; i < _columns; i++) {
+            X.set(i, c, float(x[i]));
+        }
+    }
+
+    return X;
+}
+
+Matrix SVD::pseudoInverse() const {
+    return solve(Matrix::identity(_lines));
+}
@@ -0,0 +1,265 @@
+#include <Armorial/Planning/PathPlanner/PathPlanner.h>
+#include <Armorial/Common/Types/Field/Field.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Planning;
+
+namespace {
+    constexpr size_t NONE = std::numeric_limits<size_t>::max();
+    // Obstacles swept along their velocity are covered by circles at most this fraction of their radius apart
+    constexpr float SWEEP_SPACING = 0.5f;
+    constexpr size_t MAX_SWEEP_CIRCLES = 8;
+}
+
+PathPlanner::PathPlanner(const Common::Types::Field &field, const PlannerSettings &settings) : _settings(settings), _generator(settings.seed) {
+    _minX = field.minX() - settings.fieldMargin;
+    _maxX = field.maxX() + settings.fieldMargin;
+    _minY = field.minY() - settings.fieldMargin;
+    _maxY = field.maxY() + settings.fieldMargin;
+
+    _nodes.reserve(settings.maxNodes);
+    _parents.reserve(settings.maxNodes);
+    _costs.reserve(settings.maxNodes);
+}
+
+const Path& PathPlanner::plan(const Geometry::Vector2D &start, const Geometry::Vector2D &targetGoal,
+                              const std::vector<Obstacle> &obstacles, size_t ignoredObstacle) {
+    const auto deadline = std::chrono::steady_clock::now() + _settings.timeBudget;
+    const Geometry::Vector2D goal = clampToBounds(targetGoal);
+
+    buildObstacles(start, obstacles, ignoredObstacle);
+    _nodes.clear();
+    _parents.clear();
+    _costs.clear();
+    addNode(start, NONE);
+
+    if(isFree(start, goal)) {
+        extractPath(0, goal, true);
+        return _path;
+    }
+
+    size_t best = NONE;
+    float bestCost = std::numeric_limits<float>::infinity();
+    const auto connectToGoal = [&](size_t node) {
+        const float cost = _costs[node] + _nodes[node].dist(goal);
+        if(cost < bestCost && isFree(_nodes[node], goal)) {
+            best = node;
+            bestCost = cost;
+        }
+    };
+
+    seedWithPreviousPath(goal);
+    for(size_t node = 1; node < _nodes.size(); node++) {
+        connectToGoal(node);
+    }
+
+    // No path is shorter than the straight line, so the search stops early when close to it
+    const float lowerBound = start.dist(goal);
+    size_t closest = 0;
+    float closestDistance = lowerBound;
+    size_t iterations = 0;
+    while(_nodes.size() < _settings.maxNodes && !(bestCost <= lowerBound * 1.001f)) {
+        if((iterations & 3) == 0 && std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+        iterations++;
+
+        // Steer from the nearest node towards the sample
+        const Geometry::Vector2D target = sample(goal);
+        const size_t from = nearest(target);
+        const float length = _nodes[from].dist(target);
+        if(length < 1e-3f) {
+            continue;
+        }
+        const Geometry::Vector2D point = (length > _settings.stepSize) ? _nodes[from] + (target - _nodes[from]) * (_settings.stepSize / length) : target;
+
+        // Cheapest collision-free parent among the near nodes
+        const float rewireRadius2 = _settings.rewireRadius * _settings.rewireRadius;
+        _near.clear();
+        for(size_t node = 0; node < _nodes.size(); node++) {
+            if((_nodes[node] - point).length2() <= rewireRadius2) {
+                _near.push_back(node);
+            }
+        }
+        size_t parent = NONE;
+        float parentCost = std::numeric_limits<float>::infinity();
+        for(size_t node : _near) {
+            const float cost = _costs[node] + _nodes[node].dist(point);
+            if(cost < parentCost && isFree(_nodes[node], point)) {
+                parent = node;
+                parentCost = cost;
+            }
+        }
+        if(parent == NONE) {
+            continue;
+        }
+        const size_t added = addNode(point, parent);
+
+        // Rewire the near nodes that get cheaper through the new one. The stored costs of their
+        // descendants become upper bounds, which keeps the tree acyclic
+        for(size_t node : _near) {
+            const float cost = _costs[added] + point.dist(_nodes[node]);
+            if(node != parent && cost < _costs[node] && isFree(point, _nodes[node])) {
+                _parents[node] = added;
+                _costs[node] = cost;
+            }
+        }
+
+        connectToGoal(added);
+        const float goalDistance = point.dist(goal);
+        if(goalDistance < closestDistance) {
+            closest = added;
+            closestDistance = goalDistance;
+        }
+    }
+
+    if(best != NONE) {
+        extractPath(best, goal, true);
+    }
+    else {
+        extractPath(closest, _nodes[closest], false);
+    }
+    _path.iterations = iterations;
+
+    return _path;
+}
+
+const Path& PathPlanner::path() const {
+    return _path;
+}
+
+void PathPlanner::reset() {
+    _previousWaypoints.clear();
+    _path = Path();
+}
+
+const PlannerSettings& PathPlanner::settings() const {
+    return _settings;
+}
+
+void PathPlanner::buildObstacles(const Geometry::Vector2D &start, const std::vector<Obstacle> &obstacles, size_t ignoredObstacle) {
+    _obstacles.clear();
+    for(size_t i = 0; i < obstacles.size(); i++) {
+        if(i == ignoredObstacle) {
+            continue;
+        }
+
+        const Obstacle &obstacle = obstacles[i];
+        const float radius = obstacle.radius + _settings.robotRadius + _settings.safetyMargin;
+        const Geometry::Vector2D sweep = obstacle.velocity * _settings.predictionHorizon;
+        const float sweepLength = sweep.length();
+        const size_t steps = std::min(MAX_SWEEP_CIRCLES - 1, static_cast<size_t>(std::ceil(sweepLength / (SWEEP_SPACING * radius))));
+        for(size_t step = 0; step <= steps; step++) {
+            const Geometry::Vector2D center = (steps == 0) ? obstacle.position : obstacle.position + sweep * (static_cast<float>(step) / steps);
+            // The robot must be able to leave an obstacle it is already in
+            if((center - start).length2() >= radius * radius) {
+                _obstacles.add(Geometry::Circle(center, radius));
+            }
+        }
+    }
+}
+
+bool PathPlanner::isFree(const Geometry::Vector2D &from, const Geometry::Vector2D &to) const {
+    return !_obstacles.isBlocked(Geometry::LineSegment(from, to));
+}
+
+Geometry::Vector2D PathPlanner::clampToBounds(const Geometry::Vector2D &point) const {
+    return Geometry::Vector2D(std::clamp(point.x(), _minX, _maxX), std::clamp(point.y(), _minY, _maxY));
+}
+
+Geometry::Vector2D PathPlanner::sample(const Geometry::Vector2D &goal) {
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    const float choice = unit(_generator);
+    if(choice < _settings.goalBias) {
+        return goal;
+    }
+
+    // Around a waypoint of the previous path, which usually is still a good route
+    if(choice < _settings.goalBias + _settings.reuseBias && !_previousWaypoints.empty()) {
+        std::uniform_int_distribution<size_t> waypoint(0, _previousWaypoints.size() - 1);
+        std::normal_distribution<float> noise(0.0f, 0.5f * _settings.stepSize);
+        const Geometry::Vector2D &center = _previousWaypoints[waypoint(_generator)];
+        return clampToBounds(Geometry::Vector2D(center.x() + noise(_generator), center.y() + noise(_generator)));
+    }
+
+    std::uniform_real_distribution<float> x(_minX, _maxX), y(_minY, _maxY);
+    return Geometry::Vector2D(x(_generator), y(_generator));
+}
+
+size_t PathPlanner::nearest(const Geometry::Vector2D &point) const {
+    size_t best = 0;
+    float bestDistance = (_nodes[0] - point).length2();
+    for(size_t node = 1; node < _nodes.size(); node++) {
+        const float nodeDistance = (_nodes[node] - point).length2();
+        if(nodeDistance < bestDistance) {
+            best = node;
+            bestDistance = nodeDistance;
+        }
+    }
+
+    return best;
+}
+
+size_t PathPlanner::addNode(const Geometry::Vector2D &point, size_t parent) {
+    _nodes.push_back(point);
+    _parents.push_back(parent);
+    _costs.push_back((parent == NONE) ? 0.0f : _costs[parent] + _nodes[parent].dist(point));
+
+    return _nodes.size() - 1;
+}
+
+void PathPlanner::seedWithPreviousPath(const Geometry::Vector2D &goal) {
+    // The previous path from its first waypoint still reachable in a chain from the new start
+    size_t last = 0;
+    for(size_t i = 1; i < _previousWaypoints.size() && _nodes.size() < _settings.maxNodes; i++) {
+        const Geometry::Vector2D waypoint = clampToBounds(_previousWaypoints[i]);
+        if((waypoint - _nodes[last]).length2() < 1e-6f || (waypoint - goal).length2() < 1e-6f) {
+            continue;
+        }
+        if(!isFree(_nodes[last], waypoint)) {
+            break;
+        }
+        last = addNode(waypoint, last);
+    }
+}
+
+void PathPlanner::extractPath(size_t last, const Geometry::Vector2D &end, bool reachesGoal) {
+    _path.waypoints.clear();
+    if(reachesGoal) {
+        _path.waypoints.push_back(end);
+    }
+    for(size_t node = last; node != NONE; node = _parents[node]) {
+        _path.waypoints.push_back(_nodes[node]);
+    }
+    std::reverse(_path.waypoints.begin(), _path.waypoints.end());
+    shortcut();
+
+    _path.length = 0.0f;
+    for(size_t i = 1; i < _path.waypoints.size(); i++) {
+        _path.length += _path.waypoints[i - 1].dist(_path.waypoints[i]);
+    }
+    _path.reachesGoal = reachesGoal;
+    _path.iterations = 0;
+    _previousWaypoints = _path.waypoints;
+}
+
+void PathPlanner::shortcut() {
+    std::vector<Geometry::Vector2D> &waypoints = _path.waypoints;
+    if(waypoints.size() < 3) {
+        return;
+    }
+
+    // Jump from each kept waypoint to the farthest one it sees
+    size_t kept = 1;
+    for(size_t current = 0; current + 1 < waypoints.size();) {
+        size_t next = waypoints.size() - 1;
+        while(next > current + 1 && !isFree(waypoints[current], waypoints[next])) {
+            next--;
+        }
+        waypoints[kept++] = waypoints[next];
+        current = next;
+    }
+    waypoints.resize(kept);
+}
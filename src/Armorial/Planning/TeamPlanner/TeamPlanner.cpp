@@ -0,0 +1,100 @@
+#include <Armorial/Planning/TeamPlanner/TeamPlanner.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+using namespace Planning;
+
+TeamPlanner::TeamPlanner(const Common::Types::Field &field, size_t robots, const PlannerSettings &settings, unsigned threads) {
+    _planners.reserve(robots);
+    for(size_t robot = 0; robot < robots; robot++) {
+        // Different random sequences, so that robots in the same situation do not explore alike
+        PlannerSettings robotSettings = settings;
+        robotSettings.seed = settings.seed + static_cast<unsigned>(robot);
+        _planners.emplace_back(field, robotSettings);
+    }
+
+    const size_t workers = std::min<size_t>(std::max(threads, 1u), std::max<size_t>(robots, 1)) - 1;
+    for(size_t worker = 0; worker < workers; worker++) {
+        _workers.emplace_back(&TeamPlanner::work, this);
+    }
+}
+
+TeamPlanner::~TeamPlanner() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _startCondition.notify_all();
+    for(std::thread &worker : _workers) {
+        worker.join();
+    }
+}
+
+const std::vector<Path>& TeamPlanner::plan(const std::vector<PlanningRequest> &requests, const std::vector<Obstacle> &obstacles) {
+    if(requests.size() > _planners.size()) {
+        spdlog::warn("TeamPlanner received {} requests for {} robots, the extra ones are not planned", requests.size(), _planners.size());
+    }
+
+    _paths.resize(std::min(requests.size(), _planners.size()));
+    _requests = &requests;
+    _obstacles = &obstacles;
+    _nextRequest = 0;
+
+    if(_workers.empty() || _paths.size() < 2) {
+        runRequests();
+        return _paths;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _generation++;
+        _pending = static_cast<unsigned>(_workers.size());
+    }
+    _startCondition.notify_all();
+
+    // The calling thread takes requests as well
+    runRequests();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _doneCondition.wait(lock, [this] { return _pending == 0; });
+
+    return _paths;
+}
+
+PathPlanner& TeamPlanner::planner(size_t robot) {
+    return _planners.at(robot);
+}
+
+size_t TeamPlanner::size() const {
+    return _planners.size();
+}
+
+void TeamPlanner::work() {
+    unsigned generation = 0;
+    while(true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _startCondition.wait(lock, [&] { return _stopping || _generation != generation; });
+            if(_stopping) {
+                return;
+            }
+            generation = _generation;
+        }
+
+        runRequests();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(--_pending == 0) {
+            _doneCondition.notify_one();
+        }
+    }
+}
+
+void TeamPlanner::runRequests() {
+    for(size_t i = _nextRequest++; i < _paths.size(); i = _nextRequest++) {
+        const PlanningRequest &request = (*_requests)[i];
+        _paths[i] = _planners[i].plan(request.start, request.goal, *_obstacles, request.ignoredObstacle);
+    }
+}
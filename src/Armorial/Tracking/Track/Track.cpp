@@ -0,0 +1,169 @@
+#include <Armorial/Tracking/Track/Track.h>
+
+using namespace Tracking;
+
+namespace {
+    constexpr float square(float value) {
+        return value * value;
+    }
+}
+
+Track::Track(unsigned id, const Detection &detection, const TrackingSettings &settings) {
+    _settings = settings;
+    _id = id;
+    _status = Status::TENTATIVE;
+    _hits = 1;
+    _misses = 0;
+    _hasOrientation = false;
+
+    // Start at the detected position, with an unknown velocity (and acceleration)
+    PositionFilter::State x;
+    x(0, 0) = detection.position.x();
+    x(1, 0) = detection.position.y();
+
+    PositionFilter::Covariance P;
+    const float positionVariance = square(settings.measurementNoise);
+    const float velocityVariance = square(settings.initialVelocityDeviation);
+    P(0, 0) = P(1, 1) = positionVariance;
+    P(2, 2) = P(3, 3) = velocityVariance;
+    if(settings.model == MotionModel::CONSTANT_ACCELERATION) {
+        P(4, 4) = P(5, 5) = velocityVariance;
+    }
+
+    PositionFilter::Observation H;
+    H(0, 0) = H(1, 1) = 1.0f;
+
+    _position = PositionFilter(x, P, H, PositionFilter::MeasurementCovariance::diag(positionVariance));
+
+    if(detection.orientation.has_value()) {
+        initializeOrientation(detection.orientation.value());
+    }
+
+    if(_hits >= settings.confirmationHits) {
+        _status = Status::CONFIRMED;
+    }
+}
+
+void Track::initializeOrientation(const Geometry::Angle &orientation) {
+    OrientationFilter::State x;
+    x(0, 0) = orientation.value();
+
+    OrientationFilter::Covariance P;
+    P(0, 0) = square(_settings.orientationMeasurementNoise);
+    P(1, 1) = square(_settings.initialAngularSpeedDeviation);
+
+    OrientationFilter::Observation H;
+    H(0, 0) = 1.0f;
+
+    _orientation = OrientationFilter(x, P, H, OrientationFilter::MeasurementCovariance::diag(P(0, 0)));
+    _hasOrientation = true;
+}
+
+void Track::predict(float dt) {
+    const float dt2 = dt * dt;
+    const float dt3 = dt2 * dt;
+
+    PositionFilter::Covariance F = PositionFilter::Covariance::identity();
+    PositionFilter::Covariance Q;
+    const float q = _settings.processNoise;
+    for(unsigned axis = 0; axis < 2; axis++) {
+        const unsigned p = axis, v = axis + 2, a = axis + 4;
+        F(p, v) = dt;
+
+        if(_settings.model == MotionModel::CONSTANT_ACCELERATION) {
+            // Discretized white noise jerk
+            F(p, a) = dt2 / 2.0f;
+            F(v, a) = dt;
+            Q(p, p) = q * dt3 * dt2 / 20.0f;
+            Q(p, v) = Q(v, p) = q * dt2 * dt2 / 8.0f;
+            Q(p, a) = Q(a, p) = q * dt3 / 6.0f;
+            Q(v, v) = q * dt3 / 3.0f;
+            Q(v, a) = Q(a, v) = q * dt2 / 2.0f;
+            Q(a, a) = q * dt;
+        } else {
+            // Discretized white noise acceleration
+            Q(p, p) = q * dt3 / 3.0f;
+            Q(p, v) = Q(v, p) = q * dt2 / 2.0f;
+            Q(v, v) = q * dt;
+        }
+    }
+    _position.predict(F, Q);
+
+    if(_hasOrientation) {
+        const float w = _settings.orientationProcessNoise;
+        OrientationFilter::Covariance Fo = OrientationFilter::Covariance::identity();
+        Fo(0, 1) = dt;
+        OrientationFilter::Covariance Qo({{w * dt3 / 3.0f, w * dt2 / 2.0f},
+                                          {w * dt2 / 2.0f, w * dt}});
+        _orientation.predict(Fo, Qo);
+
+        // Keep the orientation in [-π, π]
+        OrientationFilter::State x = _orientation.state();
+        x(0, 0) = Geometry::Angle(x(0, 0)).value();
+        _orientation.setState(x);
+    }
+}
+
+void Track::update(const Detection &detection) {
+    PositionFilter::Measurement z;
+    z(0, 0) = detection.position.x();
+    z(1, 0) = detection.position.y();
+    _position.update(z);
+
+    if(detection.orientation.has_value()) {
+        if(!_hasOrientation) {
+            initializeOrientation(detection.orientation.value());
+        } else {
+            // The residual is the shortest angle between the measured and estimated orientations
+            OrientationFilter::Measurement y;
+            y(0, 0) = (detection.orientation.value() - orientation()).value();
+            _orientation.correct(y);
+
+            OrientationFilter::State x = _orientation.state();
+            x(0, 0) = Geometry::Angle(x(0, 0)).value();
+            _orientation.setState(x);
+        }
+    }
+
+    _hits++;
+    _misses = 0;
+    if(_hits >= _settings.confirmationHits) {
+        _status = Status::CONFIRMED;
+    }
+}
+
+void Track::miss() {
+    _misses++;
+}
+
+bool Track::isLost() const {
+    if(_status == Status::TENTATIVE) {
+        return (_misses > 0);
+    }
+
+    return (_misses > _settings.maxMisses);
+}
+
+Geometry::Vector2D Track::position() const {
+    return Geometry::Vector2D(_position.state().get(0, 0), _position.state().get(1, 0));
+}
+
+Geometry::Vector2D Track::velocity() const {
+    return Geometry::Vector2D(_position.state().get(2, 0), _position.state().get(3, 0));
+}
+
+Geometry::Vector2D Track::acceleration() const {
+    return Geometry::Vector2D(_position.state().get(4, 0), _position.state().get(5, 0));
+}
+
+Geometry::Angle Track::orientation() const {
+    return (_hasOrientation ? Geometry::Angle(_orientation.state().get(0, 0)) : Geometry::Angle());
+}
+
+float Track::angularSpeed() const {
+    return (_hasOrientation ? _orientation.state().get(1, 0) : 0.0f);
+}
+
+Common::Types::Object Track::object() const {
+    return Common::Types::Object(position(), velocity(), acceleration(), orientation(), angularSpeed());
+}
@@ -0,0 +1,122 @@
+#include <Armorial/Tracking/Tracker/Tracker.h>
+#include <Armorial/Algorithms/Hungarian/impl/hungarian_impl.h>
+
+#include <algorithm>
+
+using namespace Tracking;
+
+Tracker::Tracker(const TrackingSettings &settings) {
+    _settings = settings;
+    _nextId = 0;
+}
+
+void Tracker::update(const std::vector<Detection> &detections, float dt) {
+    for(auto &track : _tracks) {
+        track.predict(dt);
+    }
+
+    associate(detections);
+
+    _detectionUsed.assign(detections.size(), false);
+    for(size_t i = 0; i < _tracks.size(); i++) {
+        if(_assignment[i] >= 0) {
+            _tracks[i].update(detections[_assignment[i]]);
+            _detectionUsed[_assignment[i]] = true;
+        } else {
+            _tracks[i].miss();
+        }
+    }
+
+    _tracks.erase(std::remove_if(_tracks.begin(), _tracks.end(), [](const Track &track) {
+                      return track.isLost();
+                  }), _tracks.end());
+
+    // Detections left unassociated start new tracks
+    for(size_t j = 0; j < detections.size(); j++) {
+        if(!_detectionUsed[j]) {
+            _tracks.emplace_back(_nextId++, detections[j], _settings);
+        }
+    }
+}
+
+void Tracker::associate(const std::vector<Detection> &detections) {
+    const size_t tracks = _tracks.size();
+    _assignment.assign(tracks, -1);
+    if(tracks == 0 || detections.empty()) {
+        return;
+    }
+
+    // Pairs outside the gate are marked infeasible and discarded after the assignment. Their cost
+    // only has to exceed any sum of gated distances, so that the assignment never trades a feasible
+    // pair for an infeasible one
+    const double gatedCost = static_cast<double>(std::min(tracks, detections.size()) + 1) * (static_cast<double>(_settings.gate) + 1.0);
+    _costs.assign(tracks * detections.size(), gatedCost);
+    _feasible.assign(tracks * detections.size(), false);
+    for(size_t i = 0; i < tracks; i++) {
+        const auto &filter = _tracks[i].positionFilter();
+
+        // The inverse of the innovation covariance is computed once per track
+        const auto inverseS = filter.innovationCovariance().inverse();
+        if(!inverseS.has_value()) {
+            continue;
+        }
+
+        for(size_t j = 0; j < detections.size(); j++) {
+            Track::PositionFilter::Measurement z;
+            z(0, 0) = detections[j].position.x();
+            z(1, 0) = detections[j].position.y();
+            const float distance = Track::PositionFilter::squaredDistance(filter.innovation(z), inverseS.value());
+            if(distance <= _settings.gate) {
+                _costs[i * detections.size() + j] = distance;
+                _feasible[i * detections.size() + j] = true;
+            }
+        }
+    }
+
+    // The Hungarian method needs at most as many lines as columns
+    const bool transposed = (tracks > detections.size());
+    const int n = static_cast<int>(transposed ? detections.size() : tracks);
+    const int m = static_cast<int>(transposed ? tracks : detections.size());
+    tourist::hungarian<double> hungarian(n, m);
+    for(int i = 0; i < n; i++) {
+        for(int j = 0; j < m; j++) {
+            hungarian.a[i][j] = transposed ? _costs[j * detections.size() + i] : _costs[i * detections.size() + j];
+        }
+    }
+    hungarian.solve();
+
+    for(int i = 0; i < n; i++) {
+        const int j = hungarian.pa[i];
+        const size_t track = transposed ? j : i;
+        const size_t detection = transposed ? i : j;
+        if(_feasible[track * detections.size() + detection]) {
+            _assignment[track] = static_cast<int>(detection);
+        }
+    }
+}
+
+void Tracker::clear() {
+    _tracks.clear();
+}
+
+std::vector<Common::Types::Object> Tracker::objects() const {
+    std::vector<Common::Types::Object> objects;
+    objects.reserve(_tracks.size());
+    for(const auto &track : _tracks) {
+        if(track.isConfirmed()) {
+            objects.push_back(track.object());
+        }
+    }
+
+    return objects;
+}
+
+const Track* Tracker::track(unsigned id) const {
+    for(const auto &track : _tracks) {
+        if(track.id() == id) {
+            return &track;
+        }
+    }
+
+    return nullptr;
+}
@@ -16,6 +16,9 @@ QT += core network
 DEFINES += QT_DEPRECATED_WARNINGS
 LIBS += -lfmt -lArmorial -lgtest -lgmock
 
+# Same floating point contraction as the library, whose inline headers the tests compare against
+QMAKE_CXXFLAGS += -ffp-contract=off
+
 # The following define makes your compiler emit warnings if you use
 # any Qt feature that has been marked deprecated (the exact warnings
 # depend on your compiler). Please consult the documentation of the
@@ -32,23 +35,54 @@ DEFINES += PROJECT_PATH=\\\"$${PWD}\\\"
 
 SOURCES += \
     main.cpp \
+    src/Algorithms/Auction/Auction.cpp \
+    src/Algorithms/Hungarian/FixedHungarian.cpp \
     src/Geometry/Angle/Angle.cpp \
+    src/Geometry/AngularSweep/AngularSweep.cpp \
     src/Geometry/Arc/Arc.cpp \
+    src/Geometry/Batch/Batch.cpp \
     src/Geometry/Circle/Circle.cpp \
+    src/Geometry/CircleSet/CircleSet.cpp \
+    src/Geometry/KDTree/KDTree.cpp \
     src/Geometry/Line/Line.cpp \
     src/Geometry/LineSegment/LineSegment.cpp \
     src/Geometry/Polygon/Polygon.cpp \
+    src/Geometry/PreparedPolygon/PreparedPolygon.cpp \
     src/Geometry/Rectangle/Rectangle.cpp \
+    src/Geometry/Rotation2D/Rotation2D.cpp \
+    src/Geometry/SweepAndPrune/SweepAndPrune.cpp \
+    src/Geometry/SweptCircle/SweptCircle.cpp \
+    src/Geometry/Transform2D/Transform2D.cpp \
     src/Geometry/Triangle/Triangle.cpp \
     src/Geometry/Vector2D/Vector2D.cpp \
+    src/Math/Cholesky/Cholesky.cpp \
+    src/Math/FixedMatrix/FixedMatrix.cpp \
+    src/Math/LU/LU.cpp \
+    src/Math/Matrix/Gemm.cpp \
     src/Math/Matrix/Matrix.cpp \
+    src/Math/MatrixExpression/MatrixExpression.cpp \
+    src/Math/MatrixSlice/MatrixSlice.cpp \
+    src/Math/MatrixView/MatrixView.cpp \
+    src/Math/PolynomialFit/PolynomialFit.cpp \
+    src/Math/QR/QR.cpp \
+    src/Math/SVD/SVD.cpp \
     src/Common/Enums/Enums.cpp \
     src/Common/Types/Field/Field.cpp \
+    src/Common/Types/FieldGeometry/FieldGeometry.cpp \
+    src/Common/Types/FieldRegionGrid/FieldRegionGrid.cpp \
     src/Common/Types/Object/Object.cpp \
+    src/Common/Types/WorldSnapshot/WorldSnapshot.cpp \
+    src/Planning/PathPlanner/PathPlanner.cpp \
+    src/Planning/TeamPlanner/TeamPlanner.cpp \
     src/Threaded/Entity/Entity.cpp \
     src/Threaded/EntityCommons.cpp \
     src/Threaded/EntityManager/EntityManager.cpp \
+    src/Tracking/KalmanFilter/KalmanFilter.cpp \
+    src/Tracking/Track/Track.cpp \
+    src/Tracking/Tracker/Tracker.cpp \
+    src/Utils/Angles/Angles.cpp \
     src/Utils/ParameterHandler/ParameterHandler.cpp \
+    src/Utils/StaticVector/StaticVector.cpp \
     src/Utils/Timer/Timer.cpp
 
 
@@ -58,6 +92,9 @@ else: unix:!android: target.path = /opt/$${TARGET}/bin
 !isEmpty(target.path): INSTALLS += target
 
 HEADERS += \
+    src/Algorithms/AlgorithmsTestUtils.h \
+    src/Geometry/GeometryTestUtils.h \
+    src/Math/MatrixTestUtils.h \
     src/Threaded/EntityCommons.h
 
 DISTFILES += \
@@ -0,0 +1,21 @@
+#ifndef ALGORITHMSTESTUTILS_H
+#define ALGORITHMSTESTUTILS_H
+
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+
+namespace AlgorithmsTestUtils {
+    // Minimal robot for the match() helpers, which only need distTo()
+    class Robot {
+    public:
+        Robot(const Geometry::Vector2D &position = Geometry::Vector2D()) : _position(position) {}
+
+        float distTo(const Geometry::Vector2D &position) {
+            return _position.dist(position);
+        }
+
+    private:
+        Geometry::Vector2D _position;
+    };
+}
+
+#endif // ALGORITHMSTESTUTILS_H
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Algorithms/Auction/Auction.h>
+#include <Armorial/Algorithms/Hungarian/impl/hungarian_impl.h>
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+
+#include <random>
+#include <set>
+
+#include <src/Algorithms/AlgorithmsTestUtils.h>
+
+using AlgorithmsTestUtils::Robot;
+
+namespace {
+    float solveWithHungarian(const std::vector<std::vector<float>> &costs) {
+        tourist::hungarian<float> hungarian(costs.size(), costs[0].size());
+        hungarian.a = costs;
+        hungarian.solve();
+
+        float score = 0.0f;
+        for (size_t i = 0; i < costs.size(); i++) {
+            score += costs[i][hungarian.pa[i]];
+        }
+
+        return score;
+    }
+
+    float solveWithAuction(const std::vector<std::vector<float>> &costs, unsigned threads) {
+        Algorithms::impl::auction<float> auction(costs.size(), costs[0].size(), threads);
+        auction.a = costs;
+        float score = auction.solve();
+
+        // Each row should have received a different column
+        std::set<int> columns(auction.pa.begin(), auction.pa.end());
+        EXPECT_EQ(columns.size(), costs.size()) << "Auction assigned a column twice";
+
+        return score;
+    }
+
+    std::vector<std::vector<float>> randomCosts(std::mt19937 &generator, int n, int m) {
+        std::uniform_real_distribution<float> distribution(0.0f, 10.0f);
+        std::vector<std::vector<float>> costs(n, std::vector<float>(m));
+        for (auto &line : costs) {
+            for (auto &cost : line) {
+                cost = distribution(generator);
+            }
+        }
+
+        return costs;
+    }
+}
+
+TEST(Algorithms_Auction_Test, Given_A_Square_Problem_Should_Match_Hungarian_Score) {
+    std::mt19937 generator(42);
+    for (int test = 0; test < 20; test++) {
+        std::vector<std::vector<float>> costs = randomCosts(generator, 11, 11);
+        EXPECT_NEAR(solveWithAuction(costs, 1), solveWithHungarian(costs), 1e-3);
+    }
+}
+
+TEST(Algorithms_Auction_Test, Given_A_Rectangular_Problem_Should_Match_Hungarian_Score) {
+    std::mt19937 generator(7);
+    for (int test = 0; test < 10; test++) {
+        std::vector<std::vector<float>> costs = randomCosts(generator, 11, 200);
+        EXPECT_NEAR(solveWithAuction(costs, 1), solveWithHungarian(costs), 1e-3);
+    }
+}
+
+TEST(Algorithms_Auction_Test, Given_Multiple_Threads_Should_Match_Hungarian_Score) {
+    std::mt19937 generator(13);
+    for (int test = 0; test < 5; test++) {
+        std::vector<std::vector<float>> costs = randomCosts(generator, 150, 200);
+        EXPECT_NEAR(solveWithAuction(costs, 4), solveWithHungarian(costs), 1e-2);
+    }
+}
+
+TEST(Algorithms_Auction_Test, Given_Equal_Costs_Should_Assign_All_Rows) {
+    std::vector<std::vector<float>> costs(5, std::vector<float>(8, 1.0f));
+    EXPECT_FLOAT_EQ(solveWithAuction(costs, 1), 5.0f);
+}
+
+TEST(Algorithms_Auction_Test, Given_Robots_And_Positions_Match_Should_Work) {
+    QVector<Robot> robots = {Robot(Geometry::Vector2D(0.0f, 0.0f)),
+                             Robot(Geometry::Vector2D(10.0f, 0.0f)),
+                             Robot(Geometry::Vector2D(0.0f, 10.0f))};
+    QVector<Geometry::Vector2D> positions = {Geometry::Vector2D(0.0f, 11.0f),
+                                             Geometry::Vector2D(50.0f, 50.0f),
+                                             Geometry::Vector2D(1.0f, 0.0f),
+                                             Geometry::Vector2D(11.0f, 1.0f)};
+
+    auto result = Algorithms::Auction<Robot, Geometry::Vector2D>::match(robots, positions);
+    ASSERT_EQ(result.size(), robots.size());
+    EXPECT_EQ(result[0].second, positions[2]);
+    EXPECT_EQ(result[1].second, positions[3]);
+    EXPECT_EQ(result[2].second, positions[0]);
+}
+
+TEST(Algorithms_Auction_Test, Given_More_Robots_Than_Positions_Match_Should_Be_Empty) {
+    QVector<Robot> robots = {Robot(), Robot()};
+    QVector<Geometry::Vector2D> positions = {Geometry::Vector2D(1.0f, 1.0f)};
+
+    EXPECT_TRUE((Algorithms::Auction<Robot, Geometry::Vector2D>::match(robots, positions).empty()));
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Algorithms/Hungarian/Hungarian.h>
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+
+#include <random>
+
+#include <src/Algorithms/AlgorithmsTestUtils.h>
+
+using AlgorithmsTestUtils::Robot;
+
+namespace {
+    template <int N, int M>
+    void expectSameScoreAsHungarian(std::mt19937 &generator) {
+        std::uniform_real_distribution<float> distribution(-5.0f, 10.0f);
+        tourist::hungarian<float> hungarian(N, M);
+        tourist::fixed_hungarian<float, N, M> fixedHungarian;
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < M; j++) {
+                hungarian.a[i][j] = fixedHungarian.a[i][j] = distribution(generator);
+            }
+        }
+        hungarian.solve();
+        fixedHungarian.solve();
+
+        float score = 0.0f, fixedScore = 0.0f;
+        for (int i = 0; i < N; i++) {
+            score += hungarian.a[i][hungarian.pa[i]];
+            fixedScore += fixedHungarian.a[i][fixedHungarian.pa[i]];
+            EXPECT_EQ(fixedHungarian.pb[fixedHungarian.pa[i]], i);
+        }
+        EXPECT_NEAR(fixedScore, score, 1e-4);
+    }
+
+    constexpr int solveAtCompileTime() {
+        tourist::fixed_hungarian<int, 3, 3> hungarian;
+        hungarian.a = {{{4, 1, 3}, {2, 0, 5}, {3, 2, 2}}};
+        return hungarian.solve();
+    }
+}
+
+TEST(Algorithms_FixedHungarian_Test, Given_Small_Problems_Exhaustive_Search_Should_Match_Hungarian) {
+    std::mt19937 generator(42);
+    for (int test = 0; test < 50; test++) {
+        expectSameScoreAsHungarian<1, 1>(generator);
+        expectSameScoreAsHungarian<3, 5>(generator);
+        expectSameScoreAsHungarian<4, 4>(generator);
+        expectSameScoreAsHungarian<2, 11>(generator);
+    }
+}
+
+TEST(Algorithms_FixedHungarian_Test, Given_Larger_Problems_Should_Match_Hungarian) {
+    std::mt19937 generator(7);
+    for (int test = 0; test < 50; test++) {
+        expectSameScoreAsHungarian<6, 6>(generator);
+        expectSameScoreAsHungarian<6, 11>(generator);
+        expectSameScoreAsHungarian<11, 11>(generator);
+    }
+}
+
+TEST(Algorithms_FixedHungarian_Test, Given_Only_Infinite_Costs_Exhaustive_Search_Should_Keep_A_Valid_Assignment) {
+    using Solver = tourist::fixed_hungarian<float, 2, 3>;
+    Solver hungarian;
+    for (auto &line : hungarian.a) {
+        line.fill(Solver::inf);
+    }
+
+    EXPECT_EQ(hungarian.solve_exhaustive(), Solver::inf);
+    EXPECT_EQ(hungarian.pa[0], 0);
+    EXPECT_EQ(hungarian.pa[1], 1);
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(hungarian.pb[hungarian.pa[i]], i);
+    }
+    EXPECT_EQ(hungarian.pb[2], -1);
+}
+
+TEST(Algorithms_FixedHungarian_Test, Given_A_Constant_Problem_Should_Be_Solved_At_Compile_Time) {
+    static_assert(solveAtCompileTime() == 5, "Fixed hungarian should be usable in constant expressions");
+}
+
+TEST(Algorithms_FixedHungarian_Test, Given_Robots_And_Positions_Arrays_Match_Should_Work) {
+    std::array<Robot, 3> robots = {Robot(Geometry::Vector2D(0.0f, 0.0f)),
+                                   Robot(Geometry::Vector2D(10.0f, 0.0f)),
+                                   Robot(Geometry::Vector2D(0.0f, 10.0f))};
+    std::array<Geometry::Vector2D, 4> positions = {Geometry::Vector2D(0.0f, 11.0f),
+                                                   Geometry::Vector2D(50.0f, 50.0f),
+                                                   Geometry::Vector2D(1.0f, 0.0f),
+                                                   Geometry::Vector2D(11.0f, 1.0f)};
+
+    auto result = Algorithms::Hungarian<Robot, Geometry::Vector2D>::match(robots, positions);
+    EXPECT_EQ(result[0].second, positions[2]);
+    EXPECT_EQ(result[1].second, positions[3]);
+    EXPECT_EQ(result[2].second, positions[0]);
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Common/Types/Field/Field.h>
+#include <Armorial/Common/Types/FieldGeometry/FieldGeometry.h>
+using namespace Common::Types;
+
+#include <src/Geometry/GeometryTestUtils.h>
+
+using GeometryTestUtils::makeField;
+
+namespace {
+    void expectSameRectangle(const Geometry::Rectangle &a, const Geometry::Rectangle &b) {
+        EXPECT_EQ(a.topLeft(), b.topLeft());
+        EXPECT_EQ(a.bottomRight(), b.bottomRight());
+    }
+}
+
+TEST(Common_FieldGeometry_Test, GivenField_Getters_ShouldMatchTheFieldAccessors){
+    for(Common::Enums::Side side : {Common::Enums::SIDE_LEFT, Common::Enums::SIDE_RIGHT}) {
+        const Field field = makeField(side);
+        const FieldGeometry geometry(field);
+
+        EXPECT_EQ(geometry.playingLeftSide(), field.playingLeftSide());
+        expectSameRectangle(geometry.field(), field.field());
+        expectSameRectangle(geometry.ourField(), field.ourField());
+        expectSameRectangle(geometry.theirField(), field.theirField());
+        expectSameRectangle(geometry.ourPenaltyArea(), field.ourPenaltyArea());
+        expectSameRectangle(geometry.theirPenaltyArea(), field.theirPenaltyArea());
+        expectSameRectangle(geometry.topRightQuadrant(), field.topRightQuadrant());
+        expectSameRectangle(geometry.bottomLeftQuadrant(), field.bottomLeftQuadrant());
+        EXPECT_FLOAT_EQ(geometry.centerCircle().radius(), field.centerCircle().radius());
+
+        EXPECT_EQ(geometry.ourGoalCenter(), field.ourGoalCenter());
+        EXPECT_EQ(geometry.ourGoalLeftPost(), field.ourGoalLeftPost());
+        EXPECT_EQ(geometry.theirGoalRightPost(), field.theirGoalRightPost());
+        EXPECT_EQ(geometry.ourPenaltyMark(), field.ourPenaltyMark());
+        EXPECT_EQ(geometry.theirPenaltyMark(), field.theirPenaltyMark());
+        EXPECT_EQ(geometry.bottomRightCorner(), field.bottomRightCorner());
+    }
+}
+
+TEST(Common_FieldGeometry_Test, GivenPositions_Containment_ShouldMatchTheFieldChecks){
+    for(Common::Enums::Side side : {Common::Enums::SIDE_LEFT, Common::Enums::SIDE_RIGHT}) {
+        Field field = makeField(side);
+        const FieldGeometry geometry(field);
+
+        // Step through the field and its borders, including the exact region limits
+        for(float x = -5000.0f; x <= 5000.0f; x += 250.0f) {
+            for(float y = -3500.0f; y <= 3500.0f; y += 250.0f) {
+                const Geometry::Vector2D position(x, y);
+                EXPECT_EQ(geometry.isInsideField(position), field.isInsideField(position));
+                EXPECT_EQ(geometry.isInsideOurField(position), field.isInsideOurField(position));
+                EXPECT_EQ(geometry.isInsideTheirField(position), field.isInsideTheirField(position));
+                EXPECT_EQ(geometry.isInsideOurPenaltyArea(position), field.isInsideOurPenaltyArea(position));
+                EXPECT_EQ(geometry.isInsideTheirPenaltyArea(position), field.isInsideTheirPenaltyArea(position));
+            }
+        }
+    }
+}
+
+TEST(Common_FieldGeometry_Test, GivenAMargin_Containment_ShouldExpandOrShrinkTheRegion){
+    const FieldGeometry geometry(makeField(Common::Enums::SIDE_LEFT));
+    const Geometry::Vector2D justOutside(-4500.0f + 1000.0f + 50.0f, 0.0f);
+
+    EXPECT_FALSE(geometry.isInsideOurPenaltyArea(justOutside));
+    EXPECT_TRUE(geometry.isInsideOurPenaltyArea(justOutside, 100.0f));
+    EXPECT_TRUE(geometry.isInsideField(Geometry::Vector2D(4400.0f, 0.0f)));
+    EXPECT_FALSE(geometry.isInsideField(Geometry::Vector2D(4400.0f, 0.0f), -200.0f));
+}
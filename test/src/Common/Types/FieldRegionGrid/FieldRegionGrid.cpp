@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Common/Types/Field/Field.h>
+#include <Armorial/Common/Types/FieldRegionGrid/FieldRegionGrid.h>
+using namespace Common::Types;
+
+#include <random>
+
+#include <src/Geometry/GeometryTestUtils.h>
+
+using GeometryTestUtils::makeField;
+
+TEST(Common_FieldRegionGrid_Test, GivenKnownPositions_Classify_ShouldReturnTheirRegions){
+    const FieldRegionGrid grid(makeField(Common::Enums::SIDE_LEFT), 100.0f, 1500.0f);
+
+    EXPECT_EQ(grid.classify(Geometry::Vector2D(-4000.0f, 200.0f)),
+              Common::Enums::REGION_FIELD | Common::Enums::REGION_OUR_FIELD | Common::Enums::REGION_OUR_PENALTY_AREA
+              | Common::Enums::REGION_TOP_LEFT_QUADRANT | Common::Enums::REGION_NEAR_OUR_GOAL);
+    EXPECT_EQ(grid.classify(Geometry::Vector2D(2050.0f, -1050.0f)),
+              Common::Enums::REGION_FIELD | Common::Enums::REGION_THEIR_FIELD | Common::Enums::REGION_BOTTOM_RIGHT_QUADRANT);
+    EXPECT_EQ(grid.classify(Geometry::Vector2D(4700.0f, 0.0f)), Common::Enums::REGION_NEAR_THEIR_GOAL);
+    EXPECT_EQ(grid.classify(Geometry::Vector2D(0.0f, 9000.0f)), 0);
+}
+
+TEST(Common_FieldRegionGrid_Test, GivenRandomPositions_Classify_ShouldMatchTheExactClassification){
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<float> x(-6500.0f, 6500.0f), y(-5000.0f, 5000.0f);
+
+    for(Common::Enums::Side side : {Common::Enums::SIDE_LEFT, Common::Enums::SIDE_RIGHT}) {
+        for(float resolution : {37.0f, 100.0f, 500.0f}) {
+            const FieldRegionGrid grid(makeField(side), resolution, 1200.0f);
+            for(int i = 0; i < 20000; i++) {
+                const Geometry::Vector2D position(x(generator), y(generator));
+                ASSERT_EQ(grid.classify(position), grid.classifyExact(position));
+            }
+        }
+    }
+}
+
+TEST(Common_FieldRegionGrid_Test, GivenPositionsAtCellAndRegionBorders_Classify_ShouldMatchTheExactClassification){
+    const FieldRegionGrid grid(makeField(Common::Enums::SIDE_RIGHT), 250.0f, 1000.0f);
+
+    // Every 50 units hits the cell borders and the region borders (field, halves, penalty areas)
+    for(float x = -5500.0f; x <= 5500.0f; x += 50.0f) {
+        for(float y = -4000.0f; y <= 4000.0f; y += 50.0f) {
+            const Geometry::Vector2D position(x, y);
+            ASSERT_EQ(grid.classify(position), grid.classifyExact(position));
+        }
+    }
+}
+
+TEST(Common_FieldRegionGrid_Test, GivenAnArray_Classify_ShouldClassifyEachPosition){
+    const FieldRegionGrid grid(makeField(Common::Enums::SIDE_LEFT), 100.0f, 1500.0f);
+    const std::vector<Geometry::Vector2D> positions = {
+        Geometry::Vector2D(-4000.0f, 200.0f), Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(3000.0f, 2000.0f),
+        Geometry::Vector2D(99999.0f, 0.0f), Geometry::Vector2D(4400.0f, -900.0f)
+    };
+
+    std::vector<Common::Enums::RegionMask> regions(positions.size());
+    grid.classify(positions.data(), regions.data(), positions.size());
+    for(size_t i = 0; i < positions.size(); i++) {
+        EXPECT_EQ(regions[i], grid.classifyExact(positions[i]));
+    }
+}
+
+TEST(Common_FieldRegionGrid_Test, GivenAField_Dimensions_ShouldCoverTheExpandedField){
+    const FieldRegionGrid grid(makeField(Common::Enums::SIDE_LEFT), 100.0f, 1000.0f);
+
+    EXPECT_FLOAT_EQ(grid.resolution(), 100.0f);
+    EXPECT_EQ(grid.columns(), 110u);
+    EXPECT_EQ(grid.rows(), 80u);
+}
+
+TEST(Common_FieldRegionGrid_Test, GivenANonPositiveResolution_Constructor_ShouldAssert){
+    EXPECT_DEATH(FieldRegionGrid(makeField(Common::Enums::SIDE_LEFT), 0.0f, 1500.0f), "Assertion*.*failed");
+    EXPECT_DEATH(FieldRegionGrid(makeField(Common::Enums::SIDE_LEFT), -100.0f, 1500.0f), "Assertion*.*failed");
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Common/Types/Field/Field.h>
+#include <Armorial/Common/Types/Object/Object.h>
+#include <Armorial/Common/Types/WorldSnapshot/WorldSnapshot.h>
+using namespace Common::Types;
+
+namespace {
+    WorldSnapshot makeSnapshot() {
+        WorldSnapshot snapshot(3);
+        snapshot.add(Geometry::Vector2D(1.0f, -2.0f), Geometry::Vector2D(0.5f, 0.25f));
+        snapshot.add(Geometry::Vector2D(-3.0f, 1.5f), Geometry::Vector2D(-1.0f, 0.0f), Geometry::Vector2D(0.0f, 2.0f),
+                     Geometry::Angle(0.75f), 1.25f);
+        snapshot.add(Geometry::Vector2D(4.0f, 2.0f), Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(0.0f, 0.0f),
+                     Geometry::Angle(-2.5f), -0.5f);
+        return snapshot;
+    }
+}
+
+TEST(Common_WorldSnapshot_Test, GivenObjects_Add_ShouldStoreThemInOrder){
+    const WorldSnapshot snapshot = makeSnapshot();
+
+    EXPECT_EQ(snapshot.size(), 3u);
+    EXPECT_EQ(snapshot.position(1), Geometry::Vector2D(-3.0f, 1.5f));
+    EXPECT_EQ(snapshot.velocity(0), Geometry::Vector2D(0.5f, 0.25f));
+    EXPECT_EQ(snapshot.acceleration(1), Geometry::Vector2D(0.0f, 2.0f));
+    EXPECT_EQ(snapshot.orientation(2), Geometry::Angle(-2.5f));
+    EXPECT_FLOAT_EQ(snapshot.angularSpeed(1), 1.25f);
+    EXPECT_EQ(snapshot.positions().size(), 3u);
+    EXPECT_FALSE(snapshot.isMirrored());
+}
+
+TEST(Common_WorldSnapshot_Test, GivenAnObject_Add_ShouldCopyItsState){
+    const Object object(Geometry::Vector2D(2.0f, 1.0f), Geometry::Vector2D(1.0f, 1.0f), Geometry::Vector2D(0.0f, -1.0f),
+                        Geometry::Angle(1.0f), 3.0f);
+    WorldSnapshot snapshot;
+
+    EXPECT_EQ(snapshot.add(object), 0u);
+    EXPECT_EQ(snapshot.position(0), object.getPosition());
+    EXPECT_EQ(snapshot.velocity(0), object.getVelocity());
+    EXPECT_EQ(snapshot.acceleration(0), object.getAcceleration());
+    EXPECT_EQ(snapshot.orientation(0), object.getOrientation());
+    EXPECT_FLOAT_EQ(snapshot.angularSpeed(0), object.getAngularSpeed());
+}
+
+TEST(Common_WorldSnapshot_Test, GivenLeftSide_ToCanonical_ShouldKeepTheSnapshot){
+    WorldSnapshot snapshot = makeSnapshot();
+    snapshot.toCanonical(Common::Enums::SIDE_LEFT);
+
+    EXPECT_FALSE(snapshot.isMirrored());
+    EXPECT_EQ(snapshot.position(0), Geometry::Vector2D(1.0f, -2.0f));
+    EXPECT_EQ(snapshot.orientation(1), Geometry::Angle(0.75f));
+}
+
+TEST(Common_WorldSnapshot_Test, GivenRightSide_ToCanonical_ShouldRotateTheWorldByPi){
+    WorldSnapshot snapshot = makeSnapshot();
+    snapshot.toCanonical(Common::Enums::SIDE_RIGHT);
+
+    EXPECT_TRUE(snapshot.isMirrored());
+    EXPECT_EQ(snapshot.position(0), Geometry::Vector2D(-1.0f, 2.0f));
+    EXPECT_EQ(snapshot.velocity(1), Geometry::Vector2D(1.0f, 0.0f));
+    EXPECT_EQ(snapshot.acceleration(1), Geometry::Vector2D(0.0f, -2.0f));
+    EXPECT_EQ(snapshot.orientation(1), Geometry::Angle(0.75f - Geometry::Angle::PI));
+    EXPECT_EQ(snapshot.orientation(2), Geometry::Angle(-2.5f + Geometry::Angle::PI));
+    EXPECT_FLOAT_EQ(snapshot.angularSpeed(1), 1.25f);
+
+    // Converting twice should not mirror again
+    snapshot.toCanonical(Common::Enums::SIDE_RIGHT);
+    EXPECT_EQ(snapshot.position(0), Geometry::Vector2D(-1.0f, 2.0f));
+}
+
+TEST(Common_WorldSnapshot_Test, GivenACanonicalSnapshot_ToField_ShouldRestoreTheExactValues){
+    const WorldSnapshot original = makeSnapshot();
+    WorldSnapshot snapshot = original;
+    snapshot.toCanonical(Common::Enums::SIDE_RIGHT);
+    snapshot.toField();
+
+    EXPECT_FALSE(snapshot.isMirrored());
+    EXPECT_EQ(snapshot.positions(), original.positions());
+    EXPECT_EQ(snapshot.velocities(), original.velocities());
+    EXPECT_EQ(snapshot.accelerations(), original.accelerations());
+    EXPECT_EQ(snapshot.orientations(), original.orientations());
+}
+
+TEST(Common_WorldSnapshot_Test, GivenManyOrientations_ConvertingBackAndForth_ShouldRestoreTheExactValues){
+    // Turning by PI and back rounds for most angles, e.g. 0.3f would come back as 0.29999995f
+    WorldSnapshot snapshot;
+    for(int i = -3000; i <= 3000; i++) {
+        snapshot.add(Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(0.0f, 0.0f),
+                     Geometry::Angle(i / 1000.0f));
+    }
+    const std::vector<float> original = snapshot.orientations();
+
+    for(int k = 0; k < 3; k++) {
+        snapshot.toCanonical(Common::Enums::SIDE_RIGHT);
+        snapshot.toField();
+    }
+    EXPECT_EQ(snapshot.orientations(), original);
+}
+
+TEST(Common_WorldSnapshot_Test, GivenACanonicalSnapshot_Add_ShouldConvertTheNewObject){
+    WorldSnapshot snapshot = makeSnapshot();
+    snapshot.toCanonical(Common::Enums::SIDE_RIGHT);
+    const size_t index = snapshot.add(Geometry::Vector2D(2.0f, 3.0f), Geometry::Vector2D(1.0f, 0.0f),
+                                      Geometry::Vector2D(0.0f, 0.0f), Geometry::Angle(0.5f));
+
+    EXPECT_EQ(snapshot.position(index), Geometry::Vector2D(-2.0f, -3.0f));
+    EXPECT_EQ(snapshot.orientation(index), Geometry::Angle(0.5f - Geometry::Angle::PI));
+
+    snapshot.toField();
+    EXPECT_EQ(snapshot.position(index), Geometry::Vector2D(2.0f, 3.0f));
+    EXPECT_EQ(snapshot.orientations()[index], Geometry::Angle(0.5f).value());
+}
+
+TEST(Common_WorldSnapshot_Test, GivenRightSide_CanonicalFrame_ShouldMatchTheCanonicalField){
+    const Field field(Common::Enums::SIDE_RIGHT, 500.0f, 9000.0f, 6000.0f, 180.0f, 1000.0f, 1000.0f, 2000.0f, 6000.0f);
+    const Field canonical = field.canonical();
+
+    WorldSnapshot snapshot;
+    snapshot.add(field.ourGoalCenter(), Geometry::Vector2D(0.0f, 0.0f));
+    snapshot.add(field.theirGoalLeftPost(), Geometry::Vector2D(0.0f, 0.0f));
+    snapshot.toCanonical(Common::Enums::SIDE_RIGHT);
+
+    EXPECT_TRUE(canonical.playingLeftSide());
+    EXPECT_EQ(snapshot.position(0), canonical.ourGoalCenter());
+    EXPECT_EQ(snapshot.position(1), canonical.theirGoalLeftPost());
+
+    // A target computed in the canonical frame goes back to the field frame through the transform
+    EXPECT_EQ(snapshot.toFieldTransform().apply(canonical.theirPenaltyMark()), field.theirPenaltyMark());
+}
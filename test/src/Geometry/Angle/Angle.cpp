@@ -27,6 +27,25 @@ TEST(Geometry_Angle_Tests, GivenAnAngle_Normalization_ShouldWork) {
     EXPECT_EQ(angleBase, referenceAngle2) << "Normalization does not work";
 }
 
+TEST(Geometry_Angle_Tests, GivenLargeOrBoundaryAngles_Normalization_ShouldWrapInRange) {
+    // Both ends of the range are kept, as an Arc from -π to π is a full circle
+    EXPECT_FLOAT_EQ(Geometry::Angle(Geometry::Angle::PI).value(), Geometry::Angle::PI);
+    EXPECT_FLOAT_EQ(Geometry::Angle(-Geometry::Angle::PI).value(), -Geometry::Angle::PI);
+
+    for(float value : {1e3f, -1e3f, 123456.0f, -98765.4f, 2 * Geometry::Angle::PI, -6 * Geometry::Angle::PI}) {
+        const float normalized = Geometry::Angle(value).value();
+        EXPECT_LE(normalized, Geometry::Angle::PI) << "for " << value;
+        EXPECT_GE(normalized, -Geometry::Angle::PI) << "for " << value;
+        EXPECT_NEAR(std::remainder(double(value) - normalized, 2 * M_PI), 0.0, 1e-7 * fabs(value) + 1e-6) << "for " << value;
+    }
+}
+
+TEST(Geometry_Angle_Tests, GivenTwoAngles_ShortestAngleDiff_ShouldGoAroundTheShortestWay) {
+    EXPECT_NEAR(Geometry::Angle(3.0f).shortestAngleDiff(Geometry::Angle(-3.0f)), 2 * Geometry::Angle::PI - 6.0f, 1e-6f);
+    EXPECT_NEAR(Geometry::Angle(-1.0f).shortestAngleDiff(Geometry::Angle(1.5f)), 2.5f, 1e-6f);
+    EXPECT_NEAR(Geometry::Angle(Geometry::Angle::PI).shortestAngleDiff(Geometry::Angle(-Geometry::Angle::PI)), 0.0f, 1e-6f);
+}
+
 TEST(Geometry_Angle_Tests, GivenAnAngle_RotationDirectionGetter_ShouldWork) {
     Geometry::Angle angleBase(0.0f);
 
@@ -70,3 +89,9 @@ TEST(Geometry_Angle_Tests, GivenAnAngle_Operators_ShouldWork) {
         EXPECT_EQ(angleBase, referenceAngle) << "Angles should match";
     }
 }
+
+TEST(Geometry_Angle_Tests, GivenConstantAngles_Normalization_ShouldBeEvaluatedAtCompileTime) {
+    constexpr Geometry::Angle angle = Geometry::Angle(Geometry::Angle::PI / 2) + Geometry::Angle(Geometry::Angle::PI);
+    static_assert(angle.value() < 0.0f && angle.value() > -Geometry::Angle::PI);
+    EXPECT_FLOAT_EQ(angle.value(), -Geometry::Angle::PI / 2);
+}
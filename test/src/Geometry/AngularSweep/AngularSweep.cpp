@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Geometry/AngularSweep/AngularSweep.h>
+
+#include <cmath>
+#include <random>
+
+namespace {
+    const Geometry::LineSegment goal(Geometry::Vector2D(4.5f, 0.5f), Geometry::Vector2D(4.5f, -0.5f));
+}
+
+TEST(Geometry_AngularSweep_Tests, GivenNoObstacles_Compute_ShouldReturnTheWholeTarget) {
+    Geometry::AngularSweep sweep;
+    const std::vector<Geometry::AngularSweep::Interval> &intervals = sweep.compute(Geometry::Vector2D(3.5f, 0.0f), goal, {});
+
+    ASSERT_EQ(intervals.size(), 1u);
+    EXPECT_EQ(intervals[0].from, Geometry::Vector2D(4.5f, -0.5f));
+    EXPECT_EQ(intervals[0].to, Geometry::Vector2D(4.5f, 0.5f));
+    EXPECT_FLOAT_EQ(intervals[0].width, 2.0f * std::atan(0.5f));
+    EXPECT_NEAR(intervals[0].direction.value(), 0.0f, 1e-6f);
+    EXPECT_EQ(sweep.bestAimPoint().value(), Geometry::Vector2D(4.5f, 0.0f));
+    EXPECT_FLOAT_EQ(sweep.freeWidth(), intervals[0].width);
+}
+
+TEST(Geometry_AngularSweep_Tests, GivenAnObstacleInFront_Compute_ShouldSplitTheTarget) {
+    Geometry::AngularSweep sweep;
+    const std::vector<Geometry::Circle> robots = {Geometry::Circle(Geometry::Vector2D(4.0f, 0.1f), 0.09f)};
+    const std::vector<Geometry::AngularSweep::Interval> &intervals = sweep.compute(Geometry::Vector2D(3.5f, 0.0f), goal, robots);
+
+    ASSERT_EQ(intervals.size(), 2u);
+    EXPECT_EQ(intervals[0].from, Geometry::Vector2D(4.5f, -0.5f));
+    EXPECT_EQ(intervals[1].to, Geometry::Vector2D(4.5f, 0.5f));
+    EXPECT_LT(intervals[0].to.y(), intervals[1].from.y());
+
+    // The shadow boundaries are tangent to the robot
+    const Geometry::LineSegment lowerTangent(Geometry::Vector2D(3.5f, 0.0f), intervals[0].to);
+    EXPECT_NEAR(lowerTangent.distanceToPoint(robots[0].center()), robots[0].radius(), 1e-4f);
+
+    // The robot is above the center, so the widest gap is the lower one
+    EXPECT_GT(intervals[0].width, intervals[1].width);
+    const Geometry::Vector2D aim = sweep.bestAimPoint().value();
+    EXPECT_LT(aim.y(), intervals[0].to.y());
+    EXPECT_GT(aim.y(), -0.5f);
+}
+
+TEST(Geometry_AngularSweep_Tests, GivenObstaclesBehindTheTarget_Compute_ShouldIgnoreThem) {
+    Geometry::AngularSweep sweep;
+    const std::vector<Geometry::Circle> robots = {Geometry::Circle(Geometry::Vector2D(4.8f, 0.0f), 0.09f)};
+
+    EXPECT_EQ(sweep.compute(Geometry::Vector2D(3.5f, 0.0f), goal, robots).size(), 1u);
+    EXPECT_FLOAT_EQ(sweep.freeWidth(), 2.0f * std::atan(0.5f));
+}
+
+TEST(Geometry_AngularSweep_Tests, GivenABlockedTarget_Compute_ShouldReturnNoIntervals) {
+    Geometry::AngularSweep sweep;
+
+    // Inside an obstacle
+    EXPECT_TRUE(sweep.compute(Geometry::Vector2D(3.5f, 0.0f), goal, {Geometry::Circle(Geometry::Vector2D(3.55f, 0.0f), 0.09f)}).empty());
+    // Covered by a large obstacle
+    EXPECT_TRUE(sweep.compute(Geometry::Vector2D(0.0f, 0.0f), goal, {Geometry::Circle(Geometry::Vector2D(1.0f, 0.0f), 0.5f)}).empty());
+    EXPECT_FALSE(sweep.largest().has_value());
+    EXPECT_FALSE(sweep.bestAimPoint().has_value());
+    // On the target line
+    EXPECT_TRUE(sweep.compute(Geometry::Vector2D(4.5f, 2.0f), goal, {}).empty());
+}
+
+TEST(Geometry_AngularSweep_Tests, GivenRandomScenes_Compute_ShouldMatchRaySampling) {
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> x(-1.0f, 3.9f), y(-3.0f, 3.0f);
+    Geometry::AngularSweep sweep;
+
+    for(int scene = 0; scene < 50; scene++) {
+        std::vector<Geometry::Circle> robots;
+        for(int i = 0; i < 16; i++) {
+            robots.emplace_back(Geometry::Vector2D(x(generator), y(generator)), 0.09f);
+        }
+        const Geometry::Vector2D origin(x(generator) - 2.0f, y(generator));
+        const std::vector<Geometry::AngularSweep::Interval> &intervals = sweep.compute(origin, goal, robots);
+
+        for(int sample = 0; sample <= 400; sample++) {
+            const Geometry::Vector2D point = goal.start() + (goal.end() - goal.start()) * (sample / 400.0f);
+            const Geometry::LineSegment ray(origin, point);
+            bool free = true;
+            for(const Geometry::Circle &robot : robots) {
+                free = free && !robot.doesIntersect(ray);
+            }
+
+            // Intervals hold the points between their ends, skipping samples too close to an end
+            bool inside = false, ambiguous = false;
+            for(const Geometry::AngularSweep::Interval &interval : intervals) {
+                const float low = std::min(interval.from.y(), interval.to.y()), high = std::max(interval.from.y(), interval.to.y());
+                inside = inside || (point.y() > low && point.y() < high);
+                ambiguous = ambiguous || std::abs(point.y() - low) < 1e-3f || std::abs(point.y() - high) < 1e-3f;
+            }
+            if(!ambiguous) {
+                EXPECT_EQ(inside, free) << "scene " << scene << ", sample " << sample;
+            }
+        }
+    }
+}
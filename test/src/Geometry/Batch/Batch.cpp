@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Geometry/Batch/Batch.h>
+
+#include <src/Geometry/GeometryTestUtils.h>
+
+using namespace GeometryTestUtils;
+
+namespace {
+    // Sizes around the SIMD widths, to exercise the remaining vectors
+    const std::vector<size_t> Counts = {0, 1, 3, 4, 7, 8, 9, 17, 200};
+}
+
+TEST(Geometry_Batch_Tests, GivenVectors_AddAndScale_ShouldMatchVector2D) {
+    for(Geometry::Batch::Kernel kernel : supportedKernels()) {
+        for(size_t count : Counts) {
+            SCOPED_TRACE("Kernel " + std::to_string(int(kernel)) + ", count " + std::to_string(count));
+            const std::vector<Geometry::Vector2D> a = randomFieldPoints(count, 1), b = randomFieldPoints(count, 2);
+            std::vector<Geometry::Vector2D> sum(count), scaled(count);
+            Geometry::Batch::add(a.data(), b.data(), sum.data(), count, kernel);
+            Geometry::Batch::scale(a.data(), -2.5f, scaled.data(), count, kernel);
+            for(size_t i = 0; i < count; i++) {
+                EXPECT_FLOAT_EQ(sum[i].x(), (a[i] + b[i]).x());
+                EXPECT_FLOAT_EQ(sum[i].y(), (a[i] + b[i]).y());
+                EXPECT_FLOAT_EQ(scaled[i].x(), a[i].scale(-2.5f).x());
+                EXPECT_FLOAT_EQ(scaled[i].y(), a[i].scale(-2.5f).y());
+            }
+        }
+    }
+}
+
+TEST(Geometry_Batch_Tests, GivenVectors_DotLengthAndDistance_ShouldMatchVector2D) {
+    const Geometry::Vector2D point(1.25f, -0.5f);
+    for(Geometry::Batch::Kernel kernel : supportedKernels()) {
+        for(size_t count : Counts) {
+            SCOPED_TRACE("Kernel " + std::to_string(int(kernel)) + ", count " + std::to_string(count));
+            const std::vector<Geometry::Vector2D> a = randomFieldPoints(count, 3), b = randomFieldPoints(count, 4);
+            std::vector<float> dots(count), lengths(count), distances(count);
+            Geometry::Batch::dot(a.data(), b.data(), dots.data(), count, kernel);
+            Geometry::Batch::length(a.data(), lengths.data(), count, kernel);
+            Geometry::Batch::dist(a.data(), point, distances.data(), count, kernel);
+            for(size_t i = 0; i < count; i++) {
+                EXPECT_FLOAT_EQ(dots[i], a[i].dotProduct(b[i]));
+                EXPECT_FLOAT_EQ(lengths[i], a[i].length());
+                EXPECT_FLOAT_EQ(distances[i], a[i].dist(point));
+            }
+        }
+    }
+}
+
+TEST(Geometry_Batch_Tests, GivenVectors_NormalizeAndRotate_ShouldMatchVector2D) {
+    for(Geometry::Batch::Kernel kernel : supportedKernels()) {
+        for(size_t count : Counts) {
+            SCOPED_TRACE("Kernel " + std::to_string(int(kernel)) + ", count " + std::to_string(count));
+            std::vector<Geometry::Vector2D> v = randomFieldPoints(count, 5);
+            if(count > 2) {
+                v[2] = Geometry::Vector2D(0.0f, 0.0f);
+            }
+            std::vector<Geometry::Vector2D> normalized(count), rotated(count);
+            Geometry::Batch::normalize(v.data(), normalized.data(), count, kernel);
+            Geometry::Batch::rotate(v.data(), 0.7f, rotated.data(), count, kernel);
+            for(size_t i = 0; i < count; i++) {
+                EXPECT_FLOAT_EQ(normalized[i].x(), v[i].normalize().x());
+                EXPECT_FLOAT_EQ(normalized[i].y(), v[i].normalize().y());
+                EXPECT_FLOAT_EQ(rotated[i].x(), v[i].rotate(0.7f).x());
+                EXPECT_FLOAT_EQ(rotated[i].y(), v[i].rotate(0.7f).y());
+            }
+        }
+    }
+}
+
+TEST(Geometry_Batch_Tests, GivenVectors_InPlaceOperations_ShouldWork) {
+    std::vector<Geometry::Vector2D> v = randomFieldPoints(13, 6);
+    const std::vector<Geometry::Vector2D> original = v;
+    Geometry::Batch::rotate(v.data(), 0.3f, v.data(), v.size());
+    Geometry::Batch::rotate(v.data(), -0.3f, v.data(), v.size());
+    for(size_t i = 0; i < v.size(); i++) {
+        EXPECT_NEAR(v[i].x(), original[i].x(), 1e-5f);
+        EXPECT_NEAR(v[i].y(), original[i].y(), 1e-5f);
+    }
+}
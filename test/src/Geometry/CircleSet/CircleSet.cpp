@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Geometry/CircleSet/CircleSet.h>
+
+#include <cmath>
+#include <limits>
+
+#include <src/Geometry/GeometryTestUtils.h>
+
+using namespace GeometryTestUtils;
+
+namespace {
+    std::vector<Geometry::LineSegment> randomPasses(size_t count, std::mt19937 &generator) {
+        std::vector<Geometry::LineSegment> passes;
+        for(size_t i = 0; i < count; i++) {
+            const std::vector<Geometry::Vector2D> ends = randomFieldPoints(2, generator);
+            passes.emplace_back(ends[0], ends[1]);
+        }
+
+        return passes;
+    }
+}
+
+TEST(Geometry_CircleSet_Tests, GivenAnEmptySet_Obstruction_ShouldNotBlock) {
+    const Geometry::CircleSet set;
+    const Geometry::LineSegment pass(Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(1.0f, 0.0f));
+
+    EXPECT_EQ(set.size(), 0u);
+    EXPECT_FALSE(set.isBlocked(pass));
+    EXPECT_FALSE(set.obstruction(pass).blocked);
+}
+
+TEST(Geometry_CircleSet_Tests, GivenFixedRadii_IsBlocked_ShouldMatchCircleDoesIntersect) {
+    std::mt19937 generator(1);
+    const std::vector<Geometry::Circle> robots = randomRobots(16, generator);
+    const Geometry::CircleSet set(robots);
+
+    int blocked = 0;
+    for(const Geometry::LineSegment &pass : randomPasses(200, generator)) {
+        bool expected = false;
+        for(const Geometry::Circle &robot : robots) {
+            expected = expected || robot.doesIntersect(pass);
+        }
+        for(Geometry::Batch::Kernel kernel : supportedKernels()) {
+            EXPECT_EQ(set.isBlocked(pass, kernel), expected);
+        }
+        blocked += expected;
+    }
+
+    // Both outcomes should be exercised
+    EXPECT_GT(blocked, 0);
+    EXPECT_LT(blocked, 200);
+}
+
+TEST(Geometry_CircleSet_Tests, GivenSeveralObstacles_Obstruction_ShouldReturnTheFirstOneReached) {
+    Geometry::CircleSet set;
+    set.add(Geometry::Circle(Geometry::Vector2D(3.0f, 0.05f), 0.1f));
+    set.add(Geometry::Circle(Geometry::Vector2D(1.0f, 2.0f), 0.1f));
+    set.add(Geometry::Circle(Geometry::Vector2D(2.0f, -0.05f), 0.1f));
+    set.add(Geometry::Circle(Geometry::Vector2D(-1.0f, 0.0f), 0.1f));
+
+    const Geometry::CircleSet::Obstruction obstruction = set.obstruction(
+        Geometry::LineSegment(Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(4.0f, 0.0f)));
+
+    EXPECT_TRUE(obstruction.blocked);
+    EXPECT_EQ(obstruction.index, 2u);
+    EXPECT_NEAR(obstruction.distance, 2.0f - std::sqrt(0.1f * 0.1f - 0.05f * 0.05f), 1e-5f);
+}
+
+TEST(Geometry_CircleSet_Tests, GivenOverlappingObstacles_Obstruction_ShouldReturnTheFirstOneEntered) {
+    // The larger circle has its center farther along the segment, but the segment enters it first
+    Geometry::CircleSet set;
+    set.add(Geometry::Circle(Geometry::Vector2D(2.0f, 0.0f), 0.1f));
+    set.add(Geometry::Circle(Geometry::Vector2D(2.2f, 0.0f), 0.5f));
+
+    const Geometry::CircleSet::Obstruction obstruction = set.obstruction(
+        Geometry::LineSegment(Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(4.0f, 0.0f)));
+
+    EXPECT_TRUE(obstruction.blocked);
+    EXPECT_EQ(obstruction.index, 1u);
+    EXPECT_NEAR(obstruction.distance, 1.7f, 1e-5f);
+}
+
+TEST(Geometry_CircleSet_Tests, GivenGrowingRadii_Obstruction_ShouldBlockFartherAlongTheSegment) {
+    Geometry::CircleSet set;
+    set.add(Geometry::Circle(Geometry::Vector2D(1.0f, 0.5f), 0.1f), 0.2f);
+    set.add(Geometry::Circle(Geometry::Vector2D(4.0f, 0.5f), 0.1f), 0.2f);
+
+    // Only the circle reached later has grown enough to touch the segment
+    const Geometry::CircleSet::Obstruction obstruction = set.obstruction(
+        Geometry::LineSegment(Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(5.0f, 0.0f)));
+
+    EXPECT_TRUE(obstruction.blocked);
+    EXPECT_EQ(obstruction.index, 1u);
+    // Where the radius 0.1 + 0.2 * s reaches the distance to (4, 0.5)
+    EXPECT_NEAR(obstruction.distance, 3.401059f, 1e-4f);
+    EXPECT_FLOAT_EQ(set.circle(1).radius(), 0.1f);
+}
+
+TEST(Geometry_CircleSet_Tests, GivenGrowingRadii_Obstruction_ShouldTestWhereTheCircleComesClosest) {
+    // The grown radius never covers the projection of the center, at the segment start, but it
+    // touches the segment a little farther along it
+    Geometry::CircleSet set;
+    set.add(Geometry::Circle(Geometry::Vector2D(0.0f, 1.0f), 0.9f), 0.5f);
+    const Geometry::LineSegment pass(Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(10.0f, 0.0f));
+
+    for(Geometry::Batch::Kernel kernel : supportedKernels()) {
+        EXPECT_TRUE(set.isBlocked(pass, kernel));
+        const Geometry::CircleSet::Obstruction obstruction = set.obstruction(pass, kernel);
+        EXPECT_TRUE(obstruction.blocked);
+        EXPECT_NEAR(obstruction.distance, 0.2734f, 1e-3f);
+    }
+}
+
+TEST(Geometry_CircleSet_Tests, GivenGrowingRadii_Obstruction_ShouldMatchSamplingTheSegment) {
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<float> growth(0.0f, 1.5f);
+    Geometry::CircleSet set;
+    std::vector<Geometry::Circle> robots = randomRobots(24, generator);
+    std::vector<float> growths;
+    for(const Geometry::Circle &robot : robots) {
+        growths.push_back(growth(generator));
+        set.add(robot, growths.back());
+    }
+
+    // Distance along the pass at which the samples first fall inside the circle i, if any
+    const int samples = 20000;
+    auto sampledEntry = [&](const Geometry::LineSegment &pass, size_t i, float margin) {
+        const float length = pass.length();
+        for(int k = 0; k <= samples; k++) {
+            const float s = length * k / samples;
+            const Geometry::Vector2D point = pass.start() + (pass.end() - pass.start()) * (float(k) / samples);
+            if(point.dist(robots[i].center()) <= robots[i].radius() + growths[i] * s + margin) {
+                return s;
+            }
+        }
+
+        return std::numeric_limits<float>::infinity();
+    };
+
+    int blocked = 0;
+    for(const Geometry::LineSegment &pass : randomPasses(100, generator)) {
+        // The samples are one step apart, so they may miss a touch by up to half of a step
+        const float step = pass.length() / samples;
+        float first = std::numeric_limits<float>::infinity();
+        for(size_t i = 0; i < robots.size(); i++) {
+            first = std::min(first, sampledEntry(pass, i, 0.0f));
+        }
+
+        for(Geometry::Batch::Kernel kernel : supportedKernels()) {
+            const Geometry::CircleSet::Obstruction obstruction = set.obstruction(pass, kernel);
+            EXPECT_EQ(set.isBlocked(pass, kernel), obstruction.blocked);
+            if(first < std::numeric_limits<float>::infinity()) {
+                ASSERT_TRUE(obstruction.blocked);
+            }
+            if(obstruction.blocked) {
+                EXPECT_LE(sampledEntry(pass, obstruction.index, step), obstruction.distance + step);
+                EXPECT_LE(obstruction.distance, first + 1e-4f);
+            }
+        }
+        blocked += (first < std::numeric_limits<float>::infinity());
+    }
+
+    // Both outcomes should be exercised
+    EXPECT_GT(blocked, 0);
+    EXPECT_LT(blocked, 100);
+}
+
+TEST(Geometry_CircleSet_Tests, GivenAllKernels_Obstructions_ShouldBeIdentical) {
+    std::mt19937 generator(2);
+    std::uniform_real_distribution<float> growth(0.0f, 0.3f);
+    Geometry::CircleSet set;
+    for(const Geometry::Circle &robot : randomRobots(37, generator)) {
+        set.add(robot, growth(generator));
+    }
+    const std::vector<Geometry::LineSegment> passes = randomPasses(200, generator);
+
+    std::vector<Geometry::CircleSet::Obstruction> expected(passes.size());
+    set.obstructions(passes.data(), expected.data(), passes.size(), Geometry::Batch::Kernel::Scalar);
+    for(Geometry::Batch::Kernel kernel : supportedKernels()) {
+        std::vector<Geometry::CircleSet::Obstruction> result(passes.size());
+        set.obstructions(passes.data(), result.data(), passes.size(), kernel);
+        for(size_t i = 0; i < passes.size(); i++) {
+            EXPECT_EQ(result[i].blocked, expected[i].blocked);
+            EXPECT_EQ(result[i].index, expected[i].index);
+            EXPECT_FLOAT_EQ(result[i].distance, expected[i].distance);
+        }
+    }
+}
+
+TEST(Geometry_CircleSet_Tests, GivenAPointSegment_Obstruction_ShouldTestTheCircleContainment) {
+    Geometry::CircleSet set;
+    set.add(Geometry::Circle(Geometry::Vector2D(0.0f, 0.0f), 1.0f));
+    const Geometry::Vector2D inside(0.5f, 0.5f), outside(1.0f, 1.0f);
+
+    EXPECT_TRUE(set.isBlocked(Geometry::LineSegment(inside, inside)));
+    EXPECT_FALSE(set.isBlocked(Geometry::LineSegment(outside, outside)));
+}
@@ -0,0 +1,58 @@
+#ifndef GEOMETRYTESTUTILS_H
+#define GEOMETRYTESTUTILS_H
+
+#include <Armorial/Common/Types/Field/Field.h>
+#include <Armorial/Geometry/Batch/Batch.h>
+#include <Armorial/Geometry/Circle/Circle.h>
+#include <Armorial/Geometry/Vector2D/Vector2D.h>
+
+#include <random>
+#include <vector>
+
+namespace GeometryTestUtils {
+    // Builds a 9000 x 6000 mm field with the given side
+    inline Common::Types::Field makeField(Common::Enums::Side side = Common::Enums::SIDE_LEFT) {
+        return Common::Types::Field(side, 500.0f, 9000.0f, 6000.0f, 180.0f, 1000.0f, 1000.0f, 2000.0f, 6000.0f);
+    }
+
+    // Builds points uniformly distributed over a 9 x 6 field, x in [-4.5, 4.5] and y in [-3, 3]
+    inline std::vector<Geometry::Vector2D> randomFieldPoints(size_t count, std::mt19937 &generator) {
+        std::uniform_real_distribution<float> x(-4.5f, 4.5f), y(-3.0f, 3.0f);
+        std::vector<Geometry::Vector2D> points;
+        for(size_t i = 0; i < count; i++) {
+            points.emplace_back(x(generator), y(generator));
+        }
+
+        return points;
+    }
+
+    inline std::vector<Geometry::Vector2D> randomFieldPoints(size_t count, unsigned seed) {
+        std::mt19937 generator(seed);
+        return randomFieldPoints(count, generator);
+    }
+
+    // Builds robots of radius 0.09 at random field points
+    inline std::vector<Geometry::Circle> randomRobots(size_t count, std::mt19937 &generator) {
+        std::vector<Geometry::Circle> robots;
+        for(const Geometry::Vector2D &center : randomFieldPoints(count, generator)) {
+            robots.emplace_back(center, 0.09f);
+        }
+
+        return robots;
+    }
+
+    // Batch kernels supported by the running CPU, so every test covers all the ones it can run
+    inline std::vector<Geometry::Batch::Kernel> supportedKernels() {
+        std::vector<Geometry::Batch::Kernel> kernels;
+        for(Geometry::Batch::Kernel kernel : {Geometry::Batch::Kernel::Scalar, Geometry::Batch::Kernel::SSE,
+                                              Geometry::Batch::Kernel::AVX2}) {
+            if(Geometry::Batch::isKernelSupported(kernel)) {
+                kernels.push_back(kernel);
+            }
+        }
+
+        return kernels;
+    }
+}
+
+#endif // GEOMETRYTESTUTILS_H
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Geometry/KDTree/KDTree.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include <src/Geometry/GeometryTestUtils.h>
+
+using namespace GeometryTestUtils;
+
+namespace {
+    float squaredDistance(const Geometry::Vector2D &a, const Geometry::Vector2D &b) {
+        return (a.x() - b.x()) * (a.x() - b.x()) + (a.y() - b.y()) * (a.y() - b.y());
+    }
+
+    std::vector<size_t> sorted(std::vector<size_t> indices) {
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+}
+
+TEST(Geometry_KDTree_Tests, GivenAnEmptyTree_Queries_ShouldFindNothing) {
+    const Geometry::KDTree tree;
+
+    EXPECT_TRUE(tree.empty());
+    EXPECT_FALSE(tree.nearest(Geometry::Vector2D(0.0f, 0.0f)).has_value());
+    EXPECT_TRUE(tree.kNearest(Geometry::Vector2D(0.0f, 0.0f), 3).empty());
+    EXPECT_TRUE(tree.withinRadius(Geometry::Vector2D(0.0f, 0.0f), 10.0f).empty());
+}
+
+TEST(Geometry_KDTree_Tests, GivenPoints_Nearest_ShouldMatchBruteForce) {
+    for(size_t count : {1u, 7u, 16u, 200u}) {
+        const std::vector<Geometry::Vector2D> points = randomFieldPoints(count, 1);
+        const Geometry::KDTree tree(points);
+        EXPECT_EQ(tree.size(), count);
+
+        for(const Geometry::Vector2D &query : randomFieldPoints(100, 2)) {
+            const size_t expected = std::min_element(points.begin(), points.end(), [&](auto &a, auto &b) {
+                return squaredDistance(a, query) < squaredDistance(b, query);
+            }) - points.begin();
+            EXPECT_EQ(tree.nearest(query).value(), expected);
+        }
+    }
+}
+
+TEST(Geometry_KDTree_Tests, GivenPoints_KNearest_ShouldReturnTheClosestSortedByDistance) {
+    const std::vector<Geometry::Vector2D> points = randomFieldPoints(200, 3);
+    const Geometry::KDTree tree(points);
+
+    for(const Geometry::Vector2D &query : randomFieldPoints(50, 4)) {
+        std::vector<size_t> expected(points.size());
+        std::iota(expected.begin(), expected.end(), 0);
+        std::sort(expected.begin(), expected.end(), [&](size_t a, size_t b) {
+            return squaredDistance(points[a], query) < squaredDistance(points[b], query);
+        });
+        expected.resize(5);
+
+        EXPECT_EQ(tree.kNearest(query, 5), expected);
+    }
+
+    EXPECT_EQ(tree.kNearest(Geometry::Vector2D(0.0f, 0.0f), 500).size(), points.size());
+    EXPECT_TRUE(tree.kNearest(Geometry::Vector2D(0.0f, 0.0f), 0).empty());
+}
+
+TEST(Geometry_KDTree_Tests, GivenPoints_WithinRadius_ShouldMatchBruteForce) {
+    const std::vector<Geometry::Vector2D> points = randomFieldPoints(200, 5);
+    const Geometry::KDTree tree(points);
+
+    for(const Geometry::Vector2D &center : randomFieldPoints(50, 6)) {
+        std::vector<size_t> expected;
+        for(size_t i = 0; i < points.size(); i++) {
+            if(squaredDistance(points[i], center) <= 1.0f) {
+                expected.push_back(i);
+            }
+        }
+
+        EXPECT_EQ(sorted(tree.withinRadius(center, 1.0f)), expected);
+    }
+}
+
+TEST(Geometry_KDTree_Tests, GivenPoints_InRectangleAndPolygon_ShouldMatchBruteForce) {
+    const std::vector<Geometry::Vector2D> points = randomFieldPoints(200, 7);
+    const Geometry::KDTree tree(points);
+    const Geometry::Rectangle rectangle(Geometry::Vector2D(-1.0f, 2.0f), Geometry::Vector2D(2.5f, -0.5f));
+    const Geometry::Polygon polygon({Geometry::Vector2D(-3.0f, -2.0f), Geometry::Vector2D(3.0f, -1.0f),
+                                     Geometry::Vector2D(0.0f, 2.5f)});
+
+    std::vector<size_t> inRectangle, inPolygon;
+    for(size_t i = 0; i < points.size(); i++) {
+        if(rectangle.contains(points[i])) {
+            inRectangle.push_back(i);
+        }
+        if(polygon.contains(points[i])) {
+            inPolygon.push_back(i);
+        }
+    }
+
+    EXPECT_FALSE(inRectangle.empty());
+    EXPECT_EQ(sorted(tree.inRectangle(rectangle)), inRectangle);
+    EXPECT_EQ(sorted(tree.inPolygon(polygon)), inPolygon);
+}
+
+TEST(Geometry_KDTree_Tests, GivenDuplicatedPoints_Build_ShouldKeepEveryIndex) {
+    const std::vector<Geometry::Vector2D> points(20, Geometry::Vector2D(1.0f, 1.0f));
+    Geometry::KDTree tree(randomFieldPoints(50, 8));
+    tree.build(points);
+
+    EXPECT_EQ(tree.size(), points.size());
+    EXPECT_EQ(tree.withinRadius(Geometry::Vector2D(1.0f, 1.0f), 0.0f).size(), points.size());
+    EXPECT_EQ(tree.kNearest(Geometry::Vector2D(0.0f, 0.0f), 20).size(), points.size());
+}
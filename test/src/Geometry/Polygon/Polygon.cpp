@@ -5,6 +5,9 @@
 #include <spdlog/spdlog.h>
 #include <fmt/color.h>
 
+#include <cmath>
+#include <limits>
+
 std::vector<Geometry::Vector2D> polygonVertices = {Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(1.0f, 2.0f),
                                                    Geometry::Vector2D(2.0f, 0.0f), Geometry::Vector2D(4.0f, 0.0f),
                                                    Geometry::Vector2D(2.5f, -1.5f), Geometry::Vector2D(3.0f, -3.75f),
@@ -150,3 +153,124 @@ TEST(Geometry_Polygon_Tests, GivenAPolygon_IntersectionGetter_ShouldWork) {
                 << "Polygon intersections do not match";
     }
 }
+
+namespace {
+    float distanceToBoundary(const Geometry::Polygon &polygon, const Geometry::Vector2D &point) {
+        float distance = std::numeric_limits<float>::max();
+        for(size_t i = 0; i < polygon.amountOfVertices(); i++) {
+            distance = std::min(distance, polygon.edge(i).distanceToPoint(point));
+        }
+
+        return distance;
+    }
+
+    float signedArea(const Geometry::Polygon &polygon) {
+        float area = 0.0f;
+        for(size_t i = 0; i < polygon.amountOfVertices(); i++) {
+            const Geometry::Vector2D a = polygon[i], b = polygon[(i + 1) % polygon.amountOfVertices()];
+            area += a.x() * b.y() - b.x() * a.y();
+        }
+
+        return area / 2.0f;
+    }
+
+    // Expects the offset polygon to contain every point up to the distance from the original one, and none further than the tolerance
+    void expectInflation(const Geometry::Polygon &polygon, const Geometry::Polygon &inflated, float distance, float tolerance) {
+        for(float x = -4.0f; x <= 4.0f; x += 0.05f) {
+            for(float y = -4.0f; y <= 4.0f; y += 0.05f) {
+                const Geometry::Vector2D point(x, y);
+                const float pointDistance = polygon.contains(point) ? 0.0f : distanceToBoundary(polygon, point);
+                if(pointDistance < distance - 1e-3f) {
+                    EXPECT_TRUE(inflated.contains(point)) << "Point (" << x << ", " << y << ") should be inside the inflated polygon";
+                }
+                else if(pointDistance > tolerance + 1e-3f) {
+                    EXPECT_FALSE(inflated.contains(point)) << "Point (" << x << ", " << y << ") should be outside the inflated polygon";
+                }
+            }
+        }
+    }
+}
+
+TEST(Geometry_Polygon_Tests, GivenAPointSet_ConvexHull_ShouldWork) {
+    const Geometry::Polygon hull = Geometry::Polygon::convexHull({Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(2.0f, 2.0f),
+                                                                  Geometry::Vector2D(1.0f, 1.0f), Geometry::Vector2D(2.0f, 0.0f),
+                                                                  Geometry::Vector2D(1.0f, 0.0f), Geometry::Vector2D(0.0f, 2.0f),
+                                                                  Geometry::Vector2D(0.5f, 1.5f), Geometry::Vector2D(2.0f, 2.0f)});
+
+    ASSERT_EQ(hull.amountOfVertices(), 4) << "Interior, collinear and repeated points should not be in the hull";
+    EXPECT_FLOAT_EQ(signedArea(hull), 4.0f) << "Hull should be counter-clockwise and cover the points";
+    EXPECT_TRUE(hull.isConvex());
+    EXPECT_EQ(Geometry::Polygon::convexHull({Geometry::Vector2D(1.0f, 1.0f)}).amountOfVertices(), 1);
+}
+
+TEST(Geometry_Polygon_Tests, GivenAConvexPolygon_Offset_ShouldWork) {
+    const Geometry::Polygon square({Geometry::Vector2D(-1.0f, -1.0f), Geometry::Vector2D(-1.0f, 1.0f),
+                                    Geometry::Vector2D(1.0f, 1.0f), Geometry::Vector2D(1.0f, -1.0f)});
+
+    const Geometry::Polygon inflated = square.offset(0.5f, 16);
+    EXPECT_EQ(inflated.amountOfVertices(), 16) << "Each right-angled corner should be rounded with 4 segments";
+    expectInflation(square, inflated, 0.5f, 0.5f / cosf(Geometry::Angle::PI / 16.0f));
+
+    const Geometry::Polygon shrunk = square.offset(-0.5f);
+    EXPECT_EQ(shrunk.amountOfVertices(), 4);
+    EXPECT_NEAR(signedArea(shrunk), 1.0f, 1e-4f);
+    EXPECT_EQ(square.offset(-1.5f).amountOfVertices(), 0) << "Shrinking beyond the polygon should leave nothing";
+}
+
+TEST(Geometry_Polygon_Tests, GivenAConcavePolygon_Offset_ShouldWork) {
+    const Geometry::Polygon lShape({Geometry::Vector2D(-2.0f, -2.0f), Geometry::Vector2D(2.0f, -2.0f),
+                                    Geometry::Vector2D(2.0f, 0.0f), Geometry::Vector2D(0.0f, 0.0f),
+                                    Geometry::Vector2D(0.0f, 2.0f), Geometry::Vector2D(-2.0f, 2.0f)});
+
+    expectInflation(lShape, lShape.offset(0.3f, 32), 0.3f, 0.3f / cosf(Geometry::Angle::PI / 32.0f));
+}
+
+TEST(Geometry_Polygon_Tests, GivenASelfIntersectingStar_Offset_ShouldNotClipItAsConvex) {
+    // isConvex() accepts the star, whose turns all have the same sign
+    std::vector<Geometry::Vector2D> vertices;
+    for(size_t i = 0; i < 5; i++) {
+        const float angle = Geometry::Angle::PI / 2.0f + 4.0f * Geometry::Angle::PI * i / 5;
+        vertices.emplace_back(3.0f * cosf(angle), 3.0f * sinf(angle));
+    }
+    const Geometry::Polygon star(vertices);
+    EXPECT_TRUE(star.isConvex());
+    EXPECT_FALSE(Geometry::Polygon::isConvexFan(vertices));
+
+    // Intersecting the half-planes of its edges would only leave a pentagon around the center
+    const Geometry::Polygon shrunk = star.offset(-0.1f);
+    ASSERT_GE(shrunk.amountOfVertices(), 5);
+    float farthest = 0.0f;
+    for(const Geometry::Vector2D &vertex : shrunk.vertices()) {
+        farthest = std::max(farthest, vertex.length());
+    }
+    EXPECT_GT(farthest, 2.0f) << "The tips of the star should be kept";
+}
+
+TEST(Geometry_Polygon_Tests, GivenAPolygonAndADisk_MinkowskiSum_ShouldWork) {
+    const Geometry::Polygon triangle({Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(1.0f, 0.0f), Geometry::Vector2D(0.0f, 1.0f)});
+    const Geometry::Polygon offset = triangle.offset(0.2f);
+    const Geometry::Polygon sum = triangle.minkowskiSum(Geometry::Circle(Geometry::Vector2D(1.0f, -1.0f), 0.2f));
+
+    ASSERT_EQ(sum.amountOfVertices(), offset.amountOfVertices());
+    for(size_t i = 0; i < sum.amountOfVertices(); i++) {
+        EXPECT_EQ(sum[i], offset[i] + Geometry::Vector2D(1.0f, -1.0f));
+    }
+}
+
+TEST(Geometry_Polygon_Tests, GivenTwoPolygons_Clip_ShouldWork) {
+    const Geometry::Polygon square({Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(2.0f, 0.0f),
+                                    Geometry::Vector2D(2.0f, 2.0f), Geometry::Vector2D(0.0f, 2.0f)});
+    const Geometry::Polygon clockwiseSquare({Geometry::Vector2D(1.0f, 1.0f), Geometry::Vector2D(1.0f, 3.0f),
+                                             Geometry::Vector2D(3.0f, 3.0f), Geometry::Vector2D(3.0f, 1.0f)});
+    const Geometry::Polygon farSquare({Geometry::Vector2D(5.0f, 5.0f), Geometry::Vector2D(6.0f, 5.0f),
+                                       Geometry::Vector2D(6.0f, 6.0f), Geometry::Vector2D(5.0f, 6.0f)});
+
+    const Geometry::Polygon overlap = square.clip(clockwiseSquare);
+    EXPECT_EQ(overlap.amountOfVertices(), 4);
+    EXPECT_NEAR(signedArea(overlap), 1.0f, 1e-4f);
+    EXPECT_TRUE(overlap.contains(Geometry::Vector2D(1.5f, 1.5f)));
+    EXPECT_EQ(square.clip(farSquare).amountOfVertices(), 0);
+
+    // A concave subject clipped by a convex one
+    EXPECT_NEAR(fabsf(signedArea(polygonBase.clip(square))), 2.0f, 1e-4f);
+}
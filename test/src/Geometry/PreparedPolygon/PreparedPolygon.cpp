@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Geometry/PreparedPolygon/PreparedPolygon.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace {
+    std::vector<Geometry::Vector2D> randomPoints(size_t count, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> x(-5.0f, 5.0f), y(-5.0f, 5.0f);
+        std::vector<Geometry::Vector2D> points;
+        for(size_t i = 0; i < count; i++) {
+            points.emplace_back(x(generator), y(generator));
+        }
+
+        return points;
+    }
+
+    std::vector<Geometry::Vector2D> regularPolygon(size_t sides, float radius, bool clockwise) {
+        std::vector<Geometry::Vector2D> vertices;
+        for(size_t i = 0; i < sides; i++) {
+            const float angle = (clockwise ? -2.0f : 2.0f) * static_cast<float>(M_PI) * i / sides;
+            vertices.emplace_back(radius * std::cos(angle) + 0.5f, radius * std::sin(angle) - 0.25f);
+        }
+
+        return vertices;
+    }
+
+    // Points too close to the boundary may be classified either way by both tests
+    bool nearBoundary(const Geometry::Polygon &polygon, const Geometry::Vector2D &point) {
+        for(size_t i = 0; i < polygon.amountOfVertices(); i++) {
+            if(polygon.edge(i).distanceToPoint(point) < 1e-3f) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void expectSameContainment(const Geometry::Polygon &polygon, const Geometry::PreparedPolygon &prepared) {
+        const std::vector<Geometry::Vector2D> points = randomPoints(2000, 7);
+        std::unique_ptr<bool[]> batch(new bool[points.size()]);
+        prepared.contains(points.data(), batch.get(), points.size());
+
+        for(size_t i = 0; i < points.size(); i++) {
+            if(nearBoundary(polygon, points[i])) {
+                continue;
+            }
+            EXPECT_EQ(prepared.contains(points[i]), polygon.contains(points[i])) << "Containment of point " << i << " does not match";
+            EXPECT_EQ(batch[i], polygon.contains(points[i])) << "Batch containment of point " << i << " does not match";
+        }
+    }
+}
+
+TEST(Geometry_PreparedPolygon_Tests, GivenAConcavePolygon_Containment_ShouldMatchPolygon) {
+    const Geometry::Polygon polygon({Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(1.0f, 2.0f),
+                                     Geometry::Vector2D(2.0f, 0.0f), Geometry::Vector2D(4.0f, 0.0f),
+                                     Geometry::Vector2D(2.5f, -1.5f), Geometry::Vector2D(3.0f, -3.75f),
+                                     Geometry::Vector2D(1.0f, -2.5f), Geometry::Vector2D(-1.0f, -3.75f),
+                                     Geometry::Vector2D(-0.5f, -1.5f), Geometry::Vector2D(-2.0f, 0.0f)});
+    const Geometry::PreparedPolygon prepared(polygon);
+
+    EXPECT_FALSE(prepared.isConvex());
+    expectSameContainment(polygon, prepared);
+}
+
+TEST(Geometry_PreparedPolygon_Tests, GivenConvexPolygons_Containment_ShouldMatchPolygon) {
+    for(const bool clockwise : {false, true}) {
+        for(const size_t sides : {3u, 4u, 7u, 32u}) {
+            const Geometry::Polygon polygon(regularPolygon(sides, 3.0f, clockwise));
+            const Geometry::PreparedPolygon prepared(polygon);
+
+            EXPECT_TRUE(prepared.isConvex()) << "Regular polygon with " << sides << " sides should be convex";
+            expectSameContainment(polygon, prepared);
+        }
+    }
+}
+
+TEST(Geometry_PreparedPolygon_Tests, GivenASelfIntersectingStar_Containment_ShouldMatchPolygon) {
+    std::vector<Geometry::Vector2D> vertices;
+    for(size_t i = 0; i < 5; i++) {
+        const float angle = static_cast<float>(M_PI) / 2.0f + 4.0f * static_cast<float>(M_PI) * i / 5;
+        vertices.emplace_back(3.0f * std::cos(angle), 3.0f * std::sin(angle));
+    }
+    const Geometry::Polygon polygon(vertices);
+    const Geometry::PreparedPolygon prepared(polygon);
+
+    EXPECT_FALSE(prepared.isConvex());
+    EXPECT_EQ(prepared.contains(Geometry::Vector2D(0.0f, 0.0f)), polygon.contains(Geometry::Vector2D(0.0f, 0.0f)));
+    EXPECT_EQ(prepared.contains(Geometry::Vector2D(0.0f, 2.4f)), polygon.contains(Geometry::Vector2D(0.0f, 2.4f)));
+    expectSameContainment(polygon, prepared);
+}
+
+TEST(Geometry_PreparedPolygon_Tests, GivenAPolygon_CachedProperties_ShouldMatchPolygon) {
+    const Geometry::Polygon polygon(regularPolygon(6, 2.0f, false));
+    const Geometry::PreparedPolygon prepared(polygon);
+
+    EXPECT_FLOAT_EQ(prepared.area(), polygon.area());
+    EXPECT_FLOAT_EQ(prepared.perimeterLength(), polygon.perimeterLength());
+    EXPECT_EQ(prepared.centroid(), polygon.centroid());
+    EXPECT_FLOAT_EQ(prepared.boundingBox().topLeft().x(), -1.5f);
+    EXPECT_FLOAT_EQ(prepared.boundingBox().bottomRight().x(), 2.5f);
+}
+
+TEST(Geometry_PreparedPolygon_Tests, GivenAPolygon_BoundaryQueries_ShouldMatchPolygon) {
+    const Geometry::Polygon polygon({Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(2.0f, 0.0f),
+                                     Geometry::Vector2D(2.0f, 2.0f), Geometry::Vector2D(0.0f, 2.0f)});
+    const Geometry::PreparedPolygon prepared(polygon);
+
+    EXPECT_TRUE(prepared.isOnBoundary(Geometry::Vector2D(1.0f, 0.0f)));
+    EXPECT_TRUE(prepared.isOnBoundary(Geometry::Vector2D(2.0f, 2.0f)));
+    EXPECT_FALSE(prepared.isOnBoundary(Geometry::Vector2D(1.0f, 1.0f)));
+    EXPECT_FALSE(prepared.isOnBoundary(Geometry::Vector2D(5.0f, 0.0f)));
+
+    EXPECT_TRUE(prepared.doesIntersect(Geometry::LineSegment(Geometry::Vector2D(1.0f, 1.0f), Geometry::Vector2D(3.0f, 1.0f))));
+    EXPECT_FALSE(prepared.doesIntersect(Geometry::LineSegment(Geometry::Vector2D(0.5f, 0.5f), Geometry::Vector2D(1.5f, 1.5f))));
+    EXPECT_FALSE(prepared.doesIntersect(Geometry::LineSegment(Geometry::Vector2D(3.0f, 0.0f), Geometry::Vector2D(3.0f, 2.0f))));
+}
+
+TEST(Geometry_PreparedPolygon_Tests, GivenAnEmptyPolygon_Containment_ShouldBeFalse) {
+    const Geometry::PreparedPolygon prepared;
+
+    EXPECT_FALSE(prepared.contains(Geometry::Vector2D(0.0f, 0.0f)));
+    EXPECT_FALSE(prepared.isOnBoundary(Geometry::Vector2D(0.0f, 0.0f)));
+}
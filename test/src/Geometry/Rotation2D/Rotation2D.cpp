@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Geometry/Rotation2D/Rotation2D.h>
+
+#include <random>
+
+TEST(Geometry_Rotation2D_Tests, GivenARotation_RotatingVectors_ShouldMatchVector2D) {
+    const Geometry::Rotation2D rotation(Geometry::Angle(0.7f));
+    const Geometry::Vector2D vector(1.5f, -2.0f), pivot(-1.0f, 3.0f);
+
+    EXPECT_EQ(rotation.rotate(vector), vector.rotate(0.7f));
+    EXPECT_EQ(rotation * vector, vector.rotate(0.7f));
+    EXPECT_EQ(rotation.rotateAround(vector, pivot), (vector - pivot).rotate(0.7f) + pivot);
+    EXPECT_FLOAT_EQ(rotation.angle().value(), 0.7f);
+}
+
+TEST(Geometry_Rotation2D_Tests, GivenTwoRotations_Composition_ShouldAddTheirAngles) {
+    const Geometry::Rotation2D a(Geometry::Angle(2.5f)), b(Geometry::Angle(1.5f));
+
+    EXPECT_EQ((a * b).angle(), Geometry::Angle(4.0f));
+    EXPECT_EQ((a * a.inverse()).angle(), Geometry::Angle(0.0f));
+    EXPECT_FLOAT_EQ((a * a.inverse()).cos(), 1.0f);
+}
+
+TEST(Geometry_Rotation2D_Tests, GivenManyCompositions_Normalized_ShouldRestoreUnitLength) {
+    const Geometry::Rotation2D step(Geometry::Angle(0.001f));
+    Geometry::Rotation2D rotation;
+    for(int i = 0; i < 10000; i++) {
+        rotation = rotation * step;
+    }
+
+    const Geometry::Rotation2D normalized = rotation.normalized();
+    EXPECT_NEAR(normalized.cos() * normalized.cos() + normalized.sin() * normalized.sin(), 1.0f, 1e-6f);
+    EXPECT_EQ(normalized.angle(), Geometry::Angle(10.0f));
+}
+
+TEST(Geometry_Rotation2D_Tests, GivenADirection_FromDirection_ShouldTakeTheXAxisToIt) {
+    const Geometry::Rotation2D rotation = Geometry::Rotation2D::fromDirection(Geometry::Vector2D(0.0f, 3.0f));
+    EXPECT_EQ(rotation.rotate(Geometry::Vector2D(2.0f, 0.0f)), Geometry::Vector2D(0.0f, 2.0f));
+
+    const Geometry::Rotation2D identity = Geometry::Rotation2D::fromDirection(Geometry::Vector2D(0.0f, 0.0f));
+    EXPECT_FLOAT_EQ(identity.cos(), 1.0f);
+    EXPECT_FLOAT_EQ(identity.sin(), 0.0f);
+}
+
+TEST(Geometry_Rotation2D_Tests, GivenAnArray_Rotate_ShouldRotateEachVector) {
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> distribution(-5.0f, 5.0f);
+    std::vector<Geometry::Vector2D> points;
+    for(int i = 0; i < 37; i++) {
+        points.emplace_back(distribution(generator), distribution(generator));
+    }
+
+    const Geometry::Rotation2D rotation(Geometry::Angle(-1.2f));
+    std::vector<Geometry::Vector2D> rotated(points.size());
+    rotation.rotate(points.data(), rotated.data(), points.size());
+    for(size_t i = 0; i < points.size(); i++) {
+        EXPECT_FLOAT_EQ(rotated[i].x(), rotation.rotate(points[i]).x());
+        EXPECT_FLOAT_EQ(rotated[i].y(), rotation.rotate(points[i]).y());
+    }
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Geometry/SweepAndPrune/SweepAndPrune.h>
+
+#include <src/Geometry/GeometryTestUtils.h>
+
+using namespace GeometryTestUtils;
+
+namespace {
+    std::vector<Geometry::SweptCircle> randomMovingRobots(size_t count, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> speed(-4.0f, 4.0f);
+        std::vector<Geometry::SweptCircle> robots;
+        for(const Geometry::Circle &robot : randomRobots(count, generator)) {
+            robots.emplace_back(robot, Geometry::Vector2D(speed(generator), speed(generator)));
+        }
+
+        return robots;
+    }
+}
+
+TEST(Geometry_SweepAndPrune_Tests, GivenNoCircles_Update_ShouldFindNothing) {
+    Geometry::SweepAndPrune sweep;
+
+    EXPECT_TRUE(sweep.update({}, 1.0f).empty());
+    EXPECT_FALSE(sweep.earliest().has_value());
+}
+
+TEST(Geometry_SweepAndPrune_Tests, GivenRandomRobots_Update_ShouldMatchAllPairs) {
+    Geometry::SweepAndPrune sweep;
+    for(unsigned seed = 1; seed <= 5; seed++) {
+        const std::vector<Geometry::SweptCircle> robots = randomMovingRobots(60, seed);
+        const std::vector<Geometry::SweepAndPrune::Collision> &collisions = sweep.update(robots, 0.5f);
+
+        std::vector<Geometry::SweepAndPrune::Collision> expected;
+        for(size_t i = 0; i < robots.size(); i++) {
+            for(size_t j = i + 1; j < robots.size(); j++) {
+                const std::optional<float> time = robots[i].collisionTime(robots[j], 0.5f);
+                if(time.has_value()) {
+                    expected.push_back({i, j, time.value()});
+                }
+            }
+        }
+
+        ASSERT_EQ(collisions.size(), expected.size()) << "Seed " << seed;
+        EXPECT_LT(sweep.candidates(), robots.size() * (robots.size() - 1) / 2) << "Broadphase should prune pairs";
+        for(size_t k = 0; k < collisions.size(); k++) {
+            const auto match = std::find_if(expected.begin(), expected.end(), [&](const Geometry::SweepAndPrune::Collision &collision) {
+                return collision.first == collisions[k].first && collision.second == collisions[k].second;
+            });
+            ASSERT_NE(match, expected.end()) << "Unexpected collision between " << collisions[k].first << " and " << collisions[k].second;
+            EXPECT_FLOAT_EQ(match->time, collisions[k].time);
+            if(k > 0) {
+                EXPECT_LE(collisions[k - 1].time, collisions[k].time) << "Collisions should be sorted by time";
+            }
+        }
+    }
+}
+
+TEST(Geometry_SweepAndPrune_Tests, GivenCrossingRobots_Earliest_ShouldBeTheFirstCollision) {
+    const std::vector<Geometry::SweptCircle> robots = {
+        Geometry::SweptCircle(Geometry::Circle(Geometry::Vector2D(-2.0f, 0.0f), 0.5f), Geometry::Vector2D(1.0f, 0.0f)),
+        Geometry::SweptCircle(Geometry::Circle(Geometry::Vector2D(2.0f, 0.0f), 0.5f), Geometry::Vector2D(-1.0f, 0.0f)),
+        Geometry::SweptCircle(Geometry::Circle(Geometry::Vector2D(0.0f, 3.0f), 0.5f), Geometry::Vector2D(0.0f, 0.0f)),
+        Geometry::SweptCircle(Geometry::Circle(Geometry::Vector2D(0.0f, 5.0f), 0.5f), Geometry::Vector2D(0.0f, -2.0f))};
+    Geometry::SweepAndPrune sweep;
+    sweep.update(robots, 1.6f);
+
+    ASSERT_EQ(sweep.collisions().size(), 2);
+    ASSERT_TRUE(sweep.earliest().has_value());
+    EXPECT_EQ(sweep.earliest()->first, 2);
+    EXPECT_EQ(sweep.earliest()->second, 3);
+    EXPECT_FLOAT_EQ(sweep.earliest()->time, 0.5f);
+    EXPECT_FLOAT_EQ(sweep.collisions()[1].time, 1.5f);
+}
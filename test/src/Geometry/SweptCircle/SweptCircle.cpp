@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Geometry/SweptCircle/SweptCircle.h>
+
+TEST(Geometry_SweptCircle_Tests, GivenASweptCircle_PositionAtTime_ShouldWork) {
+    const Geometry::SweptCircle circle(Geometry::Circle(Geometry::Vector2D(1.0f, 2.0f), 0.5f), Geometry::Vector2D(2.0f, -1.0f));
+
+    EXPECT_EQ(circle.at(0.0f).center(), Geometry::Vector2D(1.0f, 2.0f));
+    EXPECT_EQ(circle.at(1.5f).center(), Geometry::Vector2D(4.0f, 0.5f));
+    EXPECT_FLOAT_EQ(circle.at(1.5f).radius(), 0.5f);
+}
+
+TEST(Geometry_SweptCircle_Tests, GivenApproachingCircles_CollisionTime_ShouldWork) {
+    const Geometry::SweptCircle a(Geometry::Circle(Geometry::Vector2D(0.0f, 0.0f), 1.0f), Geometry::Vector2D(1.0f, 0.0f));
+    const Geometry::SweptCircle b(Geometry::Circle(Geometry::Vector2D(10.0f, 0.0f), 1.0f), Geometry::Vector2D(-1.0f, 0.0f));
+
+    EXPECT_FLOAT_EQ(a.timeOfClosestApproach(b), 5.0f);
+    EXPECT_NEAR(a.distanceAt(b, 5.0f), 0.0f, 1e-5f);
+    ASSERT_TRUE(a.collisionTime(b, 5.0f).has_value());
+    EXPECT_FLOAT_EQ(a.collisionTime(b, 5.0f).value(), 4.0f);
+    EXPECT_FLOAT_EQ(b.collisionTime(a, 5.0f).value(), 4.0f) << "Collision time should be symmetric";
+    EXPECT_FALSE(a.collisionTime(b, 3.0f).has_value()) << "Collision is beyond the horizon";
+}
+
+TEST(Geometry_SweptCircle_Tests, GivenFastRobotsBetweenFrames_CollisionTime_ShouldNotMissThem) {
+    // Both frames (t = 0 and t = 0.1) see the robots 5 units apart, but they cross in between
+    const Geometry::SweptCircle fast(Geometry::Circle(Geometry::Vector2D(0.0f, 0.0f), 0.09f), Geometry::Vector2D(100.0f, 0.0f));
+    const Geometry::Circle standing(Geometry::Vector2D(5.0f, 0.1f), 0.09f);
+
+    EXPECT_FALSE(fast.at(0.0f).contains(standing.center()));
+    EXPECT_FALSE(fast.at(0.1f).contains(standing.center()));
+    ASSERT_TRUE(fast.collisionTime(standing, 0.1f).has_value());
+    EXPECT_NEAR(fast.collisionTime(standing, 0.1f).value(), (5.0f - std::sqrt(0.18f * 0.18f - 0.01f)) / 100.0f, 1e-5f);
+}
+
+TEST(Geometry_SweptCircle_Tests, GivenNonApproachingCircles_CollisionTime_ShouldWork) {
+    const Geometry::SweptCircle a(Geometry::Circle(Geometry::Vector2D(0.0f, 0.0f), 1.0f), Geometry::Vector2D(1.0f, 1.0f));
+    const Geometry::SweptCircle together(Geometry::Circle(Geometry::Vector2D(5.0f, 0.0f), 1.0f), Geometry::Vector2D(1.0f, 1.0f));
+    const Geometry::SweptCircle away(Geometry::Circle(Geometry::Vector2D(5.0f, 0.0f), 1.0f), Geometry::Vector2D(3.0f, 0.0f));
+    const Geometry::SweptCircle passing(Geometry::Circle(Geometry::Vector2D(5.0f, 0.0f), 1.0f), Geometry::Vector2D(-1.0f, 4.0f));
+    const Geometry::SweptCircle overlapping(Geometry::Circle(Geometry::Vector2D(1.5f, 0.0f), 1.0f), Geometry::Vector2D(3.0f, 0.0f));
+
+    EXPECT_FLOAT_EQ(a.timeOfClosestApproach(together), 0.0f);
+    EXPECT_FALSE(a.collisionTime(together, 10.0f).has_value());
+    EXPECT_LT(a.timeOfClosestApproach(away), 0.0f);
+    EXPECT_FALSE(a.collisionTime(away, 10.0f).has_value());
+    EXPECT_FALSE(a.collisionTime(passing, 10.0f).has_value());
+    ASSERT_TRUE(a.collisionTime(overlapping, 10.0f).has_value());
+    EXPECT_FLOAT_EQ(a.collisionTime(overlapping, 10.0f).value(), 0.0f) << "Overlapping circles collide right away";
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Geometry/Transform2D/Transform2D.h>
+
+#include <random>
+
+TEST(Geometry_Transform2D_Tests, GivenAPose_Apply_ShouldMapBodyToWorldCoordinates) {
+    // A robot at (1, 2) facing +y: its front (+x in its frame) points to +y in the world
+    const Geometry::Transform2D bodyToWorld = Geometry::Transform2D::fromPose(Geometry::Vector2D(1.0f, 2.0f),
+                                                                              Geometry::Angle(Geometry::Angle::PI / 2));
+
+    EXPECT_EQ(bodyToWorld.apply(Geometry::Vector2D(0.09f, 0.0f)), Geometry::Vector2D(1.0f, 2.09f));
+    EXPECT_EQ(bodyToWorld * Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(1.0f, 2.0f));
+}
+
+TEST(Geometry_Transform2D_Tests, GivenATransform_Inverse_ShouldUndoIt) {
+    const Geometry::Transform2D transform = Geometry::Transform2D::fromPose(Geometry::Vector2D(-3.0f, 0.5f),
+                                                                            Geometry::Angle(2.2f));
+    const Geometry::Vector2D point(0.7f, -1.9f);
+
+    EXPECT_EQ(transform.inverse().apply(transform.apply(point)), point);
+    EXPECT_EQ((transform.inverse() * transform).apply(point), point);
+    EXPECT_EQ((transform.inverse() * transform).translation(), Geometry::Vector2D(0.0f, 0.0f));
+}
+
+TEST(Geometry_Transform2D_Tests, GivenTwoTransforms_Composition_ShouldApplyTheRightOneFirst) {
+    const Geometry::Transform2D a = Geometry::Transform2D::fromPose(Geometry::Vector2D(1.0f, 0.0f), Geometry::Angle(0.4f));
+    const Geometry::Transform2D b = Geometry::Transform2D::fromPose(Geometry::Vector2D(0.0f, -2.0f), Geometry::Angle(-1.1f));
+    const Geometry::Vector2D point(2.0f, 3.0f);
+
+    EXPECT_EQ((a * b).apply(point), a.apply(b.apply(point)));
+    EXPECT_EQ((a * b).rotation().angle(), Geometry::Angle(-0.7f));
+}
+
+TEST(Geometry_Transform2D_Tests, GivenAnArray_Apply_ShouldTransformEachPoint) {
+    std::mt19937 generator(2);
+    std::uniform_real_distribution<float> distribution(-0.1f, 0.1f);
+    std::vector<Geometry::Vector2D> footprint;
+    for(int i = 0; i < 21; i++) {
+        footprint.emplace_back(distribution(generator), distribution(generator));
+    }
+
+    const Geometry::Transform2D transform = Geometry::Transform2D::fromPose(Geometry::Vector2D(4.0f, -2.5f),
+                                                                            Geometry::Angle(0.9f));
+    std::vector<Geometry::Vector2D> world(footprint.size());
+    transform.apply(footprint.data(), world.data(), footprint.size());
+    for(size_t i = 0; i < footprint.size(); i++) {
+        EXPECT_FLOAT_EQ(world[i].x(), transform.apply(footprint[i]).x());
+        EXPECT_FLOAT_EQ(world[i].y(), transform.apply(footprint[i]).y());
+    }
+}
+
+TEST(Geometry_Transform2D_Tests, GivenConstantTransforms_Composition_ShouldBeEvaluatedAtCompileTime) {
+    constexpr Geometry::Transform2D identity;
+    constexpr Geometry::Transform2D shifted(Geometry::Rotation2D(), Geometry::Vector2D(1.0f, 2.0f));
+    constexpr Geometry::Vector2D point = (shifted * identity * shifted.inverse()).apply(Geometry::Vector2D(3.0f, 4.0f));
+
+    EXPECT_FLOAT_EQ(point.x(), 3.0f);
+    EXPECT_FLOAT_EQ(point.y(), 4.0f);
+}
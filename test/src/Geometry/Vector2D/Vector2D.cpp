@@ -94,6 +94,7 @@ TEST(Geometry_Vector2D_Tests, GivenAVector_RotationFromPoint_ShouldWork) {
     Geometry::Vector2D referencePoint(2.0f, 2.0f);
     EXPECT_EQ(vectorBase1.rotateAroundPoint(-Geometry::Angle::PI/2.0f, referencePoint), Geometry::Vector2D(0.0f, 4.0f)) << "Vector rotation from point do not match";
     EXPECT_EQ(vectorBase2.rotateAroundPoint(Geometry::Angle::PI, referencePoint), Geometry::Vector2D(3.0f, 3.0f)) << "Vector rotation from point do not match";
+    EXPECT_EQ(vectorBase2.rotateAroundPoint(Geometry::Angle::PI/2.0f, Geometry::Vector2D(2.0f, 0.0f)), Geometry::Vector2D(1.0f, -1.0f)) << "Vector rotation from point do not match";
 }
 
 TEST(Geometry_Vector2D_Tests, GivenAVector_ProjectionWithLine_ShouldWork) {
@@ -187,3 +188,20 @@ TEST(Geometry_Vector2D_Tests, GivenAVector_DivisionWithNullScalar_ShouldFail) {
     EXPECT_EQ(std::isinf(vectorDivision.x()), true);
     EXPECT_EQ(std::isinf(vectorDivision.y()), true);
 }
+
+TEST(Geometry_Vector2D_Tests, GivenConstantVectors_Arithmetic_ShouldBeEvaluatedAtCompileTime) {
+    // Declaring the results constexpr fails to compile unless they are evaluated at compile time
+    constexpr Geometry::Vector2D goal(4.5f, 0.0f);
+    constexpr Geometry::Vector2D penaltyMark = goal - Geometry::Vector2D(1.0f, 0.0f) * 3.0f;
+    constexpr float dot = goal.dotProduct(penaltyMark);
+    constexpr float midpointLength2 = goal.lerp(Geometry::Vector2D(), 0.5f).length2();
+    constexpr Geometry::Vector2D origin;
+
+    EXPECT_FLOAT_EQ(penaltyMark.x(), 1.5f);
+    EXPECT_FLOAT_EQ(penaltyMark.y(), 0.0f);
+    EXPECT_FLOAT_EQ(dot, 6.75f);
+    EXPECT_FLOAT_EQ(midpointLength2, 5.0625f);
+    EXPECT_FLOAT_EQ(origin.x(), 0.0f);
+    EXPECT_FLOAT_EQ(origin.y(), 0.0f);
+    EXPECT_FLOAT_EQ(penaltyMark.dist(goal), 3.0f);
+}
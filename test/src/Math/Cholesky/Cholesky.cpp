@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Math/Cholesky/Cholesky.h>
+#include <Armorial/Math/LU/LU.h>
+
+#include <random>
+
+#include <src/Math/MatrixTestUtils.h>
+
+using namespace MatrixTestUtils;
+
+TEST(Math_Cholesky_Test, When_Decomposing_A_Matrix_LLt_Should_Be_Equal_To_It) {
+    Math::Matrix matrix({{4, 12, -16},
+                         {12, 37, -43},
+                         {-16, -43, 98}});
+    Math::Cholesky cholesky(matrix);
+
+    ASSERT_TRUE(cholesky.isPositiveDefinite());
+    EXPECT_EQ(cholesky.L() == Math::Matrix({{2, 0, 0},
+                                            {6, 1, 0},
+                                            {-8, 5, 3}}), true);
+    EXPECT_FLOAT_EQ(cholesky.determinant(), 36.0f);
+}
+
+TEST(Math_Cholesky_Test, When_Solving_Should_Match_LU) {
+    std::mt19937 generator(42);
+    const unsigned size = 12;
+    Math::Matrix covariance = randomCovariance(size, generator);
+    Math::Matrix b(size, 1);
+    for(unsigned i = 0; i < size; i++) {
+        b.set(i, 0, float(i) - 5.0f);
+    }
+
+    Math::Cholesky cholesky(covariance);
+    ASSERT_TRUE(cholesky.isPositiveDefinite());
+    std::optional<Math::Matrix> x = cholesky.solve(b);
+    ASSERT_TRUE(x.has_value());
+
+    expectNear(x.value(), Math::LU(covariance).solve(b).value(), 1e-4f);
+    expectNear(covariance * x.value(), b, 1e-4f);
+    EXPECT_NEAR(cholesky.determinant() / Math::LU(covariance).determinant(), 1.0f, 1e-4f);
+}
+
+TEST(Math_Cholesky_Test, When_Inverting_Should_Give_Identity) {
+    std::mt19937 generator(7);
+    const unsigned size = 10;
+    Math::Matrix covariance = randomCovariance(size, generator);
+
+    std::optional<Math::Matrix> inverse = Math::Cholesky(covariance).inverse();
+    ASSERT_TRUE(inverse.has_value());
+    expectNear(covariance * inverse.value(), Math::Matrix::identity(size), 1e-4f);
+}
+
+TEST(Math_Cholesky_Test, When_Given_A_Badly_Scaled_Matrix_Should_Be_Positive_Definite) {
+    Math::Matrix matrix = Math::Matrix::diag(3, 1e4f);
+    matrix.set(2, 2, 1e-4f);
+    Math::Cholesky cholesky(matrix);
+
+    ASSERT_TRUE(cholesky.isPositiveDefinite());
+    EXPECT_NEAR(cholesky.determinant(), 1e4f, 1.0f);
+    std::optional<Math::Matrix> inverse = cholesky.inverse();
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_NEAR(inverse->get(2, 2), 1e4f, 1.0f);
+}
+
+TEST(Math_Cholesky_Test, When_Given_A_Non_Positive_Definite_Matrix_Should_Be_Detected) {
+    // Symmetric but indefinite (eigenvalues 3 and -1)
+    Math::Matrix indefinite({{1, 2},
+                             {2, 1}});
+    Math::Cholesky cholesky(indefinite);
+
+    EXPECT_FALSE(cholesky.isPositiveDefinite());
+    EXPECT_FLOAT_EQ(cholesky.determinant(), 0.0f);
+    EXPECT_FALSE(cholesky.solve(Math::Matrix(2, 1)).has_value());
+
+    // Positive semi-definite (singular) matrix
+    EXPECT_FALSE(Math::Cholesky(Math::Matrix({{1, 1}, {1, 1}})).isPositiveDefinite());
+}
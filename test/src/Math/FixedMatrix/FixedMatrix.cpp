@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Math/FixedMatrix/FixedMatrix.h>
+
+#include <cmath>
+#include <random>
+
+#include <src/Math/MatrixTestUtils.h>
+
+namespace {
+    template <unsigned R, unsigned C>
+    Math::FixedMatrix<R, C> randomFixedMatrix(std::mt19937 &generator) {
+        std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+        Math::FixedMatrix<R, C> matrix;
+        for(unsigned i = 0; i < R; i++) {
+            for(unsigned j = 0; j < C; j++) {
+                matrix(i, j) = distribution(generator);
+            }
+        }
+
+        return matrix;
+    }
+
+    template <unsigned R, unsigned C>
+    void expectNear(const Math::FixedMatrix<R, C> &A, const Math::FixedMatrix<R, C> &B, float tolerance) {
+        for(unsigned i = 0; i < R; i++) {
+            for(unsigned j = 0; j < C; j++) {
+                EXPECT_NEAR(A(i, j), B(i, j), tolerance) << "at (" << i << ", " << j << ")";
+            }
+        }
+    }
+
+    template <unsigned N>
+    void expectInverseGivesIdentity(std::mt19937 &generator) {
+        SCOPED_TRACE(testing::Message() << N << "x" << N << " inverse");
+        for(int test = 0; test < 20; test++) {
+            const Math::FixedMatrix<N, N> matrix = randomFixedMatrix<N, N>(generator);
+            const std::optional<Math::FixedMatrix<N, N>> inverse = matrix.inverse();
+            ASSERT_TRUE(inverse.has_value());
+            expectNear(matrix * inverse.value(), Math::FixedMatrix<N, N>::identity(), 1e-3f);
+
+            // Determinant should match the dynamic matrix one
+            EXPECT_NEAR(matrix.determinant() / matrix.toMatrix().determinant(), 1.0f, 1e-3f);
+        }
+    }
+
+    constexpr Math::FixedMatrix<2, 2> constantInverse() {
+        return Math::FixedMatrix<2, 2>({{4, 7},
+                                        {2, 6}}).inverse().value() * 10.0f;
+    }
+}
+
+TEST(Math_FixedMatrix_Test, When_Creating_A_FixedMatrix_Should_Initialize_Elements) {
+    Math::FixedMatrix<3, 4> zeros;
+    for(unsigned i = 0; i < zeros.lines(); i++) {
+        for(unsigned j = 0; j < zeros.columns(); j++) {
+            EXPECT_FLOAT_EQ(zeros.get(i, j), 0.0f);
+        }
+    }
+
+    Math::FixedMatrix<2, 3> matrix({{1, 2, 3},
+                                    {4, 5, 6}});
+    EXPECT_FLOAT_EQ(matrix.get(1, 2), 6.0f);
+    matrix.set(1, 2, 7.0f);
+    EXPECT_FLOAT_EQ(matrix(1, 2), 7.0f);
+    EXPECT_DEATH(matrix.get(2, 0), "Assertion*.*failed");
+
+    static_assert(sizeof(Math::FixedMatrix<6, 6>) == 36 * sizeof(float), "FixedMatrix should store elements inline");
+}
+
+TEST(Math_FixedMatrix_Test, When_Converting_From_And_To_Matrix_Should_Keep_Elements) {
+    Math::Matrix dynamic({{3, 1, -1},
+                          {2, -2, 0}});
+    Math::FixedMatrix<2, 3> fixed(dynamic);
+
+    EXPECT_FLOAT_EQ(fixed(0, 0), 3.0f);
+    EXPECT_FLOAT_EQ(fixed(1, 1), -2.0f);
+    EXPECT_EQ(fixed.toMatrix() == dynamic, true);
+    EXPECT_DEATH((Math::FixedMatrix<3, 3>(dynamic)), "Assertion*.*failed");
+}
+
+TEST(Math_FixedMatrix_Test, When_Using_Operators_Should_Match_Matrix) {
+    std::mt19937 generator(42);
+    const Math::FixedMatrix<4, 6> A = randomFixedMatrix<4, 6>(generator);
+    const Math::FixedMatrix<6, 2> B = randomFixedMatrix<6, 2>(generator);
+    const Math::FixedMatrix<4, 6> C = randomFixedMatrix<4, 6>(generator);
+
+    // The product kernels may round differently (e.g. fused multiply-adds in GEMM)
+    MatrixTestUtils::expectNear((A * B).toMatrix(), A.toMatrix() * B.toMatrix(), 1e-3f);
+    EXPECT_EQ((A + C).toMatrix() == A.toMatrix() + C.toMatrix(), true);
+    EXPECT_EQ((A - C).toMatrix() == A.toMatrix() - C.toMatrix(), true);
+    EXPECT_EQ(A.transposed().toMatrix() == A.toMatrix().transposed(), true);
+    EXPECT_EQ((A * 2.0f).toMatrix() == A.toMatrix() * 2.0f, true);
+    EXPECT_EQ((2.0f * A) == (A * 2.0f), true);
+    EXPECT_EQ((A / 2.0f).toMatrix() == A.toMatrix() / 2.0f, true);
+    EXPECT_EQ((A + 1.0f).toMatrix() == A.toMatrix() + 1.0f, true);
+    EXPECT_EQ((A - 1.0f).toMatrix() == A.toMatrix() - 1.0f, true);
+}
+
+TEST(Math_FixedMatrix_Test, When_Computing_Inverses_Should_Give_Identity) {
+    std::mt19937 generator(7);
+    expectInverseGivesIdentity<1>(generator);
+    expectInverseGivesIdentity<2>(generator);
+    expectInverseGivesIdentity<3>(generator);
+    expectInverseGivesIdentity<4>(generator);
+    expectInverseGivesIdentity<6>(generator);
+}
+
+TEST(Math_FixedMatrix_Test, When_Given_A_Singular_FixedMatrix_Inverse_Should_Fail) {
+    EXPECT_FALSE((Math::FixedMatrix<2, 2>({{3, 2},
+                                           {6, 4}}).inverse().has_value()));
+    EXPECT_FALSE((Math::FixedMatrix<3, 3>({{1, 2, 3},
+                                           {2, 4, 6},
+                                           {0, 1, 1}}).inverse().has_value()));
+    EXPECT_FALSE((Math::FixedMatrix<4, 4>({{1, 2, 3, 4},
+                                           {0, 1, 0, 1},
+                                           {2, 4, 6, 8},
+                                           {1, 0, 0, 1}}).inverse().has_value()));
+    EXPECT_FALSE((Math::FixedMatrix<5, 5>().inverse().has_value()));
+}
+
+TEST(Math_FixedMatrix_Test, When_Given_A_Tiny_Scaled_Identity_Inverse_Should_Succeed) {
+    const std::optional<Math::FixedMatrix<2, 2>> inverse2 = Math::FixedMatrix<2, 2>::diag(1e-8f).inverse();
+    ASSERT_TRUE(inverse2.has_value());
+    EXPECT_NEAR((*inverse2)(0, 0), 1e8f, 1e2f);
+
+    const std::optional<Math::FixedMatrix<4, 4>> inverse4 = Math::FixedMatrix<4, 4>::diag(1e-4f).inverse();
+    ASSERT_TRUE(inverse4.has_value());
+    EXPECT_NEAR((*inverse4)(3, 3), 1e4f, 1e-2f);
+
+    const std::optional<Math::FixedMatrix<6, 6>> inverse6 = Math::FixedMatrix<6, 6>::diag(1e-6f).inverse();
+    ASSERT_TRUE(inverse6.has_value());
+    EXPECT_NEAR((*inverse6)(5, 5), 1e6f, 1.0f);
+}
+
+TEST(Math_FixedMatrix_Test, When_Given_A_Badly_Scaled_FixedMatrix_Inverse_Should_Succeed) {
+    Math::FixedMatrix<4, 4> D4 = Math::FixedMatrix<4, 4>::identity();
+    D4(0, 0) = 1000.0f;
+    const std::optional<Math::FixedMatrix<4, 4>> inverse4 = D4.inverse();
+    ASSERT_TRUE(inverse4.has_value());
+    EXPECT_NEAR((*inverse4)(0, 0), 1e-3f, 1e-9f);
+    EXPECT_NEAR((*inverse4)(1, 1), 1.0f, 1e-6f);
+
+    Math::FixedMatrix<3, 3> D3 = Math::FixedMatrix<3, 3>::identity();
+    D3(0, 0) = 1e5f;
+    const std::optional<Math::FixedMatrix<3, 3>> inverse3 = D3.inverse();
+    ASSERT_TRUE(inverse3.has_value());
+    EXPECT_NEAR((*inverse3)(0, 0), 1e-5f, 1e-11f);
+
+    // Scaled lines of a well conditioned matrix, as in a covariance mixing millimetres and radians
+    const Math::FixedMatrix<3, 3> A({{4e3f, 1e3f, 0.0f},
+                                     {1.0f, 3.0f, 1.0f},
+                                     {0.0f, 1e-3f, 2e-3f}});
+    EXPECT_FALSE(A.isSingular());
+    const std::optional<Math::FixedMatrix<3, 3>> inverse = A.inverse();
+    const std::optional<Math::Matrix> reference = A.toMatrix().inverse();
+    ASSERT_TRUE(inverse.has_value());
+    ASSERT_TRUE(reference.has_value());
+    for(unsigned i = 0; i < 3; i++) {
+        for(unsigned j = 0; j < 3; j++) {
+            EXPECT_NEAR((*inverse)(i, j), reference->get(i, j), 1e-3f * std::fabs(reference->get(i, j)) + 1e-6f);
+        }
+    }
+
+    // Gauss-Jordan path
+    Math::FixedMatrix<6, 6> D6 = Math::FixedMatrix<6, 6>::diag(1e-3f);
+    D6(0, 0) = 1e4f;
+    const std::optional<Math::FixedMatrix<6, 6>> inverse6 = D6.inverse();
+    ASSERT_TRUE(inverse6.has_value());
+    EXPECT_NEAR((*inverse6)(5, 5), 1e3f, 1e-2f);
+}
+
+TEST(Math_FixedMatrix_Test, When_Given_A_Float_Rounded_Rank_One_FixedMatrix_Inverse_Should_Fail_As_LU) {
+    // u * vᵀ rounded to float, whose determinant is rounding noise instead of zero
+    const float u[3] = {0.1f, 0.7f, 0.3f}, v[3] = {0.9f, 0.2f, 0.6f};
+    Math::FixedMatrix<3, 3> A;
+    for(unsigned i = 0; i < 3; i++) {
+        for(unsigned j = 0; j < 3; j++) {
+            A(i, j) = u[i] * v[j];
+        }
+    }
+
+    EXPECT_FALSE(A.inverse().has_value());
+    EXPECT_FALSE(A.toMatrix().inverse().has_value());
+}
+
+TEST(Math_FixedMatrix_Test, When_Given_Constant_Matrixes_Should_Be_Computed_At_Compile_Time) {
+    constexpr Math::FixedMatrix<2, 2> inverse = constantInverse();
+    static_assert(inverse == Math::FixedMatrix<2, 2>({{6, -7},
+                                                      {-2, 4}}), "2x2 inverse should be constexpr");
+    static_assert(Math::FixedMatrix<1, 1>({{Math::FixedMatrix<3, 3>::diag(2.0f).determinant()}})
+                  == Math::FixedMatrix<1, 1>({{8.0f}}), "3x3 determinant should be constexpr");
+    static_assert((Math::FixedMatrix<2, 3>({{1, 2, 3}, {4, 5, 6}}) * Math::FixedVector<3>({{1}, {0}, {-1}}))
+                  == Math::FixedVector<2>({{-2}, {-2}}), "Products should be constexpr");
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Math/LU/LU.h>
+
+#include <random>
+
+#include <src/Math/MatrixTestUtils.h>
+
+using namespace MatrixTestUtils;
+
+TEST(Math_LU_Test, When_Decomposing_A_Matrix_PA_Should_Be_Equal_To_LU) {
+    std::mt19937 generator(42);
+    Math::Matrix matrix = randomMatrix(8, 8, generator);
+    Math::LU lu(matrix);
+
+    Math::Matrix permuted(8, 8);
+    for(unsigned i = 0; i < 8; i++) {
+        for(unsigned j = 0; j < 8; j++) {
+            permuted.set(i, j, matrix.get(lu.permutation()[i], j));
+        }
+    }
+
+    EXPECT_FALSE(lu.isSingular());
+    expectNear(lu.L() * lu.U(), permuted, 1e-4f);
+}
+
+TEST(Math_LU_Test, When_Given_A_Small_Pivot_Should_Still_Be_Accurate) {
+    // Gaussian elimination without pivoting loses all the precision on this system
+    Math::Matrix matrix({{1e-8f, 1.0f},
+                         {1.0f, 1.0f}});
+    Math::Matrix b(std::vector<std::vector<float>>{{1.0f},
+                                                   {2.0f}});
+
+    std::optional<Math::Matrix> x = Math::LU(matrix).solve(b);
+    ASSERT_TRUE(x.has_value());
+    EXPECT_NEAR(x->get(0, 0), 1.0f, 1e-6f);
+    EXPECT_NEAR(x->get(1, 0), 1.0f, 1e-6f);
+}
+
+TEST(Math_LU_Test, When_Solving_A_Large_System_Residual_Should_Be_Small) {
+    std::mt19937 generator(7);
+    const unsigned size = 30;
+    Math::Matrix A = randomMatrix(size, size, generator);
+    Math::Matrix B = randomMatrix(size, 3, generator);
+
+    std::optional<Math::Matrix> X = A.solve(B);
+    ASSERT_TRUE(X.has_value());
+    expectNear(A * X.value(), B, 1e-3f);
+}
+
+TEST(Math_LU_Test, When_Inverting_A_Large_Matrix_Should_Give_Identity) {
+    std::mt19937 generator(13);
+    const unsigned size = 20;
+    Math::Matrix A = randomMatrix(size, size, generator);
+
+    std::optional<Math::Matrix> inverse = A.inverse();
+    ASSERT_TRUE(inverse.has_value());
+    expectNear(A * inverse.value(), Math::Matrix::identity(size), 1e-4f);
+    expectNear(inverse.value() * A, Math::Matrix::identity(size), 1e-4f);
+}
+
+TEST(Math_LU_Test, When_Computing_Determinant_Should_Match_Known_Values) {
+    // Swapping two lines changes the sign of the determinant
+    Math::Matrix matrix({{0, 1, 0},
+                         {1, 0, 0},
+                         {0, 0, 1}});
+    EXPECT_FLOAT_EQ(Math::LU(matrix).determinant(), -1.0f);
+
+    // Triangular matrix determinant is the product of its diagonal
+    Math::Matrix triangular({{2, 7, 1},
+                             {0, 3, 9},
+                             {0, 0, 4}});
+    EXPECT_FLOAT_EQ(triangular.determinant(), 24.0f);
+
+    // Determinant of a scaled 10x10 identity
+    EXPECT_FLOAT_EQ(Math::Matrix::diag(10, 2.0f).determinant(), 1024.0f);
+}
+
+TEST(Math_LU_Test, When_Given_A_Singular_Matrix_Should_Be_Detected) {
+    // Third line is the sum of the first two
+    Math::Matrix matrix({{1, 2, 3},
+                         {4, 5, 6},
+                         {5, 7, 9}});
+    Math::LU lu(matrix);
+
+    EXPECT_TRUE(lu.isSingular());
+    EXPECT_NEAR(lu.determinant(), 0.0f, 1e-5f);
+    EXPECT_FALSE(lu.solve(Math::Matrix(3, 1)).has_value());
+    EXPECT_FALSE(lu.inverse().has_value());
+}
+
+TEST(Math_LU_Test, When_Given_A_Badly_Scaled_Matrix_Should_Not_Be_Singular) {
+    // Scaled diagonal: the small pivot is far above the rounding error of its own line and column
+    Math::LU diagonal(Math::Matrix({{1e4f, 0.0f},
+                                    {0.0f, 1e-3f}}));
+    EXPECT_FALSE(diagonal.isSingular());
+    EXPECT_NEAR(diagonal.determinant(), 10.0f, 1e-4f);
+    std::optional<Math::Matrix> inverse = diagonal.inverse();
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_NEAR(inverse->get(0, 0), 1e-4f, 1e-9f);
+    EXPECT_NEAR(inverse->get(1, 1), 1e3f, 1e-2f);
+
+    // Scaled lines of an invertible matrix
+    Math::LU lines(Math::Matrix({{1e4f, 1e4f},
+                                 {1e-3f, 2e-3f}}));
+    EXPECT_FALSE(lines.isSingular());
+    EXPECT_NEAR(lines.determinant(), 10.0f, 1e-3f);
+}
+
+TEST(Math_LU_Test, When_Given_A_NonSquare_Matrix_Should_Fail) {
+    Math::Matrix matrix(3, 2);
+
+    EXPECT_DEATH(Math::LU lu(matrix), "Assertion*.*failed");
+}
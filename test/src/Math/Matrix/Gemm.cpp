@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Math/Matrix/Matrix.h>
+#include <Armorial/Math/Matrix/impl/gemm_impl.h>
+
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace {
+    std::vector<float> randomBuffer(unsigned size, unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        std::vector<float> buffer(size);
+        for(auto &value : buffer) {
+            value = distribution(generator);
+        }
+
+        return buffer;
+    }
+
+    // Reference product in double precision, accumulated over the initial content of C
+    std::vector<double> referenceProduct(unsigned m, unsigned n, unsigned k, const std::vector<float> &A, unsigned lda,
+                                         const std::vector<float> &B, unsigned ldb, const std::vector<float> &C, unsigned ldc) {
+        std::vector<double> result(m * n);
+        for(unsigned i = 0; i < m; i++) {
+            for(unsigned j = 0; j < n; j++) {
+                double value = C[i * ldc + j];
+                for(unsigned p = 0; p < k; p++) {
+                    value += double(A[i * lda + p]) * double(B[p * ldb + j]);
+                }
+                result[i * n + j] = value;
+            }
+        }
+
+        return result;
+    }
+}
+
+class Math_Gemm_Test : public ::testing::TestWithParam<std::tuple<Math::impl::GemmKernel, unsigned, unsigned, unsigned>> {};
+
+TEST_P(Math_Gemm_Test, When_Multiplying_Should_Accumulate_The_Product_On_The_Result) {
+    const auto [kernel, m, n, k] = GetParam();
+    if(!Math::impl::isGemmKernelSupported(kernel)) {
+        GTEST_SKIP() << "Kernel not supported by this CPU";
+    }
+
+    // Padded line sizes, as in the Matrix buffers
+    const unsigned lda = k + 3, ldb = n + 5, ldc = n + 1;
+    const std::vector<float> A = randomBuffer(m * lda, 1);
+    const std::vector<float> B = randomBuffer(k * ldb, 2);
+    std::vector<float> C = randomBuffer(m * ldc, 3);
+    const std::vector<double> expected = referenceProduct(m, n, k, A, lda, B, ldb, C, ldc);
+
+    Math::impl::gemm(m, n, k, A.data(), lda, B.data(), ldb, C.data(), ldc, 1, kernel);
+
+    const double tolerance = 1e-5 * (k + 1);
+    for(unsigned i = 0; i < m; i++) {
+        for(unsigned j = 0; j < n; j++) {
+            EXPECT_NEAR(C[i * ldc + j], expected[i * n + j], tolerance) << "at (" << i << ", " << j << ")";
+        }
+        // The padding between lines should be untouched
+        EXPECT_FLOAT_EQ(C[i * ldc + n], randomBuffer(m * ldc, 3)[i * ldc + n]);
+    }
+}
+
+// Sizes around the tile and block dimensions of every micro-kernel
+INSTANTIATE_TEST_SUITE_P(Kernels, Math_Gemm_Test,
+                         ::testing::Combine(::testing::Values(Math::impl::GemmKernel::Scalar,
+                                                              Math::impl::GemmKernel::SSE,
+                                                              Math::impl::GemmKernel::AVX2),
+                                            ::testing::Values(1u, 5u, 6u, 13u, 97u),
+                                            ::testing::Values(1u, 8u, 17u, 33u, 515u),
+                                            ::testing::Values(1u, 7u, 257u)));
+
+TEST(Math_Gemm_Threads_Test, When_Splitting_Across_Threads_Should_Match_The_Single_Threaded_Result) {
+    const unsigned m = 300, n = 200, k = 100;
+    const std::vector<float> A = randomBuffer(m * k, 1);
+    const std::vector<float> B = randomBuffer(k * n, 2);
+    std::vector<float> single(m * n, 0.0f), parallel(m * n, 0.0f);
+
+    Math::impl::gemm(m, n, k, A.data(), k, B.data(), n, single.data(), n, 1);
+    Math::impl::gemm(m, n, k, A.data(), k, B.data(), n, parallel.data(), n, 4);
+
+    for(unsigned i = 0; i < m * n; i++) {
+        // Every thread works on whole lines, so the results should be the same
+        EXPECT_FLOAT_EQ(single[i], parallel[i]);
+    }
+}
+
+TEST(Math_Gemm_Matrix_Test, When_Multiplying_Large_Matrixes_Should_Match_The_Naive_Product) {
+    const unsigned m = 37, n = 45, k = 29;
+    Math::Matrix A(m, k), B(k, n);
+    const std::vector<float> a = randomBuffer(m * k, 1), b = randomBuffer(k * n, 2);
+    for(unsigned i = 0; i < m; i++) {
+        for(unsigned j = 0; j < k; j++) {
+            A.set(i, j, a[i * k + j]);
+        }
+    }
+    for(unsigned i = 0; i < k; i++) {
+        for(unsigned j = 0; j < n; j++) {
+            B.set(i, j, b[i * n + j]);
+        }
+    }
+
+    Math::Matrix result;
+    Math::Matrix::multiply(A, B, result);
+    const Math::Matrix expression = A * B;
+    const Math::Matrix difference = A * B - result;
+
+    ASSERT_EQ(result.lines(), m);
+    ASSERT_EQ(result.columns(), n);
+    for(unsigned i = 0; i < m; i++) {
+        for(unsigned j = 0; j < n; j++) {
+            float value = 0.0f;
+            for(unsigned p = 0; p < k; p++) {
+                value += A.get(i, p) * B.get(p, j);
+            }
+            EXPECT_NEAR(result.get(i, j), value, 1e-4);
+            EXPECT_NEAR(expression.get(i, j), value, 1e-4);
+            EXPECT_NEAR(difference.get(i, j), 0.0f, 1e-4);
+        }
+    }
+}
@@ -436,3 +436,99 @@ TEST(Math_Matrix_Test, When_Given_A_Matrix_Scalar_Division_With_Zero_Should_Fail
 
     EXPECT_DEATH(matrix / 0.0f, "Assertion*.*failed");
 }
+
+TEST(Math_Matrix_Test, When_Creating_A_Matrix_Lines_Should_Be_Aligned) {
+    Math::Matrix matrix(5, 3);
+
+    EXPECT_GE(matrix.stride(), matrix.columns());
+    for(unsigned i = 0; i < matrix.lines(); i++) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(matrix.line(i)) % Math::Matrix::Alignment, 0u);
+        EXPECT_EQ(matrix.line(i), matrix.data() + i * matrix.stride());
+    }
+}
+
+TEST(Math_Matrix_Test, When_Moving_A_Matrix_Should_Take_Its_Buffer) {
+    Math::Matrix matrix({{3, 1, -1},
+                         {2, -2, 0}});
+    const Math::Matrix copy = matrix;
+    const float *buffer = matrix.data();
+
+    Math::Matrix moved(std::move(matrix));
+    EXPECT_EQ(moved.data(), buffer);
+    EXPECT_EQ(moved == copy, true);
+    EXPECT_EQ(matrix.lines(), 0);
+    EXPECT_EQ(matrix.columns(), 0);
+
+    Math::Matrix assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.data(), buffer);
+    EXPECT_EQ(assigned == copy, true);
+    EXPECT_EQ(moved.data(), nullptr);
+}
+
+TEST(Math_Matrix_Test, When_Assigning_A_Smaller_Matrix_Should_Reuse_Buffer) {
+    Math::Matrix matrix(4, 4);
+    const float *buffer = matrix.data();
+
+    Math::Matrix smaller({{1, 2},
+                          {3, 4}});
+    matrix = smaller;
+    EXPECT_EQ(matrix.data(), buffer);
+    EXPECT_EQ(matrix == smaller, true);
+
+    matrix.setSize(3, 3);
+    EXPECT_EQ(matrix.data(), buffer);
+    EXPECT_EQ(matrix == Math::Matrix(3, 3), true);
+}
+
+TEST(Math_Matrix_Test, When_Chaining_Operators_Temporaries_Should_Be_Reused) {
+    Math::Matrix matrix({{3, 1, -1},
+                         {2, -2, 0},
+                         {1, 2, -1}});
+
+    Math::Matrix matrix_2({{1, -0.5, -1},
+                           {1, -1, -1},
+                           {3, -2.5, -4}});
+
+    Math::Matrix product = matrix * matrix_2;
+    const float *buffer = product.data();
+    Math::Matrix result = std::move(product) + matrix;
+    EXPECT_EQ(result.data(), buffer);
+
+    Math::Matrix expected({{4, 1, -1},
+                           {2, -1, 0},
+                           {1, 2, 0}});
+    EXPECT_EQ(result == expected, true);
+    EXPECT_EQ((matrix * matrix_2 + matrix) == expected, true);
+    EXPECT_EQ(((matrix * matrix_2 - matrix) * 2 + 1) / 2 == Math::Matrix({{-1.5, -0.5, 1.5},
+                                                                        {-1.5, 3.5, 0.5},
+                                                                        {-0.5, -1.5, 2.5}}), true);
+}
+
+TEST(Math_Matrix_Test, When_Using_InPlace_Operations_Should_Work) {
+    Math::Matrix matrix({{3, 1, -1},
+                         {2, -2, 0},
+                         {1, 2, -1}});
+
+    Math::Matrix matrix_2({{1, -0.5, -1},
+                           {1, -1, -1},
+                           {3, -2.5, -4}});
+
+    Math::Matrix result(3, 3);
+    const float *buffer = result.data();
+
+    Math::Matrix::multiply(matrix, matrix_2, result);
+    EXPECT_EQ(result == Math::Matrix::identity(3), true);
+
+    Math::Matrix::add(result, matrix, result);
+    EXPECT_EQ(result == matrix + Math::Matrix::identity(3), true);
+
+    Math::Matrix::subtract(result, matrix, result);
+    EXPECT_EQ(result == Math::Matrix::identity(3), true);
+
+    Math::Matrix::multiply(matrix, 2.0f, result);
+    EXPECT_EQ(result == matrix * 2, true);
+    EXPECT_EQ(result.data(), buffer);
+
+    EXPECT_DEATH(Math::Matrix::multiply(matrix, matrix, matrix), "Assertion*.*failed");
+}
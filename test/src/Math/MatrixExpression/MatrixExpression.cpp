@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Math/Matrix/Matrix.h>
+
+#include <random>
+
+#include <src/Math/MatrixTestUtils.h>
+
+using namespace MatrixTestUtils;
+
+namespace {
+    // Reference implementation using the eager in-place operations
+    Math::Matrix covarianceUpdate(const Math::Matrix &F, const Math::Matrix &P, const Math::Matrix &Q) {
+        Math::Matrix FP, FPFt;
+        Math::Matrix Ft(F.columns(), F.lines());
+        for(unsigned i = 0; i < F.lines(); i++) {
+            for(unsigned j = 0; j < F.columns(); j++) {
+                Ft.set(j, i, F.get(i, j));
+            }
+        }
+        Math::Matrix::multiply(F, P, FP);
+        Math::Matrix::multiply(FP, Ft, FPFt);
+        Math::Matrix::add(FPFt, Q, FPFt);
+        return FPFt;
+    }
+}
+
+TEST(Math_MatrixExpression_Test, When_Evaluating_Covariance_Update_Should_Match_Eager_Operations) {
+    std::mt19937 generator(42);
+    const Math::Matrix F = randomIntegerMatrix(6, 6, generator);
+    const Math::Matrix P = randomIntegerMatrix(6, 6, generator);
+    const Math::Matrix Q = randomIntegerMatrix(6, 6, generator);
+
+    Math::Matrix result = F * P * F.transposed() + Q;
+    EXPECT_EQ(result == covarianceUpdate(F, P, Q), true);
+}
+
+TEST(Math_MatrixExpression_Test, When_Assigning_An_Expression_That_Reads_Destination_Should_Work) {
+    std::mt19937 generator(7);
+    const Math::Matrix F = randomIntegerMatrix(4, 4, generator);
+    const Math::Matrix Q = randomIntegerMatrix(4, 4, generator);
+    Math::Matrix P = randomIntegerMatrix(4, 4, generator);
+    const Math::Matrix expected = covarianceUpdate(F, P, Q);
+
+    P = F * P * F.transposed() + Q;
+    EXPECT_EQ(P == expected, true);
+
+    // Transpose in place
+    Math::Matrix A = randomIntegerMatrix(3, 5, generator);
+    const Math::Matrix At = A.transposed();
+    A = A.transposed();
+    ASSERT_EQ(A.lines(), 5);
+    ASSERT_EQ(A.columns(), 3);
+    EXPECT_EQ(A == At, true);
+
+    // Product reading the destination on both sides
+    Math::Matrix B = randomIntegerMatrix(4, 4, generator);
+    const Math::Matrix BB = Math::Matrix(B) * B;
+    B = B * B;
+    EXPECT_EQ(B == BB, true);
+
+    // Accumulating an expression that reads the destination
+    Math::Matrix C = randomIntegerMatrix(4, 4, generator);
+    const Math::Matrix expectedC = C + C * F;
+    C += C * F;
+    EXPECT_EQ(C == expectedC, true);
+}
+
+TEST(Math_MatrixExpression_Test, When_Reassigning_Expressions_Should_Reuse_Buffer) {
+    std::mt19937 generator(13);
+    const Math::Matrix A = randomIntegerMatrix(6, 6, generator);
+    const Math::Matrix B = randomIntegerMatrix(6, 6, generator);
+    const Math::Matrix C = randomIntegerMatrix(6, 6, generator);
+
+    Math::Matrix result = A * B + C;
+    const float *buffer = result.data();
+    for(int i = 0; i < 3; i++) {
+        result = A * B.transposed() - C * 2.0f + 1.0f;
+        EXPECT_EQ(result.data(), buffer);
+    }
+
+    result += A * B;
+    result -= C / 2.0f;
+    EXPECT_EQ(result.data(), buffer);
+}
+
+TEST(Math_MatrixExpression_Test, When_Transposing_Should_Be_A_View) {
+    Math::Matrix A({{1, 2, 3},
+                    {4, 5, 6}});
+    auto transposed = A.transposed();
+    EXPECT_EQ(transposed.lines(), 3);
+    EXPECT_EQ(transposed.columns(), 2);
+
+    A.set(0, 2, 9);
+    EXPECT_FLOAT_EQ(transposed.coeff(2, 0), 9.0f);
+    EXPECT_EQ(transposed.transposed() == A, true);
+}
+
+TEST(Math_MatrixExpression_Test, When_Using_Wide_Matrixes_Should_Work) {
+    // Lines wider than the inline line buffers
+    std::mt19937 generator(3);
+    const Math::Matrix A = randomIntegerMatrix(3, 100, generator);
+    const Math::Matrix B = randomIntegerMatrix(100, 80, generator);
+    const Math::Matrix C = randomIntegerMatrix(3, 80, generator);
+
+    Math::Matrix AB;
+    Math::Matrix::multiply(A, B, AB);
+    Math::Matrix expected = AB;
+    Math::Matrix::add(AB, C, expected);
+
+    EXPECT_EQ((A * B + C) == expected, true);
+    EXPECT_EQ(((A * B).transposed() + C.transposed()) == expected.transposed(), true);
+}
+
+TEST(Math_MatrixExpression_Test, When_Given_Mismatched_Shapes_Should_Fail) {
+    Math::Matrix A(3, 3), B(3, 2);
+
+    EXPECT_DEATH((A * B + A), "Assertion*.*failed");
+    EXPECT_DEATH((A * B.transposed()), "Assertion*.*failed");
+    EXPECT_DEATH(A += B, "Assertion*.*failed");
+}
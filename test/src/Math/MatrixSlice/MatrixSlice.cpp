@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Math/MatrixSlice/MatrixSlice.h>
+
+TEST(Math_MatrixSlice_Test, When_Writing_To_A_Slice_Should_Write_The_Matrix) {
+    Math::Matrix M(3, 3);
+    Math::MatrixSlice block = M.block(1, 1, 2, 2);
+
+    block(0, 0) = 5.0f;
+    block.set(1, 1, 7.0f);
+    M.lineBlock(0).fill(1.0f);
+
+    EXPECT_TRUE(M == Math::Matrix({{1, 1, 1}, {0, 5, 0}, {0, 0, 7}}));
+}
+
+TEST(Math_MatrixSlice_Test, When_Assigning_Expressions_Should_Update_The_Block_In_Place) {
+    Math::Matrix M(4, 4);
+    const Math::Matrix A({{1, 2}, {3, 4}});
+    const Math::Matrix B({{0, 1}, {1, 0}});
+
+    const float *data = M.data();
+    M.block(0, 0, 2, 2) = A;
+    M.block(2, 2, 2, 2) = A * B;
+    M.block(0, 2, 2, 2) += A;
+    M.block(0, 2, 2, 2) -= B;
+    M.block(2, 0, 2, 2) = A.transposed();
+    M.block(2, 0, 2, 2) *= 2.0f;
+
+    EXPECT_EQ(M.data(), data);
+    EXPECT_TRUE(M == Math::Matrix({{1, 2, 1, 1}, {3, 4, 2, 4}, {2, 6, 2, 1}, {4, 8, 4, 3}}));
+}
+
+TEST(Math_MatrixSlice_Test, When_Assigning_Slices_Should_Copy_Elements_Instead_Of_Rebinding) {
+    Math::Matrix M({{1, 2}, {3, 4}});
+    Math::MatrixSlice first = M.lineBlock(0);
+    Math::MatrixSlice second = M.lineBlock(1);
+
+    first = second;
+
+    EXPECT_EQ(first.data(), M.line(0));
+    EXPECT_TRUE(M == Math::Matrix({{3, 4}, {3, 4}}));
+}
+
+TEST(Math_MatrixSlice_Test, When_Assigning_Overlapping_Blocks_Should_Read_The_Original_Elements) {
+    Math::Matrix M({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+
+    // Shifting down by one line overlaps source and destination
+    M.block(1, 0, 2, 3) = M.block(0, 0, 2, 3);
+    EXPECT_TRUE(M == Math::Matrix({{1, 2, 3}, {1, 2, 3}, {4, 5, 6}}));
+
+    // In-place transpose through a transposed slice
+    Math::Matrix T({{1, 2}, {3, 4}});
+    Math::MatrixSlice(T).transposed() = T;
+    EXPECT_TRUE(T == Math::Matrix({{1, 3}, {2, 4}}));
+}
+
+TEST(Math_MatrixSlice_Test, When_Writing_Columns_And_Strided_Slices_Should_Follow_The_Strides) {
+    Math::Matrix M(3, 4);
+
+    M.columnBlock(1) = Math::Matrix({{1}, {2}, {3}});
+    Math::MatrixSlice(M).strided(2, 2).fill(9.0f);
+
+    EXPECT_TRUE(M == Math::Matrix({{9, 1, 9, 0}, {0, 2, 0, 0}, {9, 3, 9, 0}}));
+}
+
+TEST(Math_MatrixSlice_Test, When_Computing_Cofactors_Should_Copy_The_Remaining_Blocks) {
+    const Math::Matrix M({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+
+    EXPECT_TRUE(M.cofactor(0, 0) == Math::Matrix({{5, 6}, {8, 9}}));
+    EXPECT_TRUE(M.cofactor(1, 2) == Math::Matrix({{1, 2}, {7, 8}}));
+    EXPECT_TRUE(M.cofactor(2, 1) == Math::Matrix({{1, 3}, {4, 6}}));
+}
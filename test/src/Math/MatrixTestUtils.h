@@ -0,0 +1,61 @@
+#ifndef MATRIXTESTUTILS_H
+#define MATRIXTESTUTILS_H
+
+#include <gtest/gtest.h>
+
+#include <Armorial/Math/Matrix/Matrix.h>
+
+#include <random>
+
+namespace MatrixTestUtils {
+    // Builds a matrix with elements uniformly distributed in [-10, 10]
+    inline Math::Matrix randomMatrix(unsigned lines, unsigned columns, std::mt19937 &generator) {
+        std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+        Math::Matrix matrix(lines, columns);
+        for(unsigned i = 0; i < lines; i++) {
+            for(unsigned j = 0; j < columns; j++) {
+                matrix.set(i, j, distribution(generator));
+            }
+        }
+
+        return matrix;
+    }
+
+    // Builds a matrix with integer elements in [-5, 5], so sums and small products are exact in float
+    inline Math::Matrix randomIntegerMatrix(unsigned lines, unsigned columns, std::mt19937 &generator) {
+        std::uniform_int_distribution<int> distribution(-5, 5);
+        Math::Matrix matrix(lines, columns);
+        for(unsigned i = 0; i < lines; i++) {
+            for(unsigned j = 0; j < columns; j++) {
+                matrix.set(i, j, float(distribution(generator)));
+            }
+        }
+
+        return matrix;
+    }
+
+    // Builds a symmetric positive-definite matrix as AAᵀ + I
+    inline Math::Matrix randomCovariance(unsigned size, std::mt19937 &generator) {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        Math::Matrix A(size, size);
+        for(unsigned i = 0; i < size; i++) {
+            for(unsigned j = 0; j < size; j++) {
+                A.set(i, j, distribution(generator));
+            }
+        }
+
+        return A * A.transposed() + Math::Matrix::identity(size);
+    }
+
+    inline void expectNear(const Math::Matrix &A, const Math::Matrix &B, float tolerance) {
+        ASSERT_EQ(A.lines(), B.lines());
+        ASSERT_EQ(A.columns(), B.columns());
+        for(unsigned i = 0; i < A.lines(); i++) {
+            for(unsigned j = 0; j < A.columns(); j++) {
+                EXPECT_NEAR(A.get(i, j), B.get(i, j), tolerance) << "at (" << i << ", " << j << ")";
+            }
+        }
+    }
+}
+
+#endif // MATRIXTESTUTILS_H
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Math/Cholesky/Cholesky.h>
+#include <Armorial/Math/LU/LU.h>
+#include <Armorial/Math/MatrixView/MatrixView.h>
+
+namespace {
+    // 4 x 5 matrix where the element (i, j) is 10 * i + j
+    Math::Matrix indexMatrix() {
+        Math::Matrix M(4, 5);
+        for(unsigned i = 0; i < M.lines(); i++) {
+            for(unsigned j = 0; j < M.columns(); j++) {
+                M.set(i, j, 10.0f * i + j);
+            }
+        }
+
+        return M;
+    }
+}
+
+TEST(Math_MatrixView_Test, When_Viewing_A_Matrix_Should_Read_Its_Buffer_Without_Copies) {
+    const Math::Matrix M = indexMatrix();
+    const Math::MatrixView view(M);
+
+    EXPECT_EQ(view.lines(), 4u);
+    EXPECT_EQ(view.columns(), 5u);
+    EXPECT_EQ(view.data(), M.data());
+    EXPECT_TRUE(view.references(&M));
+    EXPECT_FLOAT_EQ(view(3, 4), 34.0f);
+}
+
+TEST(Math_MatrixView_Test, When_Taking_Blocks_Lines_And_Columns_Should_Offset_The_View) {
+    const Math::Matrix M = indexMatrix();
+
+    const Math::MatrixView block = M.block(1, 2, 2, 3);
+    EXPECT_EQ(block.lines(), 2u);
+    EXPECT_EQ(block.columns(), 3u);
+    EXPECT_EQ(block.data(), M.line(1) + 2);
+    EXPECT_FLOAT_EQ(block(0, 0), 12.0f);
+    EXPECT_FLOAT_EQ(block(1, 2), 24.0f);
+
+    // Blocks of blocks
+    EXPECT_FLOAT_EQ(block.block(1, 1, 1, 2)(0, 1), 24.0f);
+
+    const Math::MatrixView line = M.lineBlock(2);
+    EXPECT_EQ(line.lines(), 1u);
+    EXPECT_EQ(line.columns(), 5u);
+    EXPECT_FLOAT_EQ(line(0, 3), 23.0f);
+
+    const Math::MatrixView column = M.columnBlock(3);
+    EXPECT_EQ(column.lines(), 4u);
+    EXPECT_EQ(column.columns(), 1u);
+    EXPECT_FLOAT_EQ(column(2, 0), 23.0f);
+}
+
+TEST(Math_MatrixView_Test, When_Transposing_And_Striding_Should_Swap_And_Scale_The_Strides) {
+    const Math::Matrix M = indexMatrix();
+
+    const Math::MatrixView transposed = Math::MatrixView(M).transposed();
+    EXPECT_EQ(transposed.lines(), 5u);
+    EXPECT_EQ(transposed.columns(), 4u);
+    EXPECT_FALSE(transposed.isLineContiguous());
+    EXPECT_FLOAT_EQ(transposed(4, 1), 14.0f);
+
+    const Math::MatrixView strided = Math::MatrixView(M).strided(2, 2);
+    EXPECT_EQ(strided.lines(), 2u);
+    EXPECT_EQ(strided.columns(), 3u);
+    EXPECT_FLOAT_EQ(strided(1, 2), 24.0f);
+}
+
+TEST(Math_MatrixView_Test, When_Used_In_Expressions_Should_Evaluate_Like_Matrixes) {
+    const Math::Matrix M = indexMatrix();
+
+    // Sum of two blocks and product of a block by a transposed block
+    const Math::Matrix sum = M.block(0, 0, 2, 2) + M.block(2, 3, 2, 2);
+    EXPECT_TRUE(sum == Math::Matrix({{23, 25}, {43, 45}}));
+
+    const Math::Matrix product = M.block(0, 0, 2, 2) * Math::MatrixView(M).block(0, 0, 2, 2).transposed();
+    EXPECT_TRUE(product == Math::Matrix({{1, 11}, {11, 221}}));
+
+    Math::Matrix inPlace;
+    Math::Matrix::multiply(M.block(1, 1, 2, 3), M.block(0, 0, 3, 2), inPlace);
+    const Math::Matrix expected = Math::Matrix(M.block(1, 1, 2, 3)) * Math::Matrix(M.block(0, 0, 3, 2));
+    EXPECT_TRUE(inPlace == expected);
+
+    // Strided views of the transpose
+    Math::Matrix strided = Math::MatrixView(M).transposed().strided(2, 1) * 2.0f;
+    EXPECT_TRUE(strided == Math::Matrix({{0, 20, 40, 60}, {4, 24, 44, 64}, {8, 28, 48, 68}}));
+}
+
+TEST(Math_MatrixView_Test, When_Decomposing_A_View_Should_Decompose_The_Block) {
+    // The top left 3 x 3 block is symmetric positive-definite
+    const Math::Matrix M({{4, 2, 0, 9}, {2, 5, 1, 9}, {0, 1, 3, 9}, {9, 9, 9, 9}});
+    const Math::MatrixView block = M.block(0, 0, 3, 3);
+    const Math::Matrix copy(block);
+
+    EXPECT_NEAR(Math::LU(block).determinant(), Math::LU(copy).determinant(), 1e-4f);
+    EXPECT_NEAR(Math::Cholesky(block).determinant(), Math::LU(copy).determinant(), 1e-4f);
+
+    const auto solution = Math::LU(block).solve(M.block(0, 3, 3, 1));
+    ASSERT_TRUE(solution.has_value());
+    const Math::Matrix residual = copy * solution.value() - Math::Matrix(M.block(0, 3, 3, 1));
+    for(unsigned i = 0; i < 3; i++) {
+        EXPECT_NEAR(residual.get(i, 0), 0.0f, 1e-4f);
+    }
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Math/PolynomialFit/PolynomialFit.h>
+
+#include <random>
+
+TEST(Math_PolynomialFit_Test, When_Samples_Lie_On_A_Polynomial_Should_Recover_Its_Coefficients) {
+    const Math::PolynomialFit::Polynomial polynomial(2.0, {1.5, -2.0, 0.25});
+    std::vector<float> x, y;
+    for(int i = -6; i <= 14; i++) {
+        x.push_back(i * 0.5f);
+        y.push_back(polynomial.evaluate(x.back()));
+    }
+
+    Math::PolynomialFit fit(x, 2);
+    ASSERT_TRUE(fit.isValid());
+    std::optional<Math::PolynomialFit::Polynomial> result = fit.fit(y);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_DOUBLE_EQ(result->center(), 2.0);
+    EXPECT_THAT(result->coefficients(), testing::ElementsAre(testing::DoubleNear(1.5, 1e-4),
+                                                             testing::DoubleNear(-2.0, 1e-4),
+                                                             testing::DoubleNear(0.25, 1e-4)));
+}
+
+TEST(Math_PolynomialFit_Test, When_Positions_Are_Large_Should_Still_Predict_Accurately) {
+    // A ball trajectory sampled at timestamps in seconds, far from zero
+    std::vector<float> t, x;
+    for(unsigned i = 0; i < 60; i++) {
+        t.push_back(1700.0f + i / 120.0f);
+        const float dt = t.back() - 1700.0f;
+        x.push_back(0.3f + 4.0f * dt - 2.5f * dt * dt);
+    }
+
+    Math::PolynomialFit fit(t, 2);
+    std::optional<Math::PolynomialFit::Polynomial> result = fit.fit(x);
+    ASSERT_TRUE(result.has_value());
+
+    for(unsigned i = 0; i < 60; i++) {
+        EXPECT_NEAR(result->evaluate(t[i]), x[i], 1e-3f);
+    }
+    EXPECT_NEAR(result->coefficients()[2], -2.5, 1e-2);
+}
+
+TEST(Math_PolynomialFit_Test, When_Fitting_Several_Series_Should_Match_Fitting_Each_One) {
+    std::mt19937 generator(2);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> x(50);
+    Math::Matrix Y(50, 3);
+    for(unsigned i = 0; i < 50; i++) {
+        x[i] = i * 0.1f;
+        for(unsigned j = 0; j < 3; j++) {
+            Y.set(i, j, distribution(generator));
+        }
+    }
+
+    Math::PolynomialFit fit(x, 3);
+    std::optional<std::vector<Math::PolynomialFit::Polynomial>> batched = fit.fit(Y);
+    ASSERT_TRUE(batched.has_value());
+    ASSERT_EQ(batched->size(), 3);
+
+    for(unsigned j = 0; j < 3; j++) {
+        std::vector<float> series(50);
+        for(unsigned i = 0; i < 50; i++) {
+            series[i] = Y.get(i, j);
+        }
+        std::optional<Math::PolynomialFit::Polynomial> single = fit.fit(series);
+        ASSERT_TRUE(single.has_value());
+        ASSERT_EQ((*batched)[j].coefficients().size(), 4);
+        EXPECT_DOUBLE_EQ((*batched)[j].center(), single->center());
+        for(unsigned k = 0; k < 4; k++) {
+            EXPECT_NEAR((*batched)[j].coefficients()[k], single->coefficients()[k], 1e-5);
+        }
+    }
+}
+
+TEST(Math_PolynomialFit_Test, When_Positions_Are_Not_Distinct_Enough_Should_Not_Fit) {
+    const std::vector<float> x = {1.0f, 1.0f, 2.0f, 2.0f};
+    Math::PolynomialFit fit(x, 2);
+
+    EXPECT_FALSE(fit.isValid());
+    EXPECT_FALSE(fit.fit(std::vector<float>{0.0f, 0.0f, 1.0f, 1.0f}).has_value());
+}
+
+TEST(Math_PolynomialFit_Test, When_Evaluating_Should_Use_Ascending_Powers_Around_The_Center) {
+    EXPECT_FLOAT_EQ(Math::PolynomialFit::Polynomial(0.0, {1.0, 2.0, 3.0}).evaluate(2.0f), 17.0f);
+    EXPECT_FLOAT_EQ(Math::PolynomialFit::Polynomial(1.0, {1.0, 2.0, 3.0}).evaluate(3.0f), 17.0f);
+    EXPECT_FLOAT_EQ(Math::PolynomialFit::Polynomial(0.0, {}).evaluate(2.0f), 0.0f);
+}
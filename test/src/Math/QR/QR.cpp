@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Math/LU/LU.h>
+#include <Armorial/Math/MatrixSlice/MatrixSlice.h>
+#include <Armorial/Math/QR/QR.h>
+
+#include <random>
+
+#include <src/Math/MatrixTestUtils.h>
+
+using namespace MatrixTestUtils;
+
+TEST(Math_QR_Test, When_Decomposing_A_Matrix_QR_Should_Be_Equal_To_It) {
+    std::mt19937 generator(42);
+    Math::Matrix matrix = randomMatrix(12, 5, generator);
+    Math::QR qr(matrix);
+
+    ASSERT_TRUE(qr.isFullRank());
+    EXPECT_EQ(qr.Q().lines(), 12);
+    EXPECT_EQ(qr.Q().columns(), 5);
+    expectNear(qr.Q() * qr.R(), matrix, 1e-4f);
+    expectNear(qr.Q().transposed() * qr.Q(), Math::Matrix::identity(5), 1e-5f);
+
+    // R is upper triangular
+    Math::Matrix R = qr.R();
+    for(unsigned i = 1; i < 5; i++) {
+        for(unsigned j = 0; j < i; j++) {
+            EXPECT_FLOAT_EQ(R.get(i, j), 0.0f);
+        }
+    }
+}
+
+TEST(Math_QR_Test, When_Solving_A_Square_System_Should_Agree_With_LU) {
+    std::mt19937 generator(7);
+    Math::Matrix A = randomMatrix(6, 6, generator);
+    Math::Matrix B = randomMatrix(6, 3, generator);
+
+    std::optional<Math::Matrix> x = Math::QR(A).solve(B);
+    std::optional<Math::Matrix> expected = Math::LU(A).solve(B);
+    ASSERT_TRUE(x.has_value());
+    ASSERT_TRUE(expected.has_value());
+    expectNear(*x, *expected, 1e-3f);
+}
+
+TEST(Math_QR_Test, When_Solving_An_Overdetermined_System_Residual_Should_Be_Orthogonal_To_Columns) {
+    std::mt19937 generator(3);
+    Math::Matrix A = randomMatrix(40, 4, generator);
+    Math::Matrix b = randomMatrix(40, 1, generator);
+
+    std::optional<Math::Matrix> x = Math::QR(A).solve(b);
+    ASSERT_TRUE(x.has_value());
+    ASSERT_EQ(x->lines(), 4);
+    ASSERT_EQ(x->columns(), 1);
+
+    // Least squares optimality: A^T (A x - b) = 0
+    Math::Matrix residual = A * (*x) - b;
+    Math::Matrix gradient = A.transposed() * residual;
+    for(unsigned i = 0; i < 4; i++) {
+        EXPECT_NEAR(gradient.get(i, 0), 0.0f, 1e-2f);
+    }
+}
+
+TEST(Math_QR_Test, When_Solving_A_Consistent_System_Should_Recover_The_Exact_Solution) {
+    // Points on the line y = 2x + 1
+    Math::Matrix A({{0.0f, 1.0f}, {1.0f, 1.0f}, {2.0f, 1.0f}, {3.0f, 1.0f}, {4.0f, 1.0f}});
+    Math::Matrix b(std::vector<std::vector<float>>{{1.0f}, {3.0f}, {5.0f}, {7.0f}, {9.0f}});
+
+    std::optional<Math::Matrix> x = Math::QR(A).solve(b);
+    ASSERT_TRUE(x.has_value());
+    EXPECT_NEAR(x->get(0, 0), 2.0f, 1e-5f);
+    EXPECT_NEAR(x->get(1, 0), 1.0f, 1e-5f);
+}
+
+TEST(Math_QR_Test, When_Columns_Are_Dependent_Should_Not_Solve) {
+    Math::Matrix A({{1.0f, 2.0f}, {2.0f, 4.0f}, {3.0f, 6.0f}});
+    Math::Matrix b(std::vector<std::vector<float>>{{1.0f}, {2.0f}, {3.0f}});
+
+    Math::QR qr(A);
+    EXPECT_FALSE(qr.isFullRank());
+    EXPECT_FALSE(qr.solve(b).has_value());
+}
+
+TEST(Math_QR_Test, When_Given_A_Tall_Well_Conditioned_System_Should_Be_Full_Rank) {
+    // Orthogonal columns of very different norms, with many more lines than columns
+    const unsigned lines = 20000;
+    Math::Matrix A(lines, 2);
+    Math::Matrix b(lines, 1);
+    for(unsigned i = 0; i < lines; i++) {
+        const float alternating = (i % 2 == 0) ? 1e-3f : -1e-3f;
+        A.set(i, 0, 1.0f);
+        A.set(i, 1, alternating);
+        b.set(i, 0, 1.0f + 2.0f * alternating);
+    }
+
+    Math::QR qr(A);
+    EXPECT_TRUE(qr.isFullRank());
+    std::optional<Math::Matrix> x = qr.solve(b);
+    ASSERT_TRUE(x.has_value());
+    EXPECT_NEAR(x->get(0, 0), 1.0f, 1e-4f);
+    EXPECT_NEAR(x->get(1, 0), 2.0f, 1e-3f);
+}
+
+TEST(Math_QR_Test, When_Given_Views_Should_Match_The_Copied_Blocks) {
+    std::mt19937 generator(11);
+    Math::Matrix M = randomMatrix(20, 10, generator);
+
+    Math::Matrix A = M.block(2, 1, 15, 4);
+    Math::Matrix B = M.block(2, 7, 15, 2);
+
+    std::optional<Math::Matrix> fromViews = Math::QR(M.block(2, 1, 15, 4)).solve(M.block(2, 7, 15, 2));
+    std::optional<Math::Matrix> fromCopies = Math::QR(A).solve(B);
+    ASSERT_TRUE(fromViews.has_value());
+    ASSERT_TRUE(fromCopies.has_value());
+    expectNear(*fromViews, *fromCopies, 1e-6f);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Math/QR/QR.h>
+#include <Armorial/Math/SVD/SVD.h>
+
+#include <cmath>
+#include <random>
+
+#include <src/Math/MatrixTestUtils.h>
+
+using namespace MatrixTestUtils;
+
+namespace {
+    Math::Matrix reconstruct(const Math::SVD &svd) {
+        const std::vector<float> sigma = svd.singularValues();
+        Math::Matrix S = Math::Matrix::diag(sigma.size(), 0.0f);
+        for(unsigned i = 0; i < sigma.size(); i++) {
+            S.set(i, i, sigma[i]);
+        }
+
+        return svd.U() * S * svd.V().transposed();
+    }
+}
+
+TEST(Math_SVD_Test, When_Decomposing_A_Tall_Matrix_USVt_Should_Be_Equal_To_It) {
+    std::mt19937 generator(42);
+    Math::Matrix matrix = randomMatrix(10, 4, generator);
+    Math::SVD svd(matrix);
+
+    expectNear(reconstruct(svd), matrix, 1e-3f);
+    expectNear(svd.U().transposed() * svd.U(), Math::Matrix::identity(4), 1e-5f);
+    expectNear(svd.V().transposed() * svd.V(), Math::Matrix::identity(4), 1e-5f);
+
+    const std::vector<float> sigma = svd.singularValues();
+    for(unsigned i = 1; i < sigma.size(); i++) {
+        EXPECT_GE(sigma[i - 1], sigma[i]);
+    }
+}
+
+TEST(Math_SVD_Test, When_Decomposing_A_Wide_Matrix_USVt_Should_Be_Equal_To_It) {
+    std::mt19937 generator(5);
+    Math::Matrix matrix = randomMatrix(3, 7, generator);
+    Math::SVD svd(matrix);
+
+    EXPECT_EQ(svd.U().lines(), 3);
+    EXPECT_EQ(svd.V().lines(), 7);
+    EXPECT_EQ(svd.singularValues().size(), 3);
+    expectNear(reconstruct(svd), matrix, 1e-3f);
+}
+
+TEST(Math_SVD_Test, When_Given_A_Diagonal_Matrix_Singular_Values_Should_Be_Its_Absolute_Entries) {
+    Math::Matrix matrix({{3.0f, 0.0f, 0.0f},
+                         {0.0f, -5.0f, 0.0f},
+                         {0.0f, 0.0f, 1.0f}});
+    Math::SVD svd(matrix);
+
+    EXPECT_THAT(svd.singularValues(), testing::ElementsAre(testing::FloatNear(5.0f, 1e-6f),
+                                                           testing::FloatNear(3.0f, 1e-6f),
+                                                           testing::FloatNear(1.0f, 1e-6f)));
+    EXPECT_EQ(svd.rank(), 3);
+    EXPECT_NEAR(svd.conditionNumber(), 5.0f, 1e-5f);
+}
+
+TEST(Math_SVD_Test, When_Matrix_Is_Rank_Deficient_Should_Report_Its_Rank) {
+    Math::Matrix matrix({{1.0f, 2.0f, 3.0f},
+                         {2.0f, 4.0f, 6.0f},
+                         {1.0f, 0.0f, 1.0f},
+                         {0.0f, 2.0f, 2.0f}});
+    Math::SVD svd(matrix);
+
+    EXPECT_EQ(svd.rank(), 2);
+    EXPECT_TRUE(std::isinf(svd.conditionNumber()));
+}
+
+TEST(Math_SVD_Test, When_Solving_A_Full_Rank_System_Should_Agree_With_QR) {
+    std::mt19937 generator(9);
+    Math::Matrix A = randomMatrix(30, 5, generator);
+    Math::Matrix B = randomMatrix(30, 2, generator);
+
+    std::optional<Math::Matrix> expected = Math::QR(A).solve(B);
+    ASSERT_TRUE(expected.has_value());
+    expectNear(Math::SVD(A).solve(B), *expected, 1e-4f);
+}
+
+TEST(Math_SVD_Test, When_Solving_A_Rank_Deficient_System_Should_Return_The_Minimum_Norm_Solution) {
+    // x + y = 2 has infinitely many solutions, the one with minimum norm is (1, 1)
+    Math::Matrix A({{1.0f, 1.0f},
+                    {1.0f, 1.0f}});
+    Math::Matrix b(std::vector<std::vector<float>>{{2.0f}, {2.0f}});
+
+    Math::Matrix x = Math::SVD(A).solve(b);
+    EXPECT_NEAR(x.get(0, 0), 1.0f, 1e-5f);
+    EXPECT_NEAR(x.get(1, 0), 1.0f, 1e-5f);
+}
+
+TEST(Math_SVD_Test, When_Computing_The_Pseudo_Inverse_Should_Satisfy_The_Penrose_Conditions) {
+    Math::Matrix A({{1.0f, 2.0f, 3.0f},
+                    {2.0f, 4.0f, 6.0f},
+                    {1.0f, 0.0f, 1.0f},
+                    {0.0f, 2.0f, 2.0f}});
+    Math::Matrix pinv = Math::SVD(A).pseudoInverse();
+
+    ASSERT_EQ(pinv.lines(), 3);
+    ASSERT_EQ(pinv.columns(), 4);
+    expectNear(A * pinv * A, A, 1e-4f);
+    expectNear(pinv * A * pinv, pinv, 1e-4f);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Common/Types/Field/Field.h>
+#include <Armorial/Planning/PathPlanner/PathPlanner.h>
+
+#include <cmath>
+
+#include <src/Geometry/GeometryTestUtils.h>
+
+using GeometryTestUtils::makeField;
+
+namespace {
+    // A budget the search never reaches, so that it stops at the tree capacity and the results do
+    // not depend on the load of the machine
+    Planning::PlannerSettings testSettings() {
+        Planning::PlannerSettings settings;
+        settings.timeBudget = std::chrono::seconds(10);
+        return settings;
+    }
+
+    float distanceToSegment(const Geometry::Vector2D &point, const Geometry::Vector2D &a, const Geometry::Vector2D &b) {
+        const Geometry::Vector2D ab = b - a, ap = point - a;
+        const float length2 = ab.dotProduct(ab);
+        const float t = (length2 > 0.0f) ? std::clamp(ap.dotProduct(ab) / length2, 0.0f, 1.0f) : 0.0f;
+        return (a + ab * t - point).length();
+    }
+
+    void expectClearPath(const Planning::Path &path, const std::vector<Planning::Obstacle> &obstacles, const Planning::PlannerSettings &settings) {
+        for(size_t i = 1; i < path.waypoints.size(); i++) {
+            for(const Planning::Obstacle &obstacle : obstacles) {
+                EXPECT_GE(distanceToSegment(obstacle.position, path.waypoints[i - 1], path.waypoints[i]),
+                          obstacle.radius + settings.robotRadius + settings.safetyMargin - 1e-2f)
+                        << "Segment " << i << " of the path hits an obstacle";
+            }
+        }
+    }
+
+    // A wall of robots across the field with a single gap at y = 2000
+    std::vector<Planning::Obstacle> wall() {
+        std::vector<Planning::Obstacle> obstacles;
+        for(float y = -3000.0f; y <= 1000.0f; y += 150.0f) {
+            obstacles.push_back({Geometry::Vector2D(0.0f, y), Geometry::Vector2D(0.0f, 0.0f), 90.0f});
+        }
+        obstacles.push_back({Geometry::Vector2D(0.0f, 3000.0f), Geometry::Vector2D(0.0f, 0.0f), 90.0f});
+
+        return obstacles;
+    }
+}
+
+TEST(Planning_PathPlanner_Tests, GivenAFreeField_Plan_ShouldGoStraight) {
+    Planning::PathPlanner planner(makeField(), testSettings());
+    const Planning::Path &path = planner.plan(Geometry::Vector2D(-3000.0f, 0.0f), Geometry::Vector2D(3000.0f, 1000.0f), {});
+
+    ASSERT_EQ(path.waypoints.size(), 2);
+    EXPECT_TRUE(path.reachesGoal);
+    EXPECT_NEAR(path.length, std::hypot(6000.0f, 1000.0f), 1e-1f);
+}
+
+TEST(Planning_PathPlanner_Tests, GivenAGoalOutsideTheField_Plan_ShouldEndInsideTheBounds) {
+    const Planning::PlannerSettings settings = testSettings();
+    Planning::PathPlanner planner(makeField(), settings);
+    const Planning::Path &path = planner.plan(Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(9000.0f, 0.0f), {});
+
+    EXPECT_TRUE(path.reachesGoal);
+    EXPECT_FLOAT_EQ(path.waypoints.back().x(), 4500.0f + settings.fieldMargin);
+}
+
+TEST(Planning_PathPlanner_Tests, GivenAWallWithAGap_Plan_ShouldGoThroughTheGap) {
+    const Planning::PlannerSettings settings = testSettings();
+    const std::vector<Planning::Obstacle> obstacles = wall();
+    Planning::PathPlanner planner(makeField(), settings);
+    const Planning::Path &path = planner.plan(Geometry::Vector2D(-2000.0f, -1000.0f), Geometry::Vector2D(2000.0f, -1000.0f), obstacles);
+
+    ASSERT_TRUE(path.reachesGoal);
+    EXPECT_GT(path.waypoints.size(), 2);
+    EXPECT_EQ(path.waypoints.front(), Geometry::Vector2D(-2000.0f, -1000.0f));
+    EXPECT_EQ(path.waypoints.back(), Geometry::Vector2D(2000.0f, -1000.0f));
+    expectClearPath(path, obstacles, settings);
+
+    const bool crossesTheGap = std::any_of(path.waypoints.begin(), path.waypoints.end(), [](const Geometry::Vector2D &waypoint) {
+        return waypoint.y() > 1000.0f;
+    });
+    EXPECT_TRUE(crossesTheGap);
+}
+
+TEST(Planning_PathPlanner_Tests, GivenThePreviousPath_Plan_ShouldNotGetLonger) {
+    const Planning::PlannerSettings settings = testSettings();
+    const std::vector<Planning::Obstacle> obstacles = wall();
+    Planning::PathPlanner planner(makeField(), settings);
+
+    const Planning::Path first = planner.plan(Geometry::Vector2D(-2000.0f, -1000.0f), Geometry::Vector2D(2000.0f, -1000.0f), obstacles);
+    ASSERT_TRUE(first.reachesGoal);
+    const Planning::Path &path = planner.plan(Geometry::Vector2D(-2000.0f, -1000.0f), Geometry::Vector2D(2000.0f, -1000.0f), obstacles);
+
+    ASSERT_TRUE(path.reachesGoal);
+    EXPECT_LE(path.length, first.length + 1e-1f);
+    expectClearPath(path, obstacles, settings);
+}
+
+TEST(Planning_PathPlanner_Tests, GivenAnEnclosedGoal_Plan_ShouldStopAtTheClosestReachablePoint) {
+    const Planning::PlannerSettings settings = testSettings();
+    std::vector<Planning::Obstacle> ring;
+    for(int i = 0; i < 16; i++) {
+        const float angle = 2.0f * Geometry::Angle::PI * i / 16.0f;
+        ring.push_back({Geometry::Vector2D(2000.0f + 500.0f * cosf(angle), 500.0f * sinf(angle)), Geometry::Vector2D(0.0f, 0.0f), 90.0f});
+    }
+
+    Planning::PathPlanner planner(makeField(), settings);
+    const Planning::Path &path = planner.plan(Geometry::Vector2D(-2000.0f, 0.0f), Geometry::Vector2D(2000.0f, 0.0f), ring);
+
+    EXPECT_FALSE(path.reachesGoal);
+    ASSERT_FALSE(path.waypoints.empty());
+    EXPECT_LT((path.waypoints.back() - Geometry::Vector2D(2000.0f, 0.0f)).length(), 1500.0f);
+    expectClearPath(path, ring, settings);
+}
+
+TEST(Planning_PathPlanner_Tests, GivenAMovingObstacle_Plan_ShouldAvoidWhereItIsGoing) {
+    const Planning::PlannerSettings settings = testSettings();
+    // Beside the straight line now, but crossing it within the prediction horizon
+    const std::vector<Planning::Obstacle> obstacles = {{Geometry::Vector2D(0.0f, 600.0f), Geometry::Vector2D(0.0f, -2000.0f), 90.0f}};
+    Planning::PathPlanner planner(makeField(), settings);
+    const Planning::Path &path = planner.plan(Geometry::Vector2D(-2000.0f, 0.0f), Geometry::Vector2D(2000.0f, 0.0f), obstacles);
+
+    ASSERT_TRUE(path.reachesGoal);
+    EXPECT_GT(path.waypoints.size(), 2);
+
+    const std::vector<Planning::Obstacle> predicted = {{Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(0.0f, 0.0f), 90.0f}};
+    expectClearPath(path, predicted, settings);
+}
+
+TEST(Planning_PathPlanner_Tests, GivenAStartInsideAnObstacle_Plan_ShouldLeaveIt) {
+    const std::vector<Planning::Obstacle> obstacles = {{Geometry::Vector2D(0.0f, 0.0f), Geometry::Vector2D(0.0f, 0.0f), 90.0f},
+                                                       {Geometry::Vector2D(100.0f, 0.0f), Geometry::Vector2D(0.0f, 0.0f), 90.0f}};
+    Planning::PathPlanner planner(makeField(), testSettings());
+
+    EXPECT_TRUE(planner.plan(Geometry::Vector2D(100.0f, 0.0f), Geometry::Vector2D(2000.0f, 0.0f), obstacles, 1).reachesGoal);
+}
+
+TEST(Planning_PathPlanner_Tests, GivenATimeBudget_Plan_ShouldRespectIt) {
+    Planning::PlannerSettings settings;
+    settings.timeBudget = std::chrono::microseconds(200);
+    std::vector<Planning::Obstacle> ring;
+    for(int i = 0; i < 16; i++) {
+        const float angle = 2.0f * Geometry::Angle::PI * i / 16.0f;
+        ring.push_back({Geometry::Vector2D(2000.0f + 500.0f * cosf(angle), 500.0f * sinf(angle)), Geometry::Vector2D(0.0f, 0.0f), 90.0f});
+    }
+
+    Planning::PathPlanner planner(makeField(), settings);
+    const Planning::Path &path = planner.plan(Geometry::Vector2D(-2000.0f, 0.0f), Geometry::Vector2D(2000.0f, 0.0f), ring);
+
+    // The wall-clock time depends on the load of the machine, but the budget must stop the search
+    // long before the tree fills up
+    EXPECT_FALSE(path.reachesGoal);
+    EXPECT_GT(path.iterations, 0);
+    EXPECT_LT(path.iterations, settings.maxNodes / 2) << "Plan should stop at its budget";
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Common/Types/Field/Field.h>
+#include <Armorial/Planning/TeamPlanner/TeamPlanner.h>
+
+#include <src/Geometry/GeometryTestUtils.h>
+
+using GeometryTestUtils::makeField;
+
+namespace {
+    // Six robots in a column crossing to the other side, among six standing opponents
+    void scenario(std::vector<Planning::PlanningRequest> &requests, std::vector<Planning::Obstacle> &obstacles) {
+        for(size_t robot = 0; robot < 6; robot++) {
+            const float y = -2500.0f + 1000.0f * robot;
+            obstacles.push_back({Geometry::Vector2D(-3000.0f, y), Geometry::Vector2D(0.0f, 0.0f), 90.0f});
+            requests.push_back({Geometry::Vector2D(-3000.0f, y), Geometry::Vector2D(3000.0f, -y), robot});
+        }
+        for(size_t opponent = 0; opponent < 6; opponent++) {
+            obstacles.push_back({Geometry::Vector2D(0.0f, -2500.0f + 1000.0f * opponent), Geometry::Vector2D(0.0f, 0.0f), 90.0f});
+        }
+    }
+
+    void expectValidPaths(const std::vector<Planning::Path> &paths, const std::vector<Planning::PlanningRequest> &requests) {
+        ASSERT_EQ(paths.size(), requests.size());
+        for(size_t robot = 0; robot < paths.size(); robot++) {
+            EXPECT_TRUE(paths[robot].reachesGoal) << "Robot " << robot << " should reach its goal";
+            ASSERT_FALSE(paths[robot].waypoints.empty());
+            EXPECT_EQ(paths[robot].waypoints.front(), requests[robot].start);
+            EXPECT_EQ(paths[robot].waypoints.back(), requests[robot].goal);
+        }
+    }
+}
+
+TEST(Planning_TeamPlanner_Tests, GivenATeam_ParallelPlan_ShouldPlanEveryRobot) {
+    Planning::PlannerSettings settings;
+    settings.timeBudget = std::chrono::seconds(10);
+    std::vector<Planning::PlanningRequest> requests;
+    std::vector<Planning::Obstacle> obstacles;
+    scenario(requests, obstacles);
+
+    for(unsigned threads : {1u, 4u}) {
+        Planning::TeamPlanner planner(makeField(), requests.size(), settings, threads);
+        // Consecutive frames reuse the workers and the previous paths
+        for(int frame = 0; frame < 3; frame++) {
+            expectValidPaths(planner.plan(requests, obstacles), requests);
+        }
+        EXPECT_EQ(planner.size(), requests.size());
+    }
+}
+
+TEST(Planning_TeamPlanner_Tests, GivenMoreRequestsThanRobots_Plan_ShouldPlanOnlyTheRobots) {
+    std::vector<Planning::PlanningRequest> requests;
+    std::vector<Planning::Obstacle> obstacles;
+    scenario(requests, obstacles);
+
+    Planning::TeamPlanner planner(makeField(), 4, Planning::PlannerSettings(), 2);
+    EXPECT_EQ(planner.plan(requests, obstacles).size(), 4);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Tracking/KalmanFilter/KalmanFilter.h>
+
+#include <random>
+
+namespace {
+    // 1D constant velocity filter: state [position, velocity], measured position
+    using Filter = Tracking::KalmanFilter<2, 1>;
+
+    Filter constantVelocityFilter(float measurementVariance) {
+        return Filter(Filter::State(), Filter::Covariance::diag(100.0f),
+                      Filter::Observation({{1.0f, 0.0f}}), Filter::MeasurementCovariance({{measurementVariance}}));
+    }
+
+    Filter::Covariance transition(float dt) {
+        return Filter::Covariance({{1.0f, dt}, {0.0f, 1.0f}});
+    }
+}
+
+TEST(Tracking_KalmanFilter_Test, When_Predicting_Should_Propagate_State_And_Covariance) {
+    Filter filter(Filter::State({{1.0f}, {2.0f}}), Filter::Covariance::identity(),
+                  Filter::Observation({{1.0f, 0.0f}}), Filter::MeasurementCovariance({{1.0f}}));
+
+    filter.predict(transition(0.5f), Filter::Covariance::diag(0.1f));
+
+    EXPECT_FLOAT_EQ(filter.state().get(0, 0), 2.0f);
+    EXPECT_FLOAT_EQ(filter.state().get(1, 0), 2.0f);
+    // F * I * Fᵀ + Q
+    EXPECT_FLOAT_EQ(filter.covariance().get(0, 0), 1.35f);
+    EXPECT_FLOAT_EQ(filter.covariance().get(0, 1), 0.5f);
+    EXPECT_FLOAT_EQ(filter.covariance().get(1, 0), 0.5f);
+    EXPECT_FLOAT_EQ(filter.covariance().get(1, 1), 1.1f);
+}
+
+TEST(Tracking_KalmanFilter_Test, When_Updating_A_Scalar_Filter_Should_Weight_By_The_Variances) {
+    Tracking::KalmanFilter<1, 1> filter(Tracking::KalmanFilter<1, 1>::State({{0.0f}}),
+                                        Tracking::KalmanFilter<1, 1>::Covariance({{1.0f}}),
+                                        Tracking::KalmanFilter<1, 1>::Observation({{1.0f}}),
+                                        Tracking::KalmanFilter<1, 1>::MeasurementCovariance({{3.0f}}));
+
+    EXPECT_TRUE(filter.update(Tracking::KalmanFilter<1, 1>::Measurement({{4.0f}})));
+
+    // Gain 1 / (1 + 3)
+    EXPECT_FLOAT_EQ(filter.state().get(0, 0), 1.0f);
+    EXPECT_FLOAT_EQ(filter.covariance().get(0, 0), 0.75f);
+}
+
+TEST(Tracking_KalmanFilter_Test, When_Tracking_A_Noisy_Constant_Velocity_Target_Should_Converge) {
+    Filter filter = constantVelocityFilter(0.01f);
+    std::mt19937 generator(7);
+    std::normal_distribution<float> noise(0.0f, 0.1f);
+
+    const float dt = 1.0f / 60.0f, velocity = 1.5f;
+    for(unsigned frame = 1; frame <= 600; frame++) {
+        filter.predict(transition(dt), Filter::Covariance::diag(1e-6f));
+        filter.update(Filter::Measurement({{velocity * dt * frame + noise(generator)}}));
+    }
+
+    EXPECT_NEAR(filter.state().get(0, 0), velocity * dt * 600, 0.05f);
+    EXPECT_NEAR(filter.state().get(1, 0), velocity, 0.05f);
+    // The covariance should stay symmetric
+    EXPECT_FLOAT_EQ(filter.covariance().get(0, 1), filter.covariance().get(1, 0));
+}
+
+TEST(Tracking_KalmanFilter_Test, When_Computing_Distances_Should_Use_The_Innovation_Covariance) {
+    Filter filter = constantVelocityFilter(4.0f);
+    filter.setCovariance(Filter::Covariance::diag(5.0f));
+
+    const Filter::Measurement y = filter.innovation(Filter::Measurement({{3.0f}}));
+    EXPECT_FLOAT_EQ(y.get(0, 0), 3.0f);
+    EXPECT_FLOAT_EQ(filter.innovationCovariance().get(0, 0), 9.0f);
+
+    const auto inverseS = filter.innovationCovariance().inverse();
+    ASSERT_TRUE(inverseS.has_value());
+    EXPECT_FLOAT_EQ(Filter::squaredDistance(y, inverseS.value()), 1.0f);
+}
+
+TEST(Tracking_KalmanFilter_Test, When_Innovation_Covariance_Is_Singular_Should_Not_Update) {
+    Filter filter(Filter::State({{1.0f}, {1.0f}}), Filter::Covariance(), Filter::Observation({{1.0f, 0.0f}}),
+                  Filter::MeasurementCovariance());
+
+    EXPECT_FALSE(filter.update(Filter::Measurement({{5.0f}})));
+    EXPECT_FLOAT_EQ(filter.state().get(0, 0), 1.0f);
+}
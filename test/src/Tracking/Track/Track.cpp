@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Tracking/Track/Track.h>
+
+TEST(Tracking_Track_Test, When_Created_Should_Start_Tentative_At_The_Detection) {
+    Tracking::TrackingSettings settings;
+    Tracking::Track track(7, {Geometry::Vector2D(1000.0f, -2000.0f), std::nullopt}, settings);
+
+    EXPECT_EQ(track.id(), 7u);
+    EXPECT_EQ(track.status(), Tracking::Track::Status::TENTATIVE);
+    EXPECT_FALSE(track.hasOrientation());
+    EXPECT_FLOAT_EQ(track.position().x(), 1000.0f);
+    EXPECT_FLOAT_EQ(track.position().y(), -2000.0f);
+    EXPECT_FLOAT_EQ(track.velocity().length(), 0.0f);
+}
+
+TEST(Tracking_Track_Test, When_Hit_Enough_Times_Should_Be_Confirmed_And_Lost_After_Misses) {
+    Tracking::TrackingSettings settings;
+    settings.confirmationHits = 3;
+    settings.maxMisses = 2;
+    Tracking::Track track(0, {Geometry::Vector2D(0.0f, 0.0f), std::nullopt}, settings);
+
+    for(unsigned i = 0; i < 2; i++) {
+        track.predict(0.01f);
+        track.update({Geometry::Vector2D(0.0f, 0.0f), std::nullopt});
+    }
+    EXPECT_TRUE(track.isConfirmed());
+
+    for(unsigned i = 0; i < 3; i++) {
+        EXPECT_FALSE(track.isLost());
+        track.predict(0.01f);
+        track.miss();
+    }
+    EXPECT_TRUE(track.isLost());
+}
+
+TEST(Tracking_Track_Test, When_Tentative_Track_Misses_Should_Be_Lost) {
+    Tracking::TrackingSettings settings;
+    Tracking::Track track(0, {Geometry::Vector2D(0.0f, 0.0f), std::nullopt}, settings);
+
+    track.predict(0.01f);
+    track.miss();
+
+    EXPECT_TRUE(track.isLost());
+}
+
+TEST(Tracking_Track_Test, When_Following_A_Constant_Acceleration_Should_Estimate_It) {
+    Tracking::TrackingSettings settings;
+    settings.model = Tracking::MotionModel::CONSTANT_ACCELERATION;
+    settings.processNoise = 1e6f;
+    settings.measurementNoise = 1.0f;
+    Tracking::Track track(0, {Geometry::Vector2D(0.0f, 0.0f), std::nullopt}, settings);
+
+    const float dt = 1.0f / 120.0f;
+    for(unsigned frame = 1; frame <= 240; frame++) {
+        const float t = frame * dt;
+        track.predict(dt);
+        track.update({Geometry::Vector2D(0.5f * 2000.0f * t * t, 1000.0f * t), std::nullopt});
+    }
+
+    EXPECT_NEAR(track.velocity().x(), 4000.0f, 50.0f);
+    EXPECT_NEAR(track.velocity().y(), 1000.0f, 50.0f);
+    EXPECT_NEAR(track.acceleration().x(), 2000.0f, 200.0f);
+    EXPECT_NEAR(track.acceleration().y(), 0.0f, 200.0f);
+}
+
+TEST(Tracking_Track_Test, When_Orientation_Wraps_Around_Should_Follow_The_Shortest_Angle) {
+    Tracking::TrackingSettings settings;
+    Tracking::Track track(0, {Geometry::Vector2D(0.0f, 0.0f), Geometry::Angle(Geometry::Angle::PI - 0.2f)}, settings);
+
+    // Rotating counter clockwise through ±π
+    const float dt = 1.0f / 60.0f, angularSpeed = 3.0f;
+    for(unsigned frame = 1; frame <= 60; frame++) {
+        track.predict(dt);
+        track.update({Geometry::Vector2D(0.0f, 0.0f), Geometry::Angle(Geometry::Angle::PI - 0.2f + angularSpeed * dt * frame)});
+    }
+
+    EXPECT_TRUE(track.hasOrientation());
+    EXPECT_NEAR(track.angularSpeed(), angularSpeed, 0.1f);
+    EXPECT_NEAR((track.orientation() - Geometry::Angle(Geometry::Angle::PI - 0.2f + angularSpeed)).value(), 0.0f, 0.02f);
+
+    const Common::Types::Object object = track.object();
+    EXPECT_FLOAT_EQ(object.getAngularSpeed(), track.angularSpeed());
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Tracking/Tracker/Tracker.h>
+
+#include <random>
+
+namespace {
+    // Targets moving with constant velocity from the given initial positions, in millimeters
+    std::vector<Tracking::Detection> targetsAt(unsigned count, float t) {
+        std::vector<Tracking::Detection> detections;
+        for(unsigned i = 0; i < count; i++) {
+            const Geometry::Vector2D start(-4000.0f + 500.0f * i, -3000.0f + 300.0f * i);
+            const Geometry::Vector2D velocity(500.0f + 50.0f * i, (i % 2 == 0) ? 800.0f : -800.0f);
+            detections.push_back({start + velocity * t, std::nullopt});
+        }
+
+        return detections;
+    }
+}
+
+TEST(Tracking_Tracker_Test, When_Updating_Without_Detections_Should_Have_No_Tracks) {
+    Tracking::Tracker tracker;
+    tracker.update({}, 0.01f);
+
+    EXPECT_TRUE(tracker.tracks().empty());
+    EXPECT_TRUE(tracker.objects().empty());
+}
+
+TEST(Tracking_Tracker_Test, When_Tracking_Several_Targets_Should_Keep_Their_Identities) {
+    Tracking::TrackingSettings settings;
+    settings.confirmationHits = 3;
+    Tracking::Tracker tracker(settings);
+
+    const unsigned targets = 12;
+    const float dt = 1.0f / 120.0f;
+    tracker.update(targetsAt(targets, 0.0f), dt);
+    ASSERT_EQ(tracker.tracks().size(), targets);
+    EXPECT_TRUE(tracker.objects().empty());
+
+    for(unsigned frame = 1; frame <= 240; frame++) {
+        // Detections in a different order each frame
+        std::vector<Tracking::Detection> detections = targetsAt(targets, frame * dt);
+        std::rotate(detections.begin(), detections.begin() + (frame % targets), detections.end());
+        tracker.update(detections, dt);
+    }
+
+    ASSERT_EQ(tracker.tracks().size(), targets);
+    ASSERT_EQ(tracker.objects().size(), targets);
+    const std::vector<Tracking::Detection> expected = targetsAt(targets, 240 * dt);
+    for(unsigned i = 0; i < targets; i++) {
+        // Tracks are created in the order of the first detections, and should follow the same target
+        const Tracking::Track *track = tracker.track(i);
+        ASSERT_NE(track, nullptr);
+        EXPECT_TRUE(track->isConfirmed());
+        EXPECT_NEAR(track->position().x(), expected[i].position.x(), 10.0f);
+        EXPECT_NEAR(track->position().y(), expected[i].position.y(), 10.0f);
+        EXPECT_NEAR(track->velocity().x(), 500.0f + 50.0f * i, 50.0f);
+    }
+}
+
+TEST(Tracking_Tracker_Test, When_Detection_Is_Outside_The_Gate_Should_Start_A_New_Track) {
+    Tracking::Tracker tracker;
+    const float dt = 1.0f / 60.0f;
+    for(unsigned frame = 0; frame < 5; frame++) {
+        tracker.update({{Geometry::Vector2D(0.0f, 0.0f), std::nullopt}}, dt);
+    }
+    ASSERT_EQ(tracker.tracks().size(), 1u);
+
+    // A jump of several meters in a frame can not be the same object
+    tracker.update({{Geometry::Vector2D(3000.0f, 0.0f), std::nullopt}}, dt);
+
+    ASSERT_EQ(tracker.tracks().size(), 2u);
+    EXPECT_EQ(tracker.tracks()[0].id(), 0u);
+    EXPECT_EQ(tracker.tracks()[0].misses(), 1u);
+    EXPECT_EQ(tracker.tracks()[1].id(), 1u);
+    EXPECT_EQ(tracker.tracks()[1].status(), Tracking::Track::Status::TENTATIVE);
+}
+
+TEST(Tracking_Tracker_Test, When_Targets_Disappear_Should_Coast_And_Then_Remove_Their_Tracks) {
+    Tracking::TrackingSettings settings;
+    settings.maxMisses = 5;
+    Tracking::Tracker tracker(settings);
+    const float dt = 1.0f / 60.0f;
+    for(unsigned frame = 0; frame < 10; frame++) {
+        tracker.update(targetsAt(3, frame * dt), dt);
+    }
+    ASSERT_EQ(tracker.objects().size(), 3u);
+
+    // Only the first target keeps being detected (more tracks than detections)
+    for(unsigned frame = 10; frame < 15; frame++) {
+        tracker.update(targetsAt(1, frame * dt), dt);
+        EXPECT_EQ(tracker.tracks().size(), 3u);
+    }
+    tracker.update(targetsAt(1, 15 * dt), dt);
+
+    ASSERT_EQ(tracker.tracks().size(), 1u);
+    EXPECT_EQ(tracker.tracks()[0].id(), 0u);
+    EXPECT_EQ(tracker.tracks()[0].misses(), 0u);
+
+    tracker.clear();
+    EXPECT_TRUE(tracker.tracks().empty());
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Utils/Utils.h>
+
+#include <cmath>
+
+TEST(Utils_Angles_Tests, GivenAnAngle_FastSinAndCos_ShouldBeWithinTheirErrorBound) {
+    double maxError = 0.0;
+    for(int i = -100000; i <= 100000; i++) {
+        const float radians = i * (2.0f * Geometry::Angle::PI / 100000);
+        maxError = std::max(maxError, std::fabs(Utils::Angles::fastSin(radians) - std::sin(double(radians))));
+        maxError = std::max(maxError, std::fabs(Utils::Angles::fastCos(radians) - std::cos(double(radians))));
+    }
+
+    EXPECT_LT(maxError, 1e-6);
+}
+
+TEST(Utils_Angles_Tests, GivenALargeAngle_FastSin_ShouldWrapIt) {
+    EXPECT_NEAR(Utils::Angles::fastSin(1000.0f), std::sin(1000.0), 1e-3);
+    EXPECT_NEAR(Utils::Angles::fastCos(-1000.0f), std::cos(-1000.0), 1e-3);
+}
+
+TEST(Utils_Angles_Tests, GivenAPoint_FastAtan2_ShouldBeWithinItsErrorBound) {
+    double maxError = 0.0;
+    for(int i = 0; i < 100000; i++) {
+        const double theta = -M_PI + 2 * M_PI * i / 100000;
+        for(float radius : {1e-3f, 1.0f, 250.0f}) {
+            const float x = radius * std::cos(theta), y = radius * std::sin(theta);
+            maxError = std::max(maxError, std::fabs(Utils::Angles::fastAtan2(y, x) - std::atan2(double(y), double(x))));
+        }
+    }
+
+    EXPECT_LT(maxError, 2e-6);
+}
+
+TEST(Utils_Angles_Tests, GivenAxisPoints_FastAtan2_ShouldMatchAtan2) {
+    EXPECT_FLOAT_EQ(Utils::Angles::fastAtan2(0.0f, 0.0f), 0.0f);
+    EXPECT_NEAR(Utils::Angles::fastAtan2(0.0f, 1.0f), 0.0f, 2e-6f);
+    EXPECT_NEAR(Utils::Angles::fastAtan2(1.0f, 0.0f), Geometry::Angle::PI / 2, 2e-6f);
+    EXPECT_NEAR(Utils::Angles::fastAtan2(0.0f, -1.0f), Geometry::Angle::PI, 2e-6f);
+    EXPECT_NEAR(Utils::Angles::fastAtan2(-1.0f, 0.0f), -Geometry::Angle::PI / 2, 2e-6f);
+    EXPECT_NEAR(Utils::Angles::fastAtan2(-1.0f, -1.0f), -3 * Geometry::Angle::PI / 4, 2e-6f);
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <Armorial/Utils/StaticVector/StaticVector.h>
+#include <Armorial/Geometry/Circle/Circle.h>
+#include <Armorial/Geometry/Rectangle/Rectangle.h>
+
+TEST(Utils_StaticVector_Tests, GivenElements_PushAndPop_ShouldTrackTheSize) {
+    Utils::StaticVector<int, 3> values;
+    EXPECT_TRUE(values.empty());
+    EXPECT_EQ(values.capacity(), 3u);
+
+    values.push_back(4);
+    values.emplace_back(7);
+    values.push_back(1);
+    EXPECT_EQ(values.size(), 3u);
+    EXPECT_EQ(values.front(), 4);
+    EXPECT_EQ(values.back(), 1);
+    EXPECT_EQ(values[1], 7);
+
+    values.pop_back();
+    EXPECT_EQ(values.size(), 2u);
+    values.clear();
+    EXPECT_TRUE(values.empty());
+}
+
+TEST(Utils_StaticVector_Tests, GivenElements_SortUniqueErase_ShouldWorkAsInStdVector) {
+    Utils::StaticVector<int, 4> values = {3, 1, 3, 2};
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+
+    EXPECT_EQ(std::vector<int>(values), std::vector<int>({1, 2, 3}));
+}
+
+TEST(Utils_StaticVector_Tests, GivenConstantElements_Operations_ShouldBeEvaluatedAtCompileTime) {
+    constexpr Utils::StaticVector<int, 2> values = {5, 6};
+    static_assert(values.size() == 2 && values[1] == 6);
+
+    EXPECT_EQ(values.back(), 6);
+}
+
+TEST(Utils_StaticVector_Tests, GivenGeometryQueries_Results_ShouldBeStoredInline) {
+    const Geometry::Circle circle(Geometry::Vector2D(0.0f, 0.0f), 1.0f);
+    const auto intersections = circle.intersects(Geometry::LineSegment(Geometry::Vector2D(-2.0f, 0.0f), Geometry::Vector2D(2.0f, 0.0f)));
+    static_assert(decltype(intersections)::capacity() == 2);
+    EXPECT_EQ(intersections.size(), 2u);
+
+    const auto boundary = Geometry::Rectangle(Geometry::Vector2D(0.0f, 1.0f), Geometry::Vector2D(1.0f, 0.0f)).boundary();
+    static_assert(decltype(boundary)::capacity() == 4);
+    EXPECT_EQ(boundary.size(), 4u);
+}